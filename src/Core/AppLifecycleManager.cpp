@@ -414,6 +414,12 @@ namespace kx {
             Hooking::D3DRenderHook::SetLifecycleManager(nullptr);
             CleanupHooks();
 
+            // Join extraction workers now: the EntityManager is destroyed during DLL unload,
+            // where joining threads would deadlock on the loader lock
+            if (m_entityManager) {
+                m_entityManager->Shutdown();
+            }
+
             m_servicesInitialized = false;
         }
     }
@@ -58,6 +58,10 @@ namespace kx {
         // --- Debug Logging Helper ---
         bool IsDebugLoggingEnabled() const { return m_settings.enableDebugLogging; }
 
+        // --- Current Map (MumbleLink map ID, relayed from the Render Thread to the Game Thread) ---
+        uint32_t GetMapId() const { return m_mapId.load(std::memory_order_relaxed); }
+        void SetMapId(uint32_t mapId) { m_mapId.store(mapId, std::memory_order_relaxed); }
+
         // --- Adaptive Far Plane (for "No Limit" mode) ---
         float GetAdaptiveFarPlane() const { return m_adaptiveFarPlaneCalculator.GetCurrentFarPlane(); }
         void UpdateAdaptiveFarPlane(const FrameGameData& frameData) {
@@ -78,6 +82,7 @@ namespace kx {
         bool m_isVisionWindowOpen = false;  // Release: Hide GUI by default (press INSERT to toggle)
         #endif
         std::atomic<bool> m_isShuttingDown = false;
+        std::atomic<uint32_t> m_mapId = 0;  // 0 until MumbleLink reports a map
         bool m_donationPromptShown = false; // Session-only flag (not persisted)
 
         // Adaptive far plane calculator
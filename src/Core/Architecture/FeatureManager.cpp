@@ -83,4 +83,12 @@ void FeatureManager::RunGameThreadUpdates() {
     }
 }
 
+ExtractionCategoryMask FeatureManager::GetConsumedCategories() const {
+    ExtractionCategoryMask consumed = 0;
+    for (const auto& feature : m_features) {
+        consumed |= feature->GetConsumedCategories();
+    }
+    return consumed;
+}
+
 } // namespace kx
@@ -3,6 +3,7 @@
 #include <windows.h> // For UINT, WPARAM, LPARAM
 #include <memory>
 #include <vector>
+#include "../../Game/Extraction/ExtractionScheduler.h"
 
 namespace spdlog { class logger; }
 struct ImDrawList;
@@ -86,6 +87,12 @@ public:
      */
     void RunGameThreadUpdates();
 
+    /**
+     * @brief Union of the entity categories consumed by all features.
+     * Called from the game thread hook.
+     */
+    ExtractionCategoryMask GetConsumedCategories() const;
+
     /**
      * @brief Get read-only access to all registered features.
      * Used for settings management and other introspection needs.
@@ -2,6 +2,7 @@
 
 #include <windows.h> // For UINT, WPARAM, LPARAM
 #include "../../libs/nlohmann/json.hpp"
+#include "../../Game/Extraction/ExtractionScheduler.h"
 
 struct ImDrawList;
 
@@ -76,6 +77,13 @@ public:
      */
     virtual void OnGameThreadUpdate() {}
 
+    /**
+     * @brief Entity categories this feature currently reads from the frame data.
+     * Called from the game thread before each extraction; categories no feature
+     * consumes are not extracted at all.
+     */
+    virtual ExtractionCategoryMask GetConsumedCategories() const { return 0; }
+
     /**
      * @brief Load feature-specific settings from JSON configuration.
      * @param j The JSON object containing feature settings (may be empty/null).
@@ -3,6 +3,7 @@
 #include "../Utils/Console.h"
 #include "AppState.h"
 #include <cstdio>
+#include <windows.h> // For FreeConsole, OutputDebugStringA
 
 namespace kx {
 
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <string_view> // For std::string_view
-#include <Windows.h>
 
 // ===== Build Configuration =====
 // Uncomment the line below to build for GW2AL (addon loader) mode.
@@ -29,8 +28,9 @@ namespace kx {
 
     // Hotkey Configuration
     namespace Hotkeys {
-        constexpr int TOGGLE_OVERLAY = VK_INSERT;  // Toggle ESP overlay visibility
-        constexpr int EXIT_APPLICATION = VK_DELETE; // Shutdown application
+        // Win32 virtual-key codes, spelled out so this header needs no Windows.h
+        constexpr int TOGGLE_OVERLAY = 0x2D;   // VK_INSERT: Toggle ESP overlay visibility
+        constexpr int EXIT_APPLICATION = 0x2E; // VK_DELETE: Shutdown application
     }
 
     // Timing Configuration
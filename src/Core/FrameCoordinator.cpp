@@ -52,6 +52,8 @@ void FrameCoordinator::Execute(kx::AppLifecycleManager& lifecycleManager,
         kx::MumbleLinkManager& mumbleLinkManager = lifecycleManager.GetMumbleLinkManager();
         mumbleLinkManager.Update();
         const kx::MumbleLinkData* mumbleLinkData = mumbleLinkManager.GetData();
+        // The Game Thread must not touch the MumbleLink mapping, which is unmapped here on disconnect
+        kx::AppState::Get().SetMapId(mumbleLinkManager.mapId());
 
         // Check for state transitions (GW2AL mode only)
 #ifdef GW2AL_BUILD
@@ -64,9 +66,10 @@ void FrameCoordinator::Execute(kx::AppLifecycleManager& lifecycleManager,
 
         // Get feature manager and update all features with extracted data
         kx::FeatureManager& featureManager = lifecycleManager.GetFeatureManager();
-        const kx::FrameGameData& frameData = lifecycleManager.GetEntityManager().GetFrameData();
+        // Pin the latest published frame for the rest of this render pass (no copy, no lock)
+        const kx::FrameDataHandle frameData = lifecycleManager.GetEntityManager().AcquireFrameData();
         const kx::ServiceContext& ctx = lifecycleManager.GetServiceContext();
-        featureManager.UpdateAll(0.016f, frameData, ctx); // Approximate 60 FPS deltaTime
+        featureManager.UpdateAll(0.016f, *frameData, ctx); // Approximate 60 FPS deltaTime
 
         // Render ImGui UI
         OverlayWindow::NewFrame();
@@ -1,121 +1,372 @@
 #include "EntityManager.h"
 #include "../../Game/Extraction/DataExtractor.h"
+#include "../../Game/Extraction/ExtractionSnapshot.h"
+#include "../../Memory/MemorySource.h"
+#include "../../Utils/DebugLogger.h"
 #include "../AppState.h"
 #include <algorithm>
+#include <chrono>
+#include <format>
 
 namespace kx {
 
 EntityManager::EntityManager() = default;
 
-void EntityManager::Update(uint64_t now) {
-    const float currentTimeSeconds = now / 1000.0f;
+FrameDataHandle EntityManager::AcquireFrameData() const {
+    for (;;) {
+        const size_t index = m_publishedIndex.load(std::memory_order_seq_cst);
+        const FrameSlot& slot = m_slots[index];
+
+        // Pin first, then confirm the slot is still the published one. The Game Thread
+        // checks the pin count after un-publishing a slot, so either it sees our pin
+        // or we see that the slot is no longer published and retry.
+        slot.readers.fetch_add(1, std::memory_order_seq_cst);
+        if (m_publishedIndex.load(std::memory_order_seq_cst) == index) {
+            return FrameDataHandle(&slot.frameData, &slot.readers);
+        }
+        slot.readers.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+size_t EntityManager::FindWritableSlot(uint32_t* outPinnedSlots) const {
+    // Reclaim the slot retired longest ago: a reader that is slow to let go of a frame
+    // is most likely still on one of the recent ones
+    const size_t published = m_publishedIndex.load(std::memory_order_seq_cst);
+    size_t best = BUFFER_COUNT;
+    uint32_t pinned = 0;
+    for (size_t index = 0; index < BUFFER_COUNT; ++index) {
+        if (index == published) continue;
+        if (m_slots[index].readers.load(std::memory_order_seq_cst) != 0) {
+            ++pinned;
+            continue;
+        }
+        if (best == BUFFER_COUNT || m_slots[index].publishedEpoch < m_slots[best].publishedEpoch) {
+            best = index;
+        }
+    }
+    if (outPinnedSlots) {
+        *outPinnedSlots = pinned;
+    }
+    return best;
+}
+
+void EntityManager::Update(uint64_t now, uint32_t gameFrameMs, ExtractionCategoryMask consumed) {
+    if (m_hasSnapshotRequest.load(std::memory_order_acquire)) {
+        m_decodeWorker.WaitIdle(); // The request reuses a frame slot the decoder may be writing
+        ProcessSnapshotRequest();
+    }
+
+    // MumbleLink reports 0 until it is up; only a move from one known map to another starts over
+    const uint32_t mapId = AppState::Get().GetMapId();
+    if (mapId != 0 && mapId != m_mapId) {
+        if (m_mapId != 0) {
+            LOG_INFO("[EntityManager] Map changed (%u -> %u), extraction state reset", m_mapId, mapId);
+            Reset();
+        }
+        m_mapId = mapId;
+    }
+
+    // A background decode that finished since the last tick settles its categories before
+    // anything is scheduled: only then is it known which ones it completed
+    if (!m_decodeWorker.IsBusy()) {
+        SettleStagedPass();
+    }
+
     const Settings& settings = AppState::Get().GetSettings();
-    const float updateInterval = 1.0f / (std::max)(1.0f, settings.espUpdateRate);
-
-    if (currentTimeSeconds - m_lastGameDataUpdateTime >= updateInterval) {
-        // 1. Determine which pools to write to (back buffers)
-        // We compute the next index but don't flip the global index yet
-        const size_t nextIndex = (m_writeIndex + 1) % BUFFER_COUNT;
-
-        // Get references to the back buffer pools
-        auto& nextPlayerPool = m_playerPools[nextIndex];
-        auto& nextNpcPool = m_npcPools[nextIndex];
-        auto& nextGadgetPool = m_gadgetPools[nextIndex];
-        auto& nextAttackTargetPool = m_attackTargetPools[nextIndex];
-        auto& nextItemPool = m_itemPools[nextIndex];
-
-        // 2. Reset ONLY the back buffer pools and scratch buffers
-        nextPlayerPool.Reset();
-        nextNpcPool.Reset();
-        nextGadgetPool.Reset();
-        nextAttackTargetPool.Reset();
-        nextItemPool.Reset();
-        m_frameDataWorkBuffer.Reset();
-
-        // Clear the persistent character-to-name map (retains capacity for high-water mark strategy)
-        m_charToNameMap.clear();
-
-        // 3. Extract entity data from game memory into work buffer and back buffer pools
-        const bool extracted = DataExtractor::ExtractFrameData(
-            nextPlayerPool, nextNpcPool, nextGadgetPool,
-            nextAttackTargetPool, nextItemPool, m_frameDataWorkBuffer,
-            m_charToNameMap
-        );
+    m_scheduler.SetRates(settings.extraction);
+    // Categories nobody consumes are never marked extracted: they are due at once when re-enabled
+    consumed |= CategoryBit(ExtractionCategory::Players);
+    const ExtractionCategoryMask due = m_scheduler.GetDue(now) & consumed;
+    if (due == 0) {
+        return;
+    }
 
-        if (extracted) {
-            // Collect all combat state keys from work buffer
-            const size_t totalCount = m_frameDataWorkBuffer.players.size() + m_frameDataWorkBuffer.npcs.size() +
-                m_frameDataWorkBuffer.gadgets.size() + m_frameDataWorkBuffer.attackTargets.size() +
-                m_frameDataWorkBuffer.items.size();
-
-            m_activeCombatKeys.clear();
-            m_activeCombatKeys.reserve(totalCount);
-
-            auto collectKeys = [&](const auto& collection) {
-                for (const auto* e : collection) {
-                    m_activeCombatKeys.insert(e->GetCombatKey());
-                }
-            };
-
-            collectKeys(m_frameDataWorkBuffer.players);
-            collectKeys(m_frameDataWorkBuffer.npcs);
-            collectKeys(m_frameDataWorkBuffer.gadgets);
-            collectKeys(m_frameDataWorkBuffer.attackTargets);
-            collectKeys(m_frameDataWorkBuffer.items);
-
-            // Prune stale combat states
-            m_combatStateManager.Prune(m_activeCombatKeys);
-
-            // Update combat states
-            m_allEntitiesBuffer.clear();
-            if (m_allEntitiesBuffer.capacity() < totalCount) {
-                m_allEntitiesBuffer.reserve(totalCount);
-            }
+    // Spawn or join workers when the opt-in parallel mode is toggled or resized
+    const size_t workerThreads = settings.extraction.parallelExtraction
+        ? static_cast<size_t>(std::clamp(settings.extraction.workerThreads, 1, ExtractionSettings::MAX_WORKER_THREADS))
+        : 0;
+    if (m_workerPool.GetWorkerCount() != workerThreads) {
+        m_workerPool.Resize(workerThreads);
+        LOG_INFO("[EntityManager] Extraction workers: %zu", m_workerPool.GetWorkerCount());
+    }
+
+    if (settings.extraction.backgroundDecode) {
+        if (!m_decodeWorker.IsRunning()) {
+            m_decodeWorker.Start([this]() { DecodeStagedPass(); });
+        }
+        // The previous decode still owns the staging image: skip this tick rather than block
+        if (m_decodeWorker.IsBusy()) {
+            return;
+        }
+        CaptureStagedPass(now, due, consumed, gameFrameMs, mapId);
+        m_decodeWorker.TryKick();
+        return; // Marked extracted by SettleStagedPass() once the decode is done
+    }
+
+    if (m_decodeWorker.IsRunning()) {
+        m_decodeWorker.Stop(); // Waits for the last decode; the state is ours again afterwards
+        SettleStagedPass();
+        m_stagingPrimer.Clear(); // Re-enabling starts from empty lists, so the first capture primes everything
+    }
+    if (!RunExtractionPass(now, due, consumed, gameFrameMs, mapId, nullptr)) {
+        return;
+    }
+    m_scheduler.MarkExtracted(due, now);
+}
+
+void EntityManager::CaptureStagedPass(uint64_t now, ExtractionCategoryMask categories, ExtractionCategoryMask consumed, uint32_t gameFrameMs, uint32_t mapId) {
+    const auto start = std::chrono::steady_clock::now();
+    MemorySource::CaptureStaging(m_stagingImage, m_capturePages);
+    {
+        // Entities that just appeared in a list have no pages in the image yet: read them now,
+        // so this pass's decode already has them
+        MemorySource::ScopedRecording recording(m_stagingImage);
+        m_staging.primedEntities = m_stagingPrimer.Prime(categories, now);
+    }
+
+    m_staging.now = now;
+    m_staging.categories = categories;
+    m_staging.consumed = consumed;
+    m_staging.gameFrameMs = gameFrameMs;
+    m_staging.mapId = mapId;
+    m_staging.stagedPages = static_cast<uint32_t>(m_stagingImage.GetPageCount());
+    m_staging.pending = true;
+    m_staging.decoded = false;
+    m_staging.missedCategories = 0;
+    m_staging.captureMicros = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+void EntityManager::DecodeStagedPass() {
+    {
+        MemorySource::ScopedStaging staging(m_stagingImage);
+        m_staging.decoded = RunExtractionPass(m_staging.now, m_staging.categories, m_staging.consumed, m_staging.gameFrameMs, m_staging.mapId, &m_staging);
+    }
+    // The pages this decode read or found missing are what the next capture copies. A skipped
+    // pass read nothing: the previous page set stays.
+    if (m_staging.decoded) {
+        m_stagingImage.CollectTouchedPages(m_capturePages);
+    }
+}
 
-            m_allEntitiesBuffer.insert(m_allEntitiesBuffer.end(), m_frameDataWorkBuffer.players.begin(), m_frameDataWorkBuffer.players.end());
-            m_allEntitiesBuffer.insert(m_allEntitiesBuffer.end(), m_frameDataWorkBuffer.npcs.begin(), m_frameDataWorkBuffer.npcs.end());
-            m_allEntitiesBuffer.insert(m_allEntitiesBuffer.end(), m_frameDataWorkBuffer.gadgets.begin(), m_frameDataWorkBuffer.gadgets.end());
-            m_allEntitiesBuffer.insert(m_allEntitiesBuffer.end(), m_frameDataWorkBuffer.attackTargets.begin(), m_frameDataWorkBuffer.attackTargets.end());
-            m_allEntitiesBuffer.insert(m_allEntitiesBuffer.end(), m_frameDataWorkBuffer.items.begin(), m_frameDataWorkBuffer.items.end());
-            m_combatStateManager.Update(m_allEntitiesBuffer, now);
-
-            // Update adaptive far plane
-            AppState::Get().UpdateAdaptiveFarPlane(m_frameDataWorkBuffer);
-
-            // 4. Atomically publish: Swap work buffer to snapshot AND flip the write index
-            // Both operations happen inside the lock to ensure render thread sees consistent state
-            {
-                std::lock_guard<std::mutex> lock(m_snapshotMutex);
-                std::swap(m_frameDataSnapshot, m_frameDataWorkBuffer);
-
-                // CRITICAL: Flip the write index inside the lock.
-                // This ensures the render thread (which grabbed the snapshot) is now 
-                // officially "using" the data from the new pool index.
-                // The NEXT update will target the old index (which is now safe to overwrite).
-                m_writeIndex = nextIndex;
+void EntityManager::SettleStagedPass() {
+    if (!m_staging.pending) {
+        return;
+    }
+    m_staging.pending = false;
+    if (m_staging.decoded) {
+        m_scheduler.MarkExtracted(m_staging.categories & ~m_staging.missedCategories, m_staging.now);
+    }
+}
+
+bool EntityManager::RunExtractionPass(uint64_t now, ExtractionCategoryMask categories, ExtractionCategoryMask consumed,
+    uint32_t gameFrameMs, uint32_t mapId, StagingInfo* staging) {
+    // 1. Pick a slot that is neither published nor pinned by a reader.
+    // If readers are holding every other slot, skip this tick rather than block.
+    uint32_t pinnedSlots = 0;
+    const size_t writeIndex = FindWritableSlot(&pinnedSlots);
+    if (writeIndex == BUFFER_COUNT) {
+        ++m_skippedPasses;
+        return false;
+    }
+    FrameSlot& slot = m_slots[writeIndex];
+
+    // 2. Reset ONLY the back buffer pools and frame
+    slot.Clear();
+    FrameGameData& frameData = slot.frameData;
+
+    // 3. Extract the due categories from game memory into the back buffer pools; the others
+    // are copied from the published frame, which the Game Thread never writes to
+    m_extractionContext.workerPool = &m_workerPool;
+    m_extractionContext.now = now;
+    m_extractionContext.categories = categories;
+    m_extractionContext.consumed = consumed;
+    m_extractionContext.mapId = mapId;
+    const ExtractionSettings& extraction = AppState::Get().GetSettings().extraction;
+    m_extractionContext.distanceLod = extraction.distanceLod;
+    m_extractionContext.prefetchDistance = static_cast<uint32_t>(std::clamp(extraction.prefetchDistance, 0, ExtractionSettings::MAX_PREFETCH_DISTANCE));
+    // A background decode does not hold the game thread, so it always runs to completion
+    m_extractionContext.budgetMicros = (extraction.timeBudget && !staging)
+        ? static_cast<uint32_t>(std::clamp(extraction.budgetMicros, ExtractionSettings::MIN_BUDGET_MICROS, ExtractionSettings::MAX_BUDGET_MICROS))
+        : 0;
+    m_extractionContext.previousFrame = &m_slots[m_publishedIndex.load(std::memory_order_seq_cst)].frameData;
+    const bool extracted = DataExtractor::ExtractFrameData(
+        slot.playerPool, slot.npcPool, slot.gadgetPool,
+        slot.attackTargetPool, slot.itemPool, frameData,
+        m_extractionContext
+    );
+    frameData.stats.gameFrameMs = gameFrameMs;
+    frameData.stats.pinnedSlots = pinnedSlots;
+    frameData.stats.skippedPasses = m_skippedPasses;
+    if (staging) {
+        frameData.stats.captureMicros = staging->captureMicros;
+        frameData.stats.stagedPages = staging->stagedPages;
+        frameData.stats.missingPages = static_cast<uint32_t>(m_stagingImage.GetRequestedPageCount());
+        frameData.stats.primedEntities = staging->primedEntities;
+        staging->missedCategories = frameData.stats.missedCategories;
+    }
+
+    if (extracted) {
+        const size_t totalCount = frameData.players.size() + frameData.npcs.size() +
+            frameData.gadgets.size() + frameData.attackTargets.size() +
+            frameData.items.size();
+
+        // Spawn/despawn events against the previously published frame
+        auto addKeys = [&](const auto& collection) {
+            for (const auto* e : collection) {
+                m_entityEventDiff.Add(static_cast<uint32_t>(e->agentId), e->address, e->entityType);
             }
+        };
+
+        addKeys(frameData.players);
+        addKeys(frameData.npcs);
+        addKeys(frameData.gadgets);
+        addKeys(frameData.attackTargets);
+        addKeys(frameData.items);
+        m_entityEventDiff.Diff(frameData.events);
+
+        // Prune combat states of despawned entities
+        m_combatStateManager.Prune(frameData.events);
+
+        // Update combat states
+        m_allEntitiesBuffer.clear();
+        if (m_allEntitiesBuffer.capacity() < totalCount) {
+            m_allEntitiesBuffer.reserve(totalCount);
         }
 
-        m_lastGameDataUpdateTime = currentTimeSeconds;
+        m_allEntitiesBuffer.insert(m_allEntitiesBuffer.end(), frameData.players.begin(), frameData.players.end());
+        m_allEntitiesBuffer.insert(m_allEntitiesBuffer.end(), frameData.npcs.begin(), frameData.npcs.end());
+        m_allEntitiesBuffer.insert(m_allEntitiesBuffer.end(), frameData.gadgets.begin(), frameData.gadgets.end());
+        m_allEntitiesBuffer.insert(m_allEntitiesBuffer.end(), frameData.attackTargets.begin(), frameData.attackTargets.end());
+        m_allEntitiesBuffer.insert(m_allEntitiesBuffer.end(), frameData.items.begin(), frameData.items.end());
+        m_combatStateManager.Update(m_allEntitiesBuffer, now);
+
+        // Update adaptive far plane
+        AppState::Get().UpdateAdaptiveFarPlane(frameData);
+
+        // 4. Publish: a single atomic store hands the slot to the Render Thread.
+        // The previously published slot is retired and becomes writable again once its readers unpin it.
+        frameData.epoch = ++m_publishEpoch;
+        slot.publishedEpoch = frameData.epoch;
+        m_publishedIndex.store(writeIndex, std::memory_order_seq_cst);
     }
+
+    return true;
 }
 
 void EntityManager::Reset() {
-    for (size_t i = 0; i < BUFFER_COUNT; ++i) {
-        m_playerPools[i].Reset();
-        m_npcPools[i].Reset();
-        m_gadgetPools[i].Reset();
-        m_attackTargetPools[i].Reset();
-        m_itemPools[i].Reset();
-    }
-    m_frameDataWorkBuffer.Reset();
-    {
-        std::lock_guard<std::mutex> lock(m_snapshotMutex);
-        m_frameDataSnapshot.Reset();
+    m_decodeWorker.WaitIdle();
+
+    // Slots still pinned by the Render Thread are left alone; they are cleared
+    // the next time they are picked for writing. Publish an empty frame instead: everything
+    // the last frame had despawns, and the empty frame carries those events when it is published.
+    const size_t writeIndex = FindWritableSlot();
+    std::vector<EntityEvent> unpublishedEvents;
+    std::vector<EntityEvent>& events = writeIndex != BUFFER_COUNT ? m_slots[writeIndex].frameData.events : unpublishedEvents;
+    if (writeIndex != BUFFER_COUNT) {
+        m_slots[writeIndex].Clear();
+    }
+    m_entityEventDiff.Diff(events);
+    m_combatStateManager.Prune(events);
+    if (writeIndex != BUFFER_COUNT) {
+        m_slots[writeIndex].frameData.epoch = ++m_publishEpoch;
+        m_slots[writeIndex].publishedEpoch = m_publishEpoch;
+        m_publishedIndex.store(writeIndex, std::memory_order_seq_cst);
     }
-    m_activeCombatKeys.clear();
     m_allEntitiesBuffer.clear();
-    m_writeIndex = 0;
+    m_extractionContext.ClearMapState();
+    m_capturePages.clear(); // The old map's pages are not worth staging
+    m_stagingPrimer.Clear();
+    m_staging.pending = false;
+    m_scheduler.Reset(); // Nothing is carried over into the new map
+}
+
+void EntityManager::Shutdown() {
+    m_decodeWorker.Stop();
+    m_workerPool.Resize(0);
+}
+
+void EntityManager::RequestSnapshotCapture(const std::filesystem::path& path) {
+    std::lock_guard<std::mutex> lock(m_snapshotRequestMutex);
+    m_snapshotRequest = { SnapshotRequest::Kind::Capture, path, 1 };
+    m_snapshotStatus = "Capture pending...";
+    m_hasSnapshotRequest.store(true, std::memory_order_release);
+}
+
+void EntityManager::RequestSnapshotReplay(const std::filesystem::path& path, uint32_t iterations) {
+    std::lock_guard<std::mutex> lock(m_snapshotRequestMutex);
+    m_snapshotRequest = { SnapshotRequest::Kind::Replay, path, iterations };
+    m_snapshotStatus = "Replay pending...";
+    m_hasSnapshotRequest.store(true, std::memory_order_release);
+}
+
+std::string EntityManager::GetSnapshotStatus() const {
+    std::lock_guard<std::mutex> lock(m_snapshotRequestMutex);
+    return m_snapshotStatus;
+}
+
+void EntityManager::ProcessSnapshotRequest() {
+    SnapshotRequest request;
+    {
+        std::lock_guard<std::mutex> lock(m_snapshotRequestMutex);
+        request = std::move(m_snapshotRequest);
+        m_snapshotRequest = {};
+        m_hasSnapshotRequest.store(false, std::memory_order_relaxed);
+    }
+
+    const size_t writeIndex = FindWritableSlot();
+    if (writeIndex == BUFFER_COUNT) {
+        std::lock_guard<std::mutex> lock(m_snapshotRequestMutex);
+        m_snapshotStatus = "No free slot, try again";
+        return;
+    }
+    FrameSlot& slot = m_slots[writeIndex];
+
+    // The scratch slot is never published; it is cleared again before its next use.
+    // A separate context starts with cold records, so a capture records every stable-tier page
+    // and a replay measures one full pass followed by steady-state incremental passes.
+    // It has no worker pool: recorded and replayed memory is bound to this thread.
+    ExtractionContext snapshotContext;
+    size_t entityCount = 0;
+    auto extract = [&]() {
+        slot.Clear();
+        const bool extracted = DataExtractor::ExtractFrameData(
+            slot.playerPool, slot.npcPool, slot.gadgetPool,
+            slot.attackTargetPool, slot.itemPool, slot.frameData,
+            snapshotContext
+        );
+        entityCount = slot.frameData.players.size() + slot.frameData.npcs.size() +
+            slot.frameData.gadgets.size() + slot.frameData.attackTargets.size() +
+            slot.frameData.items.size();
+        return extracted;
+    };
+
+    std::string status;
+    if (request.kind == SnapshotRequest::Kind::Capture) {
+        ExtractionSnapshot::CaptureResult result;
+        if (ExtractionSnapshot::Capture(request.path, extract, result)) {
+            status = std::format("Captured {} entities, {} pages ({} KiB)",
+                entityCount, result.pageCount, result.byteCount / 1024);
+            LOG_INFO("[EntityManager] Snapshot captured to %s: %s", request.path.u8string().c_str(), status.c_str());
+        } else {
+            status = "Capture failed";
+            LOG_ERROR("[EntityManager] Snapshot capture to %s failed", request.path.u8string().c_str());
+        }
+    } else if (request.kind == SnapshotRequest::Kind::Replay) {
+        ExtractionSnapshot::ReplayResult result;
+        if (ExtractionSnapshot::Replay(request.path, request.iterations, extract, result)) {
+            status = std::format("Replayed {} entities x{}: avg {:.1f} us, min {:.1f} us, max {:.1f} us",
+                entityCount, result.iterations, result.avgUs, result.minUs, result.maxUs);
+            LOG_INFO("[EntityManager] Snapshot replay of %s: %s", request.path.u8string().c_str(), status.c_str());
+        } else {
+            status = "Replay failed";
+            LOG_ERROR("[EntityManager] Snapshot replay of %s failed", request.path.u8string().c_str());
+        }
+    }
+    slot.Clear();
+
+    std::lock_guard<std::mutex> lock(m_snapshotRequestMutex);
+    m_snapshotStatus = status;
 }
 
 } // namespace kx
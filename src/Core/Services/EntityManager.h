@@ -3,8 +3,11 @@
 #include <cstdint>
 #include <memory>
 #include <vector>
-#include <mutex>
+#include <atomic>
 #include <array>
+#include <mutex>
+#include <string>
+#include <filesystem>
 #include <ankerl/unordered_dense.h>
 #include "../../Game/Data/FrameData.h"
 #include "../../Game/Data/EntityData.h"
@@ -12,16 +15,76 @@
 #include "../../Rendering/Shared/LayoutConstants.h"
 #include "../../Game/Services/Combat/CombatStateManager.h"
 #include "../../Game/Services/Combat/CombatStateKey.h"
+#include "../../Game/Extraction/EntityEventDiff.h"
+#include "../../Game/Extraction/ExtractionContext.h"
+#include "../../Game/Extraction/ExtractionScheduler.h"
+#include "../../Game/Extraction/StagingPrimer.h"
+#include "../../Utils/ForkJoinPool.h"
+#include "../../Utils/BackgroundWorker.h"
+#include "../../Memory/MemoryImage.h"
 
 namespace kx {
 
+/**
+ * @brief Read-only view of a published frame, pinned for the lifetime of the handle
+ *
+ * While a handle is alive the Game Thread will not recycle the pools backing the
+ * frame. Handles are move-only and should be held only for the duration of one
+ * render pass.
+ */
+class FrameDataHandle {
+public:
+    FrameDataHandle() = default;
+    FrameDataHandle(const FrameGameData* data, std::atomic<uint32_t>* pin)
+        : m_data(data), m_pin(pin) {}
+
+    ~FrameDataHandle() { Release(); }
+
+    FrameDataHandle(const FrameDataHandle&) = delete;
+    FrameDataHandle& operator=(const FrameDataHandle&) = delete;
+
+    FrameDataHandle(FrameDataHandle&& other) noexcept
+        : m_data(other.m_data), m_pin(other.m_pin) {
+        other.m_data = nullptr;
+        other.m_pin = nullptr;
+    }
+
+    FrameDataHandle& operator=(FrameDataHandle&& other) noexcept {
+        if (this != &other) {
+            Release();
+            m_data = other.m_data;
+            m_pin = other.m_pin;
+            other.m_data = nullptr;
+            other.m_pin = nullptr;
+        }
+        return *this;
+    }
+
+    const FrameGameData& Get() const { return *m_data; }
+    const FrameGameData& operator*() const { return *m_data; }
+    const FrameGameData* operator->() const { return m_data; }
+
+private:
+    void Release() {
+        if (m_pin) {
+            m_pin->fetch_sub(1, std::memory_order_release);
+            m_pin = nullptr;
+        }
+        m_data = nullptr;
+    }
+
+    const FrameGameData* m_data = nullptr;
+    std::atomic<uint32_t>* m_pin = nullptr;
+};
+
 /**
  * @brief Manages game entity data extraction, pooling, and combat state tracking
  * 
  * This class serves as the "Source of Truth" for all game entity data.
  * It handles:
  * - Object pooling for efficient entity management
- * - Throttled data extraction from game memory
+ * - Per-category scheduled data extraction from game memory, optionally split into a game-thread
+ *   capture and a decode on a background thread
  * - Combat state tracking and updates
  * - Frame data aggregation
  * 
@@ -35,22 +98,26 @@ public:
     /**
      * @brief Update entity data extraction and combat states
      * 
-     * Performs throttled extraction based on settings.espUpdateRate.
+     * Extracts each entity category at its own rate (settings.extraction), carrying the
+     * categories that are not due over from the previous frame.
      * Updates object pools, extracts frame data, and manages combat states.
      * 
      * @param now Current time in milliseconds (from GetTickCount64)
+     * @param gameFrameMs The game's frame time for this tick, reported next to the extraction cost
+     * @param consumed Categories some feature uses (FeatureManager::GetConsumedCategories); the
+     *        others are not extracted. Players are always extracted: the local player anchors
+     *        distance LOD and the adaptive far plane.
      */
-    void Update(uint64_t now);
+    void Update(uint64_t now, uint32_t gameFrameMs = 0, ExtractionCategoryMask consumed = ALL_EXTRACTION_CATEGORIES);
 
     /**
-     * @brief Get a copy of the current frame's game data.
-     * Thread-safe: Returns by value so the Render Thread owns its own pointer lists;
-     * the Game Thread can swap/reset without invalidating iterators.
+     * @brief Acquire a read-only view of the most recently published frame.
+     *
+     * Lock-free and copy-free: pins the published slot and returns a handle to it.
+     * The Game Thread never writes to a slot that is published or pinned, so the
+     * view stays valid until the handle is destroyed.
      */
-    FrameGameData GetFrameData() const {
-        std::lock_guard<std::mutex> lock(m_snapshotMutex);
-        return m_frameDataSnapshot;
-    }
+    FrameDataHandle AcquireFrameData() const;
 
     /**
      * @brief Get reference to CombatStateManager for frame context
@@ -59,59 +126,174 @@ public:
     CombatStateManager& GetCombatStateManager() { return m_combatStateManager; }
 
     /**
-     * @brief Reset all pools and frame data (e.g., on map change)
+     * @brief Reset all pools and frame data. Update() calls it when MumbleLink reports another map.
      */
     void Reset();
 
+    /**
+     * @brief Join the extraction worker threads
+     * Call during service cleanup, never from DllMain (joining under the loader lock deadlocks).
+     */
+    void Shutdown();
+
+    /**
+     * @brief Queue a recording of the next extraction pass to a memory image file
+     * Processed on the Game Thread at the start of the next Update().
+     */
+    void RequestSnapshotCapture(const std::filesystem::path& path);
+
+    /**
+     * @brief Queue a replay benchmark: run extraction against a memory image file N times
+     * Processed on the Game Thread at the start of the next Update(). Results are logged.
+     */
+    void RequestSnapshotReplay(const std::filesystem::path& path, uint32_t iterations);
+
+    /**
+     * @brief Human-readable result of the last capture/replay request (for the debug UI)
+     */
+    std::string GetSnapshotStatus() const;
+
 private:
-    // Triple-buffered object pools: avoids Game Thread overwriting the pool
-    // the Render Thread is reading when game FPS exceeds render FPS
-    static constexpr size_t BUFFER_COUNT = 3;
-    size_t m_writeIndex = 0;
-
-    std::array<ObjectPool<PlayerEntity>, BUFFER_COUNT> m_playerPools{
-        ObjectPool<PlayerEntity>(EntityLimits::MAX_PLAYERS),
-        ObjectPool<PlayerEntity>(EntityLimits::MAX_PLAYERS),
-        ObjectPool<PlayerEntity>(EntityLimits::MAX_PLAYERS)
-    };
-    std::array<ObjectPool<NpcEntity>, BUFFER_COUNT> m_npcPools{
-        ObjectPool<NpcEntity>(EntityLimits::MAX_NPCS),
-        ObjectPool<NpcEntity>(EntityLimits::MAX_NPCS),
-        ObjectPool<NpcEntity>(EntityLimits::MAX_NPCS)
-    };
-    std::array<ObjectPool<GadgetEntity>, BUFFER_COUNT> m_gadgetPools{
-        ObjectPool<GadgetEntity>(EntityLimits::MAX_GADGETS),
-        ObjectPool<GadgetEntity>(EntityLimits::MAX_GADGETS),
-        ObjectPool<GadgetEntity>(EntityLimits::MAX_GADGETS)
+    /**
+     * @brief One buffer of the publication ring: entity pools plus the frame that points into them
+     */
+    struct FrameSlot {
+        ObjectPool<PlayerEntity> playerPool{ EntityLimits::MAX_PLAYERS };
+        ObjectPool<NpcEntity> npcPool{ EntityLimits::MAX_NPCS };
+        ObjectPool<GadgetEntity> gadgetPool{ EntityLimits::MAX_GADGETS };
+        ObjectPool<AttackTargetEntity> attackTargetPool{ EntityLimits::MAX_ATTACK_TARGETS };
+        ObjectPool<ItemEntity> itemPool{ EntityLimits::MAX_ITEMS };
+        FrameGameData frameData;
+
+        // Number of render-side handles currently reading this slot
+        mutable std::atomic<uint32_t> readers{ 0 };
+
+        // Publication epoch of the frame in this slot (0 = never published); written by the
+        // publishing thread only, used to reclaim the slot retired longest ago first
+        uint64_t publishedEpoch = 0;
+
+        void Clear() {
+            playerPool.Reset();
+            npcPool.Reset();
+            gadgetPool.Reset();
+            attackTargetPool.Reset();
+            itemPool.Reset();
+            frameData.Reset();
+        }
     };
-    std::array<ObjectPool<AttackTargetEntity>, BUFFER_COUNT> m_attackTargetPools{
-        ObjectPool<AttackTargetEntity>(EntityLimits::MAX_ATTACK_TARGETS),
-        ObjectPool<AttackTargetEntity>(EntityLimits::MAX_ATTACK_TARGETS),
-        ObjectPool<AttackTargetEntity>(EntityLimits::MAX_ATTACK_TARGETS)
+
+    struct SnapshotRequest {
+        enum class Kind { None, Capture, Replay };
+        Kind kind = Kind::None;
+        std::filesystem::path path;
+        uint32_t iterations = 0;
     };
-    std::array<ObjectPool<ItemEntity>, BUFFER_COUNT> m_itemPools{
-        ObjectPool<ItemEntity>(EntityLimits::MAX_ITEMS),
-        ObjectPool<ItemEntity>(EntityLimits::MAX_ITEMS),
-        ObjectPool<ItemEntity>(EntityLimits::MAX_ITEMS)
+
+    /**
+     * @brief Game-thread half of a background-decode pass, and what the decode reports back
+     */
+    struct StagingInfo {
+        uint64_t now = 0;
+        ExtractionCategoryMask categories = ALL_EXTRACTION_CATEGORIES;
+        ExtractionCategoryMask consumed = ALL_EXTRACTION_CATEGORIES;
+        uint32_t gameFrameMs = 0;
+        uint32_t mapId = 0;
+        uint32_t captureMicros = 0;
+        uint32_t stagedPages = 0;
+        uint32_t primedEntities = 0;
+
+        // Written by the decode thread, read by the Game Thread once the worker is idle
+        bool pending = false;                       // Captured, not yet settled with the scheduler
+        bool decoded = false;                       // False if the pass was skipped (no writable slot)
+        ExtractionCategoryMask missedCategories = 0; // Categories with entities behind missing pages
     };
 
-    // Double-buffering for thread-safe access
-    // Work buffer: Populated by Game Thread during Update()
-    FrameGameData m_frameDataWorkBuffer;
-    // Snapshot: Stable copy for Render Thread consumption
-    mutable FrameGameData m_frameDataSnapshot;
-    mutable std::mutex m_snapshotMutex;
+    /**
+     * @brief Extract into a free slot, update combat state and publish
+     * @param now Current time in milliseconds
+     * @param categories Categories to read; the rest are copied from the published frame
+     * @param consumed Categories some feature uses; the rest are left empty
+     * @param gameFrameMs Game frame time of the tick, for the stats
+     * @param mapId MumbleLink map ID (0 = unknown), keys the static gadget cache
+     * @param staging Capture info when decoding a staged image (receives the missed categories),
+     *        nullptr when reading live memory
+     * @return false if no slot was writable (the pass was skipped)
+     */
+    bool RunExtractionPass(uint64_t now, ExtractionCategoryMask categories, ExtractionCategoryMask consumed,
+        uint32_t gameFrameMs, uint32_t mapId, StagingInfo* staging);
+
+    /**
+     * @brief Capture stage (Game Thread): copy the pages the last decode read into the staging image,
+     *        plus the pages of the entities in newly occupied list slots (see StagingPrimer)
+     */
+    void CaptureStagedPass(uint64_t now, ExtractionCategoryMask categories, ExtractionCategoryMask consumed, uint32_t gameFrameMs, uint32_t mapId);
+
+    /**
+     * @brief Mark the categories the last decode completed as extracted (Game Thread, worker idle)
+     *
+     * Categories whose decode ran into missing pages stay due, so they are read again as soon
+     * as the next capture has the pages; nothing is marked for a skipped pass.
+     */
+    void SettleStagedPass();
+
+    /**
+     * @brief Decode stage (decode thread): run a full pass against the staging image
+     */
+    void DecodeStagedPass();
+
+    /**
+     * @brief Run a pending capture/replay request against a spare slot (never published)
+     */
+    void ProcessSnapshotRequest();
+
+    /**
+     * @brief Find a slot the Game Thread may overwrite (not published, not pinned)
+     * Among several, the one published the longest ago is reclaimed first.
+     * @param outPinnedSlots Optional: receives the number of retired slots still pinned by readers
+     * @return Slot index, or BUFFER_COUNT if every slot is in use
+     */
+    size_t FindWritableSlot(uint32_t* outPinnedSlots = nullptr) const;
+
+    // Triple-buffered slots: one published, one possibly still pinned by the Render Thread,
+    // one free for the Game Thread to write into. Slots are only recycled once no reader pins
+    // them; the spare keeps extraction running when a slow render frame and another reader
+    // (e.g. the UI) hold two retired frames at once, instead of skipping passes.
+    static constexpr size_t SPARE_SLOTS = 1;
+    static constexpr size_t BUFFER_COUNT = 3 + SPARE_SLOTS;
+    std::array<FrameSlot, BUFFER_COUNT> m_slots;
+    std::atomic<size_t> m_publishedIndex{ 0 };
+    uint64_t m_publishEpoch = 0;  // Epoch of the last published frame
+    uint32_t m_skippedPasses = 0; // Passes skipped because every slot was pinned
+    uint32_t m_mapId = 0;         // Last known MumbleLink map (0 until one is reported)
 
     // Combat state management
     CombatStateManager m_combatStateManager;
-    ankerl::unordered_dense::set<CombatStateKey, CombatStateKeyHash> m_activeCombatKeys;
+    EntityEventDiff m_entityEventDiff;
     std::vector<GameEntity*> m_allEntitiesBuffer;
 
-    // Persistent map for character-to-player-name lookup (cleared every frame, retains capacity)
-    ankerl::unordered_dense::map<void*, const wchar_t*> m_charToNameMap;
+    // Persistent extraction state: name map, per-entity record shards, page probe caches
+    ExtractionContext m_extractionContext;
+
+    // Optional fork-join workers, sized from settings.extraction (empty = serial extraction)
+    ForkJoinPool m_workerPool;
+
+    // Background decode (settings.extraction.backgroundDecode). While a decode runs, the
+    // decode thread owns the staging image, the extraction context and the combat state;
+    // the Game Thread only touches them again once the worker is idle.
+    BackgroundWorker m_decodeWorker;
+    MemoryImage m_stagingImage;
+    std::vector<uintptr_t> m_capturePages; // Pages the last decode read; copied by the next capture
+    StagingPrimer m_stagingPrimer;         // Game Thread only
+    StagingInfo m_staging;
+
+    // Per-category deadlines (integer milliseconds)
+    ExtractionScheduler m_scheduler;
 
-    // Throttling
-    float m_lastGameDataUpdateTime = 0.0f;
+    // Snapshot capture/replay requests from the UI (rare; the flag keeps the hot path lock-free)
+    std::atomic<bool> m_hasSnapshotRequest{ false };
+    mutable std::mutex m_snapshotRequestMutex;
+    SnapshotRequest m_snapshotRequest;
+    std::string m_snapshotStatus;
 };
 
 } // namespace kx
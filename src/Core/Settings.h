@@ -4,6 +4,7 @@
 #include "../../libs/nlohmann/json.hpp"
 #include "Settings/SettingsConstants.h"
 #include "Settings/RenderSettings.h"
+#include "Settings/ExtractionSettings.h"
 
 namespace kx {
 
@@ -17,7 +18,7 @@ namespace kx {
         AppearanceSettings appearance;
         
         // Performance settings
-        float espUpdateRate = 60.0f;            // ESP updates per second (30-360 FPS range)
+        ExtractionSettings extraction;          // Per-category update rates and threading
         
         // New setting for this feature
         bool autoSaveOnExit = true;
@@ -34,8 +35,35 @@ namespace kx {
     };
 
     NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(Settings::GuiSettings, uiScale, menuOpacity);
-    NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(Settings, settingsVersion, distance, scaling,
-                                       sizes, appearance, espUpdateRate, autoSaveOnExit, enableDebugLogging,
+    // WITH_DEFAULT: a key missing from an older settings file falls back to its default
+    // instead of failing the whole load
+    NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(Settings, settingsVersion, distance, scaling,
+                                       sizes, appearance, extraction, autoSaveOnExit, enableDebugLogging,
                                        logLevel, gui);
 
+    /**
+     * @brief Bring a settings file written by an older version up to CURRENT_SETTINGS_VERSION
+     *
+     * Version 1 had one ESP update rate for every entity; it becomes the player and NPC rates,
+     * the categories it mostly governed. The other categories keep their defaults.
+     *
+     * @param j The parsed settings file, upgraded in place
+     * @return The file's version after the upgrade; only CURRENT_SETTINGS_VERSION can be loaded
+     */
+    inline int UpgradeSettingsJson(nlohmann::json& j) {
+        int version = j.value("settingsVersion", 0);
+        if (version == 1) {
+            const auto rate = j.find("espUpdateRate");
+            if (rate != j.end() && rate->is_number()) {
+                nlohmann::json& extraction = j["extraction"];
+                extraction["playerRate"] = rate->get<float>();
+                extraction["npcRate"] = rate->get<float>();
+            }
+            j.erase("espUpdateRate");
+            version = 2;
+        }
+        j["settingsVersion"] = version;
+        return version;
+    }
+
 } // namespace kx
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../../../libs/nlohmann/json.hpp"
+
+namespace kx {
+
+    /**
+     * @brief Game Thread extraction tuning
+     *
+     * Extraction runs inside the game-thread detour, so the game's own tick waits
+     * for it. These settings trade CPU for a shorter stall.
+     */
+    struct ExtractionSettings {
+        // --- Per-Category Update Rates (extractions per second, 1 - 360) ---
+        // Categories that are not due on a tick keep their entities from the previous frame
+        float playerRate = 60.0f;               // Players move fast and are tracked closely
+        float npcRate = 60.0f;
+        float gadgetRate = 20.0f;               // Mostly static: waypoints, vistas, crafting stations
+        float attackTargetRate = 20.0f;
+        float itemRate = 10.0f;                 // Ground loot does not move
+
+        // --- Distance Level of Detail ---
+        bool distanceLod = true;                // Read mid/far entities in round-robin slices, keep stale values in between
+
+        // --- Time Budget ---
+        bool timeBudget = false;                // Cut each pass short at budgetMicros and resume the lists on the next tick
+        int budgetMicros = 2000;                // Game thread time per pass (MIN_BUDGET_MICROS - MAX_BUDGET_MICROS)
+
+        // --- Pipelined Traversal ---
+        int prefetchDistance = 4;               // Entities to look ahead while decoding (0 = off, up to MAX_PREFETCH_DISTANCE)
+
+        // --- Fork-Join Extraction ---
+        bool parallelExtraction = false;        // Split each pass across pre-spawned worker threads (opt-in)
+        int workerThreads = 2;                  // Extra threads besides the game thread (1 - MAX_WORKER_THREADS)
+
+        // --- Capture/Decode Split ---
+        bool backgroundDecode = false;          // Game thread only copies pages; entities are decoded on a background thread
+
+        static constexpr int MAX_WORKER_THREADS = 7;
+        static constexpr int MIN_BUDGET_MICROS = 250;
+        static constexpr int MAX_BUDGET_MICROS = 10000;
+        static constexpr int MAX_PREFETCH_DISTANCE = 32;
+    };
+
+    // Missing keys keep their defaults, so files written before a field existed still load
+    NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(ExtractionSettings, playerRate, npcRate, gadgetRate,
+        attackTargetRate, itemRate, distanceLod, timeBudget, budgetMicros, prefetchDistance, parallelExtraction, workerThreads, backgroundDecode);
+
+} // namespace kx
@@ -2,7 +2,8 @@
 
 namespace kx {
 
-    constexpr int CURRENT_SETTINGS_VERSION = 1;
+    // 2: the single espUpdateRate became per-category rates in ExtractionSettings
+    constexpr int CURRENT_SETTINGS_VERSION = 2;
 
     /**
      * @brief Display mode for player gear/equipment stats
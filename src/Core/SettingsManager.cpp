@@ -22,6 +22,11 @@ namespace kx {
         return path / "settings.json";
     }
 
+    std::filesystem::path SettingsManager::GetConfigDirectory() {
+        auto path = GetConfigFilePath();
+        return path.empty() ? path : path.parent_path();
+    }
+
     void SettingsManager::Save(const Settings& settings) {
         auto path = GetConfigFilePath();
         if (path.empty()) return;
@@ -64,11 +69,15 @@ namespace kx {
             nlohmann::json j;
             file >> j;
 
-            int fileVersion = j.value("settingsVersion", 0);
+            const int originalVersion = j.value("settingsVersion", 0);
+            int fileVersion = UpgradeSettingsJson(j);
             if (fileVersion != CURRENT_SETTINGS_VERSION) {
                 LOG_WARN("Settings file version mismatch (file: %d, current: %d). Using default settings.", fileVersion, CURRENT_SETTINGS_VERSION);
                 return;
             }
+            if (originalVersion != fileVersion) {
+                LOG_INFO("Settings file upgraded from version %d to %d", originalVersion, fileVersion);
+            }
 
             // Load core settings
             j.get_to(settings);
@@ -93,7 +102,7 @@ namespace kx {
             nlohmann::json j;
             file >> j;
 
-            int fileVersion = j.value("settingsVersion", 0);
+            int fileVersion = UpgradeSettingsJson(j);
             if (fileVersion != CURRENT_SETTINGS_VERSION) {
                 LOG_WARN("Settings file version mismatch, skipping feature settings load.");
                 return;
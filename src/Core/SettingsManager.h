@@ -15,6 +15,9 @@ namespace kx {
         // Loads feature-specific settings. Call this after features are registered.
         static void LoadFeatureSettings();
 
+        // Gets the kx-vision data directory (%APPDATA%\kx-vision). Empty if APPDATA is unavailable.
+        static std::filesystem::path GetConfigDirectory();
+
     private:
         // Gets the full path to the settings.json file.
         static std::filesystem::path GetConfigFilePath();
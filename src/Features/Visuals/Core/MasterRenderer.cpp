@@ -36,8 +36,8 @@ void MasterRenderer::Render(float screenWidth, float screenHeight, const MumbleL
     const uint64_t now = GetTickCount64();
     bool isInWvW = mumbleData && mumbleData->context.mapType == 18; // WvW map type
 
-    // Get globally extracted data from EntityManager
-    const FrameGameData& extractionData = entityManager.GetFrameData();
+    // Pin globally extracted data from EntityManager; the pools stay valid while the handle lives
+    const FrameDataHandle extractionData = entityManager.AcquireFrameData();
     CombatStateManager& combatStateManager = entityManager.GetCombatStateManager();
 
     FrameContext frameContext = {
@@ -52,7 +52,7 @@ void MasterRenderer::Render(float screenWidth, float screenHeight, const MumbleL
     };
 
     // Filter the global data for this frame
-    FilterAndProcessData(extractionData, frameContext, visualsConfig);
+    FilterAndProcessData(*extractionData, frameContext, visualsConfig);
 
     // Render the filtered data
     StageRenderer::RenderFrameData(frameContext, m_processedRenderData, visualsConfig);
@@ -13,6 +13,7 @@
 #include "../../../Game/Services/Combat/CombatConstants.h"
 #include "../Settings/VisualsSettings.h"
 #include "../../../../libs/ImGui/imgui.h"
+#include <format>
 #include <string_view>
 #include <vector>
 
@@ -127,18 +128,15 @@ std::string_view GetEntityName(const GameEntity& entity) {
 }
 
 
-void ProcessAndRender(const FrameContext& context, const GameEntity* entity, const VisualsConfiguration& visualsConfig) {
-    if (!entity) {
-        return;
-    }
-
+void ProcessAndRender(const FrameContext& context, const EntityColumns& columns, size_t slot, const VisualsConfiguration& visualsConfig) {
     VisualProperties visuals;
-    if (!Logic::StyleCalculator::Calculate(*entity, context, visualsConfig, visuals.style)) {
+    if (!Logic::StyleCalculator::Calculate(columns, slot, context, visualsConfig, visuals.style)) {
         return;
     }
 
     bool isOnScreen = Renderers::ScreenProjector::Project(
-        *entity,
+        columns,
+        slot,
         context.camera,
         context.screenWidth,
         context.screenHeight,
@@ -149,6 +147,9 @@ void ProcessAndRender(const FrameContext& context, const GameEntity* entity, con
         return;
     }
 
+    // Drawn entities are the only ones whose cold data is touched
+    const GameEntity* entity = columns.entity[slot];
+
     const EntityCombatState* combatState = context.stateManager.GetState(entity->GetCombatKey());
     
     bool showCombatUI = true;
@@ -250,24 +251,10 @@ void ProcessAndRender(const FrameContext& context, const GameEntity* entity, con
 } // namespace
 
 void StageRenderer::RenderFrameData(const FrameContext& context, const FrameGameData& frameData, const VisualsConfiguration& visualsConfig) {
-    for (const auto* player : frameData.players) {
-        ProcessAndRender(context, player, visualsConfig);
-    }
-
-    for (const auto* npc : frameData.npcs) {
-        ProcessAndRender(context, npc, visualsConfig);
-    }
-
-    for (const auto* gadget : frameData.gadgets) {
-        ProcessAndRender(context, gadget, visualsConfig);
-    }
-
-    for (const auto* target : frameData.attackTargets) {
-        ProcessAndRender(context, target, visualsConfig);
-    }
-
-    for (const auto* item : frameData.items) {
-        ProcessAndRender(context, item, visualsConfig);
+    // Slots are grouped by type in the same order the typed lists were drawn in
+    const EntityColumns& columns = frameData.columns;
+    for (size_t slot = 0; slot < columns.Size(); ++slot) {
+        ProcessAndRender(context, columns, slot, visualsConfig);
     }
 }
 
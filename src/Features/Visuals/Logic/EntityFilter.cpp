@@ -21,28 +21,65 @@ namespace { // Anonymous namespace for local helpers
     }
 
     /**
-     * @brief Performs common filtering logic applicable to all entity types.
-     * @return True if the entity passes common filters, false otherwise.
+     * @brief Filters the slots of one entity type, walking the hot columns linearly.
+     *
+     * The common distance check reads only the position column; passes(slot) runs the
+     * type-specific checks and is the only place that may touch the cold entity. Survivors
+     * are copied into the output columns and typed list, with their distances.
      */
-    bool PassesCommonFilters(
-        GameEntity* entity,
+    template <typename T, typename Passes>
+    void FilterRange(
+        const EntityColumns& in,
+        EntityTypes entityType,
         const glm::vec3& cameraPos,
         const glm::vec3& playerPos,
-        const FrameContext& context
+        const FrameContext& context,
+        EntityColumns& out,
+        std::vector<T*>& typedOut,
+        Passes&& passes
     ) {
-        if (!entity || !entity->isValid) {
-            return false;
-        }
+        const float activeLimit = context.settings.distance.GetActiveDistanceLimit(entityType, context.isInWvW);
+        const EntityColumns::SlotRange range = in.GetRange(entityType);
 
-        entity->visualDistance = glm::length(entity->position - cameraPos);
-        entity->gameplayDistance = glm::length(entity->position - playerPos);
+        out.BeginRange(entityType);
+        typedOut.reserve(range.end - range.begin);
+        for (uint32_t slot = range.begin; slot < range.end; ++slot) {
+            const float gameplayDistance = glm::length(in.position[slot] - playerPos);
+            if (activeLimit > 0.0f && gameplayDistance > activeLimit) {
+                continue;
+            }
+            if (!passes(slot)) {
+                continue;
+            }
 
-        float activeLimit = context.settings.distance.GetActiveDistanceLimit(entity->entityType, context.isInWvW);
-        if (activeLimit > 0.0f && entity->gameplayDistance > activeLimit) {
-            return false;
+            const float visualDistance = glm::length(in.position[slot] - cameraPos);
+            out.AppendFrom(in, slot, visualDistance, gameplayDistance);
+            typedOut.push_back(static_cast<T*>(in.entity[slot]));
         }
+    }
 
-        return true;
+    bool ShouldShowItemRarity(Game::ItemRarity rarity, const ObjectEspSettings& settings) {
+        switch (rarity) {
+            case Game::ItemRarity::Junk:
+                return settings.showItemJunk;
+            case Game::ItemRarity::Common:
+                return settings.showItemCommon;
+            case Game::ItemRarity::Fine:
+                return settings.showItemFine;
+            case Game::ItemRarity::Masterwork:
+                return settings.showItemMasterwork;
+            case Game::ItemRarity::Rare:
+                return settings.showItemRare;
+            case Game::ItemRarity::Exotic:
+                return settings.showItemExotic;
+            case Game::ItemRarity::Ascended:
+                return settings.showItemAscended;
+            case Game::ItemRarity::Legendary:
+                return settings.showItemLegendary;
+            case Game::ItemRarity::None:
+            default:
+                return true; // Show items with no rarity
+        }
     }
 
 } // anonymous namespace
@@ -53,147 +90,78 @@ void EntityFilter::FilterPooledData(const FrameGameData& extractedData, const Fr
     
     const glm::vec3 playerPos = context.camera.GetPlayerPosition();
     const glm::vec3 cameraPos = context.camera.GetCameraPosition();
+
+    const EntityColumns& in = extractedData.columns;
+    EntityColumns& out = filteredData.columns;
+    out.Reserve(in.Size());
     
     // Filter players
     if (visualsConfig.playerESP.enabled) {
-        filteredData.players.reserve(extractedData.players.size());
-        for (PlayerEntity* player : extractedData.players) {
-            // Call the common helper function first
-            if (!PassesCommonFilters(player, cameraPos, playerPos, context)) {
-                continue;
-            }
-            
-            // Now, perform player-specific filtering
-            if (player->isLocalPlayer && !visualsConfig.playerESP.showLocalPlayer) continue;
-            
-            if (player->currentHealth <= 0.0f && !IsDeathAnimationPlaying(player, context.stateManager, context.now)) {
-                continue;
-            }
-            
-            if (!Filtering::FilterSettings::ShouldRenderPlayer(player->attitude, visualsConfig.playerESP)) continue;
-            
-            filteredData.players.push_back(player);
-        }
+        FilterRange(in, EntityTypes::Player, cameraPos, playerPos, context, out, filteredData.players,
+            [&](uint32_t slot) {
+                const auto* player = static_cast<const PlayerEntity*>(in.entity[slot]);
+                if (player->isLocalPlayer && !visualsConfig.playerESP.showLocalPlayer) return false;
+
+                if (in.currentHealth[slot] <= 0.0f && !IsDeathAnimationPlaying(player, context.stateManager, context.now)) {
+                    return false;
+                }
+
+                return Filtering::FilterSettings::ShouldRenderPlayer(in.attitude[slot], visualsConfig.playerESP);
+            });
     }
     
     // Filter NPCs
     if (visualsConfig.npcESP.enabled) {
-        filteredData.npcs.reserve(extractedData.npcs.size());
-        for (NpcEntity* npc : extractedData.npcs) {
-            // Call the common helper function first
-            if (!PassesCommonFilters(npc, cameraPos, playerPos, context)) {
-                continue;
-            }
-            
-            // Now, perform NPC-specific filtering
-            if (npc->currentHealth <= 0.0f && !visualsConfig.npcESP.showDeadNpcs && !IsDeathAnimationPlaying(npc, context.stateManager, context.now)) {
-                continue;
-            }
-            
-            if (!Filtering::FilterSettings::ShouldRenderNpc(npc->attitude, npc->rank, visualsConfig.npcESP)) continue;
-            
-            filteredData.npcs.push_back(npc);
-        }
+        FilterRange(in, EntityTypes::NPC, cameraPos, playerPos, context, out, filteredData.npcs,
+            [&](uint32_t slot) {
+                const auto* npc = static_cast<const NpcEntity*>(in.entity[slot]);
+                if (in.currentHealth[slot] <= 0.0f && !visualsConfig.npcESP.showDeadNpcs && !IsDeathAnimationPlaying(npc, context.stateManager, context.now)) {
+                    return false;
+                }
+
+                return Filtering::FilterSettings::ShouldRenderNpc(in.attitude[slot], npc->rank, visualsConfig.npcESP);
+            });
     }
     
     // Filter gadgets
     if (visualsConfig.objectESP.enabled) {
-        filteredData.gadgets.reserve(extractedData.gadgets.size());
-        for (GadgetEntity* gadget : extractedData.gadgets) {
-            // Call the common helper function first
-            if (!PassesCommonFilters(gadget, cameraPos, playerPos, context)) {
-                continue;
-            }
+        FilterRange(in, EntityTypes::Gadget, cameraPos, playerPos, context, out, filteredData.gadgets,
+            [&](uint32_t slot) {
+                const auto* gadget = static_cast<const GadgetEntity*>(in.entity[slot]);
+                if (in.maxHealth[slot] > 0 && in.currentHealth[slot] <= 0.0f && !visualsConfig.objectESP.showDeadGadgets && !IsDeathAnimationPlaying(gadget, context.stateManager, context.now)) {
+                    return false;
+                }
 
-            // Now, perform gadget-specific filtering
-            if (gadget->maxHealth > 0 && gadget->currentHealth <= 0.0f && !visualsConfig.objectESP.showDeadGadgets && !IsDeathAnimationPlaying(gadget, context.stateManager, context.now)) {
-                continue;
-            }
+                if (visualsConfig.hideDepletedNodes && gadget->type == Game::GadgetType::ResourceNode && !gadget->isGatherable) {
+                    return false;
+                }
 
-            if (visualsConfig.hideDepletedNodes && gadget->type == Game::GadgetType::ResourceNode && !gadget->isGatherable) {
-                continue;
-            }
-            
-            if (!Filtering::FilterSettings::ShouldRenderGadget(gadget->type, visualsConfig.objectESP)) continue;
-            
-            // Note: Max height check is handled in context factory to disable box rendering only
-            // Entity is still rendered with other visualizations (circles, dots, details, etc.)
-            
-            filteredData.gadgets.push_back(gadget);
-        }
+                // Note: Max height check is handled in context factory to disable box rendering only
+                // Entity is still rendered with other visualizations (circles, dots, details, etc.)
+                return Filtering::FilterSettings::ShouldRenderGadget(gadget->type, visualsConfig.objectESP);
+            });
     }
     
     // Filter attack targets
     if (visualsConfig.objectESP.enabled && visualsConfig.objectESP.showAttackTargetList) {
-        filteredData.attackTargets.reserve(extractedData.attackTargets.size());
-        for (AttackTargetEntity* attackTarget : extractedData.attackTargets) {
-            // Call the common helper function first
-            if (!PassesCommonFilters(attackTarget, cameraPos, playerPos, context)) {
-                continue;
-            }
-
-            // Filter by combat state if enabled
-            if (visualsConfig.objectESP.showAttackTargetListOnlyInCombat) {
-                if (attackTarget->combatState != Game::AttackTargetCombatState::InCombat) {
-                    continue;
+        FilterRange(in, EntityTypes::AttackTarget, cameraPos, playerPos, context, out, filteredData.attackTargets,
+            [&](uint32_t slot) {
+                // Filter by combat state if enabled
+                if (visualsConfig.objectESP.showAttackTargetListOnlyInCombat) {
+                    const auto* attackTarget = static_cast<const AttackTargetEntity*>(in.entity[slot]);
+                    return attackTarget->combatState == Game::AttackTargetCombatState::InCombat;
                 }
-            }
-
-            // Note: Max height check is handled in context factory to disable box rendering only
-            // Entity is still rendered with other visualizations (circles, dots, details, etc.)
-            
-            filteredData.attackTargets.push_back(attackTarget);
-        }
+                return true;
+            });
     }
     
     // Filter items
     if (visualsConfig.objectESP.enabled && visualsConfig.objectESP.showItems) {
-        filteredData.items.reserve(extractedData.items.size());
-        for (ItemEntity* item : extractedData.items) {
-            // Call the common helper function first
-            if (!PassesCommonFilters(item, cameraPos, playerPos, context)) {
-                continue;
-            }
-            
-            // Filter by rarity
-            bool shouldShow = false;
-            switch (item->rarity) {
-                case Game::ItemRarity::Junk:
-                    shouldShow = visualsConfig.objectESP.showItemJunk;
-                    break;
-                case Game::ItemRarity::Common:
-                    shouldShow = visualsConfig.objectESP.showItemCommon;
-                    break;
-                case Game::ItemRarity::Fine:
-                    shouldShow = visualsConfig.objectESP.showItemFine;
-                    break;
-                case Game::ItemRarity::Masterwork:
-                    shouldShow = visualsConfig.objectESP.showItemMasterwork;
-                    break;
-                case Game::ItemRarity::Rare:
-                    shouldShow = visualsConfig.objectESP.showItemRare;
-                    break;
-                case Game::ItemRarity::Exotic:
-                    shouldShow = visualsConfig.objectESP.showItemExotic;
-                    break;
-                case Game::ItemRarity::Ascended:
-                    shouldShow = visualsConfig.objectESP.showItemAscended;
-                    break;
-                case Game::ItemRarity::Legendary:
-                    shouldShow = visualsConfig.objectESP.showItemLegendary;
-                    break;
-                case Game::ItemRarity::None:
-                default:
-                    shouldShow = true; // Show items with no rarity
-                    break;
-            }
-            
-            if (!shouldShow) {
-                continue;
-            }
-            
-            filteredData.items.push_back(item);
-        }
+        FilterRange(in, EntityTypes::Item, cameraPos, playerPos, context, out, filteredData.items,
+            [&](uint32_t slot) {
+                const auto* item = static_cast<const ItemEntity*>(in.entity[slot]);
+                return ShouldShowItemRarity(item->rarity, visualsConfig.objectESP);
+            });
     }
 }
 
@@ -4,6 +4,7 @@
 #include "../../../Core/AppState.h"
 #include "../../../Game/Data/EntityData.h"
 #include "../Renderers/ShapeRenderer.h"
+#include "../../../Rendering/Shared/ColorConstants.h"
 #include "../../../Rendering/Shared/RenderSettingsHelper.h"
 #include "../../../Rendering/Shared/ScalingConstants.h"
 #include "../Presentation/Styling.h"
@@ -13,37 +14,66 @@
 
 namespace kx::Logic {
 
-bool StyleCalculator::Calculate(const GameEntity& entity,
+bool StyleCalculator::Calculate(const EntityColumns& columns,
+                                 size_t slot,
                                  const FrameContext& context,
                                  const VisualsConfiguration& visualsConfig,
                                  VisualStyle& outStyle) {
-    float activeLimit = context.settings.distance.GetActiveDistanceLimit(entity.entityType, context.isInWvW);
+    const EntityTypes entityType = columns.type[slot];
+    const float gameplayDistance = columns.gameplayDistance[slot];
+    outStyle.gameplayDistance = gameplayDistance;
+
+    float activeLimit = context.settings.distance.GetActiveDistanceLimit(entityType, context.isInWvW);
     bool useLimitMode = activeLimit > 0.0f;
-    outStyle.distanceFadeAlpha = CalculateDistanceFadeAlpha(entity.gameplayDistance, useLimitMode, activeLimit);
+    outStyle.distanceFadeAlpha = CalculateDistanceFadeAlpha(gameplayDistance, useLimitMode, activeLimit);
 
     if (outStyle.distanceFadeAlpha <= 0.0f) {
         return false;
     }
 
-    unsigned int color = Styling::GetEntityColor(entity);
+    unsigned int color = GetSlotColor(columns, slot);
 
     outStyle.fadedEntityColor = ShapeRenderer::ApplyAlphaToColor(color, outStyle.distanceFadeAlpha);
 
-    outStyle.scale = CalculateEntityScale(entity.visualDistance, entity.entityType, context);
+    outStyle.scale = CalculateEntityScale(columns.visualDistance[slot], entityType, context);
 
     float normalizedDistance = 0.0f;
-    outStyle.finalAlpha = CalculateAdaptiveAlpha(entity.gameplayDistance, outStyle.distanceFadeAlpha,
-                                             useLimitMode, entity.entityType,
+    outStyle.finalAlpha = CalculateAdaptiveAlpha(gameplayDistance, outStyle.distanceFadeAlpha,
+                                             useLimitMode, entityType,
                                              normalizedDistance);
+    if (columns.staleMs[slot] > 0) {
+        outStyle.finalAlpha *= CalculateStaleAlpha(columns.staleMs[slot]);
+    }
 
     outStyle.fadedEntityColor = ShapeRenderer::ApplyAlphaToColor(outStyle.fadedEntityColor, outStyle.finalAlpha);
 
-    EntityMultipliers multipliers = CalculateEntityMultipliers(entity, visualsConfig);
+    EntityMultipliers multipliers = CalculateEntityMultipliers(columns, slot, visualsConfig);
     CalculateFinalSizes(outStyle, outStyle.scale, multipliers);
 
     return true;
 }
 
+unsigned int StyleCalculator::GetSlotColor(const EntityColumns& columns, size_t slot) {
+    switch (columns.type[slot]) {
+        case EntityTypes::Player:
+        case EntityTypes::NPC:
+            return Styling::GetAttitudeColor(columns.attitude[slot]);
+        case EntityTypes::Item:
+            return Styling::GetEntityColor(*columns.entity[slot]); // Rarity lives in the cold entity
+        default:
+            return ESPColors::GADGET;
+    }
+}
+
+float StyleCalculator::CalculateStaleAlpha(uint32_t staleMs) {
+    if (staleMs <= StaleFade::FADE_START_MS) {
+        return 1.0f;
+    }
+    const float t = (std::min)(1.0f, static_cast<float>(staleMs - StaleFade::FADE_START_MS) /
+        static_cast<float>(StaleFade::FADE_END_MS - StaleFade::FADE_START_MS));
+    return 1.0f - t * (1.0f - StaleFade::MIN_ALPHA);
+}
+
 float StyleCalculator::CalculateEntityScale(float visualDistance, EntityTypes entityType, const FrameContext& context) {
     const auto& settings = context.settings;
     
@@ -145,23 +175,21 @@ float StyleCalculator::CalculateDistanceFadeAlpha(float distance, bool useDistan
     }
 }
 
-StyleCalculator::EntityMultipliers StyleCalculator::CalculateEntityMultipliers(const GameEntity& entity, const VisualsConfiguration& visualsConfig) {
+StyleCalculator::EntityMultipliers StyleCalculator::CalculateEntityMultipliers(const EntityColumns& columns, size_t slot, const VisualsConfiguration& visualsConfig) {
     EntityMultipliers multipliers;
+    const EntityTypes entityType = columns.type[slot];
     
-    if (entity.entityType == EntityTypes::Player) {
-        const auto* player = static_cast<const PlayerEntity*>(&entity);
-        if (player->attitude == Game::Attitude::Hostile) {
-            multipliers.hostile = visualsConfig.playerESP.hostileBoostMultiplier;
-        }
+    if (entityType == EntityTypes::Player && columns.attitude[slot] == Game::Attitude::Hostile) {
+        multipliers.hostile = visualsConfig.playerESP.hostileBoostMultiplier;
     }
     
-    if (entity.entityType == EntityTypes::NPC) {
-        const auto* npc = static_cast<const NpcEntity*>(&entity);
+    if (entityType == EntityTypes::NPC) {
+        const auto* npc = static_cast<const NpcEntity*>(columns.entity[slot]);
         multipliers.rank = Styling::GetRankMultiplier(npc->rank);
     }
     
-    if (RenderSettingsHelper::IsObjectType(entity.entityType)) {
-        multipliers.gadgetHealth = Styling::GetGadgetHealthMultiplier(entity.maxHealth);
+    if (RenderSettingsHelper::IsObjectType(entityType)) {
+        multipliers.gadgetHealth = Styling::GetGadgetHealthMultiplier(columns.maxHealth[slot]);
     }
     
     multipliers.healthBar = multipliers.hostile * multipliers.rank * multipliers.gadgetHealth;
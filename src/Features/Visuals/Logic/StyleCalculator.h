@@ -25,14 +25,17 @@ class StyleCalculator {
 public:
     /**
      * @brief Calculates abstract visual properties (Color, Alpha, Sizes).
-     * @param entity The entity to process
+     * Reads the hot columns of the slot; only items and NPCs touch the cold entity (rarity, rank).
+     * @param columns Filtered frame columns (distances must be filled)
+     * @param slot Slot of the entity to process
      * @param context Frame context containing settings and game state
      * @param visualsConfig Visual configuration settings
      * @param outStyle Output parameter for the calculated visual style
      * @return true if entity should be rendered, false if fully transparent (distanceFadeAlpha <= 0)
      */
     static bool Calculate(
-        const GameEntity& entity, 
+        const EntityColumns& columns,
+        size_t slot,
         const FrameContext& context,
         const VisualsConfiguration& visualsConfig,
         VisualStyle& outStyle
@@ -43,6 +46,7 @@ private:
     static float CalculateAdaptiveAlpha(float gameplayDistance, float distanceFadeAlpha,
                                        bool useDistanceLimit, EntityTypes entityType,
                                        float& outNormalizedDistance);
+    static float CalculateStaleAlpha(uint32_t staleMs);
     static float CalculateFinalSize(float baseSize, float scale, float minLimit, float maxLimit, float multiplier = 1.0f);
     static float CalculateDistanceFadeAlpha(float distance, bool useDistanceLimit, float distanceLimit);
     
@@ -53,7 +57,8 @@ private:
         float healthBar = 1.0f;
     };
     
-    static EntityMultipliers CalculateEntityMultipliers(const GameEntity& entity, const VisualsConfiguration& visualsConfig);
+    static unsigned int GetSlotColor(const EntityColumns& columns, size_t slot);
+    static EntityMultipliers CalculateEntityMultipliers(const EntityColumns& columns, size_t slot, const VisualsConfiguration& visualsConfig);
     static void CalculateFinalSizes(VisualStyle& style, 
                                    float scale,
                                    const EntityMultipliers& multipliers);
@@ -58,28 +58,22 @@ namespace kx::Styling {
         }
     }
 
+    ImU32 GetAttitudeColor(Game::Attitude attitude) {
+        switch (attitude) {
+            case Game::Attitude::Hostile:     return ESPColors::NPC_HOSTILE;
+            case Game::Attitude::Friendly:    return ESPColors::NPC_FRIENDLY;
+            case Game::Attitude::Neutral:     return ESPColors::NPC_NEUTRAL;
+            case Game::Attitude::Indifferent: return ESPColors::NPC_INDIFFERENT;
+            default:                          return ESPColors::NPC_UNKNOWN;
+        }
+    }
+
     ImU32 GetEntityColor(const GameEntity& entity) {
         switch (entity.entityType) {
-            case EntityTypes::Player: {
-                const auto* p = static_cast<const PlayerEntity*>(&entity);
-                switch (p->attitude) {
-                    case Game::Attitude::Hostile:     return ESPColors::NPC_HOSTILE;
-                    case Game::Attitude::Friendly:    return ESPColors::NPC_FRIENDLY;
-                    case Game::Attitude::Neutral:     return ESPColors::NPC_NEUTRAL;
-                    case Game::Attitude::Indifferent: return ESPColors::NPC_INDIFFERENT;
-                    default:                          return ESPColors::NPC_UNKNOWN;
-                }
-            }
-            case EntityTypes::NPC: {
-                const auto* n = static_cast<const NpcEntity*>(&entity);
-                 switch (n->attitude) {
-                    case Game::Attitude::Hostile:     return ESPColors::NPC_HOSTILE;
-                    case Game::Attitude::Friendly:    return ESPColors::NPC_FRIENDLY;
-                    case Game::Attitude::Neutral:     return ESPColors::NPC_NEUTRAL;
-                    case Game::Attitude::Indifferent: return ESPColors::NPC_INDIFFERENT;
-                    default:                          return ESPColors::NPC_UNKNOWN;
-                }
-            }
+            case EntityTypes::Player:
+                return GetAttitudeColor(static_cast<const PlayerEntity&>(entity).attitude);
+            case EntityTypes::NPC:
+                return GetAttitudeColor(static_cast<const NpcEntity&>(entity).attitude);
             case EntityTypes::Gadget:
                 return ESPColors::GADGET;
             case EntityTypes::AttackTarget:
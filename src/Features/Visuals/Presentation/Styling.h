@@ -16,6 +16,7 @@ namespace kx::Styling {
     ImU32 GetTacticalColor(data::ApiAttribute attribute);
     bool ShouldHideCombatUIForGadget(Game::GadgetType type);
     
+    ImU32 GetAttitudeColor(Game::Attitude attitude);
     ImU32 GetEntityColor(const GameEntity& entity);
 
     float GetRankMultiplier(Game::CharacterRank rank);
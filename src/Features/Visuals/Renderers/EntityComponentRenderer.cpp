@@ -86,7 +86,7 @@ void EntityComponentRenderer::RenderGeometry(const FrameContext& ctx, const Game
             ShapeRenderer::RenderGyroscopicOverlay(
                 ctx.drawList, 
                 entity.position,          
-                entity.gameplayDistance,  
+                props.style.gameplayDistance,
                 ctx.camera, 
                 ctx.screenWidth, 
                 ctx.screenHeight, 
@@ -142,7 +142,7 @@ void EntityComponentRenderer::RenderIdentity(const FrameContext& ctx,
 
     std::string_view distanceText;
     if (showDistance) {
-        size_t len = FormatDistance(distanceBuffer, sizeof(distanceBuffer), entity.gameplayDistance, ctx.settings);
+        size_t len = FormatDistance(distanceBuffer, sizeof(distanceBuffer), props.style.gameplayDistance, ctx.settings);
         distanceText = std::string_view(distanceBuffer, len);
     }
 
@@ -14,21 +14,21 @@
 namespace kx::Renderers {
 
 bool ScreenProjector::Project(
-    const GameEntity& entity,
+    const EntityColumns& columns,
+    size_t slot,
     const Camera& camera,
     float screenW,
     float screenH,
     const VisualStyle& style,
     ScreenGeometry& outGeometry) {
     
-    // Calculate world bounds - prefer physics dimensions if available
-    float worldWidth, worldDepth, worldHeight;
-    if (entity.hasPhysicsDimensions) {
-        worldWidth = entity.physicsWidth;
-        worldDepth = entity.physicsDepth;
-        worldHeight = entity.physicsHeight;
-    } else {
-        GetWorldBoundsForEntity(entity.entityType, worldWidth, worldDepth, worldHeight);
+    const glm::vec3& position = columns.position[slot];
+    const EntityTypes entityType = columns.type[slot];
+
+    // World bounds - prefer physics dimensions if available (a zero size means none)
+    glm::vec3 worldSize = columns.physicsSize[slot];
+    if (worldSize == glm::vec3(0.0f)) {
+        GetWorldBoundsForEntity(entityType, worldSize.x, worldSize.y, worldSize.z);
     }
     
     // OPTIMIZED: Calculate clip position ONCE
@@ -37,7 +37,7 @@ bool ScreenProjector::Project(
     const glm::mat4& proj = camera.GetProjectionMatrix();
     
     // Perform the heavy math one time
-    glm::vec4 clipPos = proj * view * glm::vec4(entity.position, 1.0f);
+    glm::vec4 clipPos = proj * view * glm::vec4(position, 1.0f);
     
     // Early culling: Check if entity is far behind camera before expensive 8-corner projection
     // w < -2.0f allows objects slightly behind camera to still process (prevents popping)
@@ -64,10 +64,10 @@ bool ScreenProjector::Project(
     }
     
     // Project based on entity type
-    if (RenderSettingsHelper::IsObjectType(entity.entityType)) {
-        ProjectGadget(entity, camera, screenW, screenH, outGeometry, style.scale, isOriginValid);
+    if (RenderSettingsHelper::IsObjectType(entityType)) {
+        ProjectGadget(position, entityType, worldSize, camera, screenW, screenH, outGeometry, style.scale, isOriginValid);
     } else {
-        ProjectCharacter(entity, camera, screenW, screenH, outGeometry, style.scale, isOriginValid);
+        ProjectCharacter(position, entityType, worldSize, camera, screenW, screenH, outGeometry, style.scale, isOriginValid);
     }
     
     // Perform frustum culling check
@@ -195,18 +195,20 @@ void ScreenProjector::CalculateEntityBoxDimensions(EntityTypes entityType, float
 }
 
 void ScreenProjector::ApplyFallback2DBox(
-    const GameEntity& entity,
+    EntityTypes entityType,
     ScreenGeometry& geometry,
     float scale,
     const glm::vec2& screenPos) {
     float boxWidth, boxHeight;
-    CalculateEntityBoxDimensions(entity.entityType, scale, boxWidth, boxHeight);
+    CalculateEntityBoxDimensions(entityType, scale, boxWidth, boxHeight);
     geometry.boxMin = ImVec2(screenPos.x - boxWidth / 2, screenPos.y - boxHeight);
     geometry.boxMax = ImVec2(screenPos.x + boxWidth / 2, screenPos.y);
 }
 
 void ScreenProjector::ProjectGadget(
-    const GameEntity& entity,
+    const glm::vec3& position,
+    EntityTypes entityType,
+    const glm::vec3& worldSize,
     const Camera& camera,
     float screenWidth,
     float screenHeight,
@@ -220,21 +222,12 @@ void ScreenProjector::ProjectGadget(
 
     geometry.center = ImVec2(geometry.screenPos.x, geometry.screenPos.y);
     
-    float worldWidth, worldDepth, worldHeight;
-    if (entity.hasPhysicsDimensions) {
-        worldWidth = entity.physicsWidth;
-        worldDepth = entity.physicsDepth;
-        worldHeight = entity.physicsHeight;
-    } else {
-        GetWorldBoundsForEntity(entity.entityType, worldWidth, worldDepth, worldHeight);
-    }
-    
     bool boxValid = false;
     Calculate3DBoundingBox(
-        entity.position,
-        worldWidth,
-        worldDepth,
-        worldHeight,
+        position,
+        worldSize.x,
+        worldSize.y,
+        worldSize.z,
         camera,
         screenWidth,
         screenHeight,
@@ -251,29 +244,21 @@ void ScreenProjector::ProjectGadget(
 }
 
 void ScreenProjector::ProjectCharacter(
-    const GameEntity& entity,
+    const glm::vec3& position,
+    EntityTypes entityType,
+    const glm::vec3& worldSize,
     const Camera& camera,
     float screenWidth,
     float screenHeight,
     ScreenGeometry& geometry,
     float scale,
     bool isOriginValid) {
-    float worldWidth, worldDepth, worldHeight;
-    
-    if (entity.hasPhysicsDimensions) {
-        worldWidth = entity.physicsWidth;
-        worldDepth = entity.physicsDepth;
-        worldHeight = entity.physicsHeight;
-    } else {
-        GetWorldBoundsForEntity(entity.entityType, worldWidth, worldDepth, worldHeight);
-    }
-    
     bool boxValid = false;
     Calculate3DBoundingBox(
-        entity.position,
-        worldWidth,
-        worldDepth,
-        worldHeight,
+        position,
+        worldSize.x,
+        worldSize.y,
+        worldSize.z,
         camera,
         screenWidth,
         screenHeight,
@@ -283,7 +268,7 @@ void ScreenProjector::ProjectCharacter(
     
     if (!boxValid) {
         if (isOriginValid) {
-            ApplyFallback2DBox(entity, geometry, scale, geometry.screenPos);
+            ApplyFallback2DBox(entityType, geometry, scale, geometry.screenPos);
         }
     }
     
@@ -24,8 +24,9 @@ class ScreenProjector {
 public:
     /**
      * @brief Projects 3D entity to 2D screen space.
-     * Populates the 'geometry' field of VisualProperties.
-     * @param entity The entity to project
+     * Populates the 'geometry' field of VisualProperties from the hot columns of the slot.
+     * @param columns Frame columns (position, type, physics size)
+     * @param slot Slot of the entity to project
      * @param camera Camera for projection
      * @param screenW Screen width in pixels
      * @param screenH Screen height in pixels
@@ -34,7 +35,8 @@ public:
      * @return true if entity is effectively on screen, false if behind camera/culled
      */
     static bool Project(
-        const GameEntity& entity,
+        const EntityColumns& columns,
+        size_t slot,
         const Camera& camera,
         float screenW,
         float screenH,
@@ -61,7 +63,7 @@ private:
         float& outHeight);
 
     static void ApplyFallback2DBox(
-        const GameEntity& entity,
+        EntityTypes entityType,
         ScreenGeometry& geometry,
         float scale,
         const glm::vec2& screenPos);
@@ -70,7 +72,9 @@ private:
                                             float& outBoxWidth, float& outBoxHeight);
 
     static void ProjectGadget(
-        const GameEntity& entity,
+        const glm::vec3& position,
+        EntityTypes entityType,
+        const glm::vec3& worldSize,
         const Camera& camera,
         float screenWidth,
         float screenHeight,
@@ -79,7 +83,9 @@ private:
         bool isOriginValid);
 
     static void ProjectCharacter(
-        const GameEntity& entity,
+        const glm::vec3& position,
+        EntityTypes entityType,
+        const glm::vec3& worldSize,
         const Camera& camera,
         float screenWidth,
         float screenHeight,
@@ -36,6 +36,20 @@ void VisualsFeature::Update(float deltaTime, const FrameGameData& frameData, con
     }
 }
 
+ExtractionCategoryMask VisualsFeature::GetConsumedCategories() const {
+    // Mirrors the category toggles of EntityFilter. Gadgets also feed the adaptive far plane,
+    // which only object rendering uses.
+    ExtractionCategoryMask consumed = 0;
+    if (m_settings.playerESP.enabled) consumed |= CategoryBit(ExtractionCategory::Players);
+    if (m_settings.npcESP.enabled) consumed |= CategoryBit(ExtractionCategory::Npcs);
+    if (m_settings.objectESP.enabled) {
+        consumed |= CategoryBit(ExtractionCategory::Gadgets);
+        if (m_settings.objectESP.showAttackTargetList) consumed |= CategoryBit(ExtractionCategory::AttackTargets);
+        if (m_settings.objectESP.showItems) consumed |= CategoryBit(ExtractionCategory::Items);
+    }
+    return consumed;
+}
+
 void VisualsFeature::RenderDrawList(ImDrawList* drawList, const ServiceContext& ctx) {
     if (!m_masterRenderer || !m_camera || !m_entityManager) {
         return;
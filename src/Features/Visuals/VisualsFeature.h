@@ -28,6 +28,7 @@ public:
     void RenderDrawList(ImDrawList* drawList, const ServiceContext& ctx) override;
     void OnMenuRender() override;
     const char* GetName() const override { return "Visuals"; }
+    ExtractionCategoryMask GetConsumedCategories() const override;
     
     void LoadSettings(const nlohmann::json& j) override;
     void SaveSettings(nlohmann::json& j) override;
@@ -6,14 +6,13 @@
 #include "../../GameEnums.h"
 #include "../../Havok/HavokEnums.h"
 #include "../EntityTypes.h"
+#include "../EntityHandle.h"
 #include "../../../Game/Services/Combat/CombatStateKey.h"
 
 namespace kx {
 
 struct GameEntity {
     glm::vec3 position;
-    float visualDistance;
-    float gameplayDistance;
     bool isValid;
     const void* address; // The base address of the ChCli/GdCli wrapper
     void* agent; // The raw Gw2::Agent pointer used by game services
@@ -23,6 +22,7 @@ struct GameEntity {
     EntityTypes entityType;
     Game::AgentType agentType;
     int32_t agentId;
+    uint32_t generation = 0; // Generation of agentId's slot (see AgentSlotTable); 0 if not indexed
     
     float physicsWidth = 0.0f;
     float physicsDepth = 0.0f;
@@ -30,7 +30,12 @@ struct GameEntity {
     bool hasPhysicsDimensions = false;
     Havok::HkcdShapeType shapeType = Havok::HkcdShapeType::INVALID;
 
-    GameEntity() : position(0.0f), visualDistance(0.0f), gameplayDistance(0.0f),
+    // Distance LOD: a stale entity was not read this pass and keeps the values of its last read
+    uint64_t refreshedAt = 0;  // Extraction time (ms) of the last read from game memory
+    uint32_t staleMs = 0;      // Age of the values when the frame was extracted (0 unless stale)
+    bool isStale = false;
+
+    GameEntity() : position(0.0f),
                          isValid(false), address(nullptr), agent(nullptr), currentHealth(0.0f), maxHealth(0.0f), currentBarrier(0.0f),
                          entityType(EntityTypes::Gadget), agentType(Game::AgentType::Error), agentId(0),
                          shapeType(Havok::HkcdShapeType::INVALID)
@@ -40,6 +45,10 @@ struct GameEntity {
     CombatStateKey GetCombatKey() const {
         return CombatStateKey(static_cast<uint32_t>(agentId), address);
     }
+
+    EntityHandle GetHandle() const {
+        return generation != 0 ? EntityHandle{ static_cast<uint32_t>(agentId), generation } : EntityHandle{};
+    }
 };
 
 } // namespace kx
@@ -0,0 +1,99 @@
+#include "EntityColumns.h"
+#include "EntityData.h"
+#include "FrameData.h"
+
+namespace kx {
+
+    namespace {
+
+        template <typename T>
+        Game::Attitude AttitudeOf(const T&) {
+            return Game::Attitude::Neutral;
+        }
+
+        Game::Attitude AttitudeOf(const PlayerEntity& player) { return player.attitude; }
+        Game::Attitude AttitudeOf(const NpcEntity& npc) { return npc.attitude; }
+
+    } // namespace
+
+    void EntityColumns::Build(const FrameGameData& frame) {
+        Clear();
+        Reserve(frame.players.size() + frame.npcs.size() + frame.gadgets.size() +
+            frame.attackTargets.size() + frame.items.size());
+
+        auto appendAll = [this](EntityTypes entityType, const auto& entities) {
+            BeginRange(entityType);
+            for (auto* entry : entities) {
+                if (entry->isValid) {
+                    Append(*entry, AttitudeOf(*entry));
+                }
+            }
+        };
+        appendAll(EntityTypes::Player, frame.players);
+        appendAll(EntityTypes::NPC, frame.npcs);
+        appendAll(EntityTypes::Gadget, frame.gadgets);
+        appendAll(EntityTypes::AttackTarget, frame.attackTargets);
+        appendAll(EntityTypes::Item, frame.items);
+    }
+
+    void EntityColumns::BeginRange(EntityTypes entityType) {
+        const uint32_t slot = static_cast<uint32_t>(Size());
+        ranges[static_cast<size_t>(entityType)] = { slot, slot };
+    }
+
+    void EntityColumns::Append(GameEntity& entry, Game::Attitude entryAttitude) {
+        position.push_back(entry.position);
+        currentHealth.push_back(entry.currentHealth);
+        maxHealth.push_back(entry.maxHealth);
+        type.push_back(entry.entityType);
+        attitude.push_back(entryAttitude);
+        physicsSize.push_back(entry.hasPhysicsDimensions
+            ? glm::vec3(entry.physicsWidth, entry.physicsDepth, entry.physicsHeight)
+            : glm::vec3(0.0f));
+        staleMs.push_back(entry.isStale ? entry.staleMs : 0);
+        entity.push_back(&entry);
+        ranges[static_cast<size_t>(entry.entityType)].end = static_cast<uint32_t>(Size());
+    }
+
+    void EntityColumns::AppendFrom(const EntityColumns& source, uint32_t slot, float visual, float gameplay) {
+        position.push_back(source.position[slot]);
+        currentHealth.push_back(source.currentHealth[slot]);
+        maxHealth.push_back(source.maxHealth[slot]);
+        type.push_back(source.type[slot]);
+        attitude.push_back(source.attitude[slot]);
+        physicsSize.push_back(source.physicsSize[slot]);
+        staleMs.push_back(source.staleMs[slot]);
+        visualDistance.push_back(visual);
+        gameplayDistance.push_back(gameplay);
+        entity.push_back(source.entity[slot]);
+        ranges[static_cast<size_t>(source.type[slot])].end = static_cast<uint32_t>(Size());
+    }
+
+    void EntityColumns::Reserve(size_t count) {
+        position.reserve(count);
+        currentHealth.reserve(count);
+        maxHealth.reserve(count);
+        type.reserve(count);
+        attitude.reserve(count);
+        physicsSize.reserve(count);
+        staleMs.reserve(count);
+        visualDistance.reserve(count);
+        gameplayDistance.reserve(count);
+        entity.reserve(count);
+    }
+
+    void EntityColumns::Clear() {
+        position.clear();
+        currentHealth.clear();
+        maxHealth.clear();
+        type.clear();
+        attitude.clear();
+        physicsSize.clear();
+        staleMs.clear();
+        visualDistance.clear();
+        gameplayDistance.clear();
+        entity.clear();
+        ranges.fill(SlotRange{});
+    }
+
+} // namespace kx
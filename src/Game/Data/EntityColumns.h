@@ -0,0 +1,83 @@
+#pragma once
+
+#include "glm.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../GameEnums.h"
+#include "EntityTypes.h"
+
+namespace kx {
+
+    struct GameEntity;
+    struct FrameGameData;
+
+    constexpr size_t ENTITY_TYPE_COUNT = static_cast<size_t>(EntityTypes::Item) + 1;
+
+    /**
+     * @brief Struct-of-arrays view of a frame's entities for the per-frame render loops
+     *
+     * Slot i of every column describes the same entity. The hot columns hold what the
+     * filter, style and projection passes read for every entity on every frame, so those
+     * loops walk contiguous arrays instead of chasing entity pointers through fat objects.
+     * The cold column points at the pooled entity (names, gear, details); it is only
+     * dereferenced for type-specific filters and for entities that are drawn.
+     *
+     * Slots are grouped by entity type in EntityTypes order; GetRange() gives each group.
+     */
+    struct EntityColumns {
+        struct SlotRange {
+            uint32_t begin = 0;
+            uint32_t end = 0;
+        };
+
+        // --- Hot ---
+        std::vector<glm::vec3> position;
+        std::vector<float> currentHealth;
+        std::vector<float> maxHealth;
+        std::vector<EntityTypes> type;
+        std::vector<Game::Attitude> attitude;      // Players and NPCs; Neutral for everything else
+        std::vector<glm::vec3> physicsSize;        // Width, depth, height; zero without physics dimensions
+        std::vector<uint32_t> staleMs;             // Age of stale values, 0 for entities read this pass
+
+        // Measured by the render-side filter; empty in extracted frames
+        std::vector<float> visualDistance;
+        std::vector<float> gameplayDistance;
+
+        // --- Cold ---
+        std::vector<GameEntity*> entity;
+
+        std::array<SlotRange, ENTITY_TYPE_COUNT> ranges{};
+
+        [[nodiscard]] size_t Size() const { return entity.size(); }
+
+        [[nodiscard]] SlotRange GetRange(EntityTypes entityType) const {
+            return ranges[static_cast<size_t>(entityType)];
+        }
+
+        /**
+         * @brief Rebuild every column from the typed entity lists of a frame (extraction side)
+         */
+        void Build(const FrameGameData& frame);
+
+        /**
+         * @brief Open the slot group of a type; appends until the next BeginRange() belong to it
+         * Groups must be opened in EntityTypes order.
+         */
+        void BeginRange(EntityTypes entityType);
+
+        /**
+         * @brief Copy one slot of another frame's columns, with the distances measured for it
+         */
+        void AppendFrom(const EntityColumns& source, uint32_t slot, float visual, float gameplay);
+
+        void Reserve(size_t count);
+        void Clear();
+
+    private:
+        void Append(GameEntity& entry, Game::Attitude entryAttitude);
+    };
+
+} // namespace kx
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include "EntityTypes.h"
+
+namespace kx {
+
+enum class EntityEventKind : uint8_t {
+    Spawned,    // Not in the previous frame
+    Despawned,  // Gone from this frame; address and type are the last ones seen
+    Respawned   // Same agentId under a different address or entity type
+};
+
+/**
+ * @brief One change in the set of extracted entities between two published frames
+ *
+ * Entities are identified like CombatStateKey: by agentId, or by address when the agentId is 0.
+ */
+struct EntityEvent {
+    EntityEventKind kind = EntityEventKind::Spawned;
+    EntityTypes entityType = EntityTypes::Player;
+    uint32_t agentId = 0;
+    const void* address = nullptr;
+    const void* previousAddress = nullptr; // Respawned only
+};
+
+} // namespace kx
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kx {
+
+/**
+ * @brief Generational reference to an agent that can be held across frames
+ *
+ * The generation is bumped whenever the agentId starts describing a different entity
+ * (despawn and respawn, or reuse by another wrapper), so a handle kept past its
+ * entity's lifetime resolves to nothing instead of to the newcomer.
+ * See AgentSlotTable and FrameGameData::GetByHandle().
+ */
+struct EntityHandle {
+    uint32_t agentId = 0;
+    uint32_t generation = 0; // 0 = null handle
+
+    [[nodiscard]] bool IsValid() const { return generation != 0; }
+
+    bool operator==(const EntityHandle& other) const = default;
+};
+
+} // namespace kx
@@ -6,6 +6,9 @@
 #include <ankerl/unordered_dense.h>
 
 #include "../../libs/ImGui/imgui.h" // For ImU32, ImVec2
+#include "EntityColumns.h"
+#include "EntityEvent.h"
+#include "EntityHandle.h"
 
 // Forward declarations
 struct ImDrawList;
@@ -30,6 +33,7 @@ namespace kx {
  * based on game state and settings. These are stable and don't depend on camera.
  */
 struct VisualStyle {
+    float gameplayDistance;        // Distance from the player (filtered columns)
     float scale;                   // Distance-based scale factor
     float distanceFadeAlpha;       // Raw distance fade (for logic culling)
     float finalAlpha;              // Final visible alpha
@@ -43,7 +47,7 @@ struct VisualStyle {
     float finalHealthBarHeight;
 
     VisualStyle()
-        : scale(0.0f), distanceFadeAlpha(0.0f), finalAlpha(0.0f),
+        : gameplayDistance(0.0f), scale(0.0f), distanceFadeAlpha(0.0f), finalAlpha(0.0f),
           fadedEntityColor(0),
           finalFontSize(0.0f), finalBoxThickness(0.0f), finalDotRadius(0.0f),
           finalHealthBarWidth(0.0f), finalHealthBarHeight(0.0f) {
@@ -106,6 +110,60 @@ struct FrameContext {
     const bool isInWvW; // Game context: true if player is on a WvW map
 };
 
+/**
+ * @brief Game Thread counters for the extraction pass that produced a frame
+ */
+struct ExtractionStats {
+    uint32_t probeCacheHits = 0;   // IsMemorySafe() probes answered by the page cache
+    uint32_t probeCacheMisses = 0; // Probes that had to touch memory
+    uint32_t extractionMicros = 0;  // Wall time of the pass (held the game thread unless decoded in the background)
+    uint32_t resolveMicros = 0;     // Of which list validation, roster walk and item reclassification (outside the budget)
+    uint32_t extractionThreads = 0; // Threads that took part (1 = serial)
+    uint32_t staleEntities = 0;     // Entities copied from the previous frame by distance LOD
+    uint32_t shapeCacheHits = 0;    // Havok shape dimensions taken from the shape cache
+    uint32_t shapeCacheMisses = 0;  // Havok shape chains walked
+    uint32_t shapeWalksSavedPerSecond = 0; // Shape cache hits over the last second
+    uint32_t liveAgents = 0;        // Agents indexed in the slot table
+    uint32_t spawnedAgents = 0;     // Slots that got a new generation this pass
+    uint32_t despawnedAgents = 0;   // Slots dropped this pass
+
+    // Player roster (zero when characters were not read this pass)
+    uint32_t rosterPlayers = 0;     // Players known to the roster
+    uint32_t namesTranscoded = 0;   // Player names converted to UTF-8 this pass
+
+    // Character, gadget and attack target lists read this pass (see SlotOccupancy)
+    uint32_t slotCapacity = 0;      // Slots of those lists
+    uint32_t slotsProbed = 0;       // Of which were examined; the rest lay past the reported counts
+
+    // Ground item index (all zero when items were not read this pass)
+    uint32_t itemListSize = 0;      // Items in the game's item list, equipped and bagged included
+    uint32_t groundItems = 0;       // Of which lie on the ground and were extracted
+    uint32_t itemsReclassified = 0; // Item slots whose location was read this pass
+
+    // Static gadget cache (zero when gadgets were not read this pass)
+    uint32_t staticGadgets = 0;     // Gadgets cached for the current map
+    uint32_t staticGadgetHits = 0;  // Gadgets whose position and shape came from the cache
+
+    // Time budget (all zero without one)
+    uint32_t budgetMicros = 0;      // Budget the pass ran against
+    uint32_t gameFrameMs = 0;       // Game frame time of the tick that ran the pass
+    uint32_t deferredEntities = 0;  // Entities left unread at the deadline (kept from the previous frame when known)
+    uint32_t sweepLatencyMs = 0;    // Slowest category's last full sweep of its list
+    uint32_t sweepPasses = 0;       // Passes that sweep took
+
+    // Frame reclamation
+    uint32_t pinnedSlots = 0;       // Retired frames still pinned by readers when this one was written
+    uint32_t skippedPasses = 0;     // Passes skipped since startup because readers pinned every slot
+
+    // Background decode only (all zero when extraction reads live memory)
+    uint32_t captureMicros = 0;     // Game thread time spent copying pages into the staging image
+    uint32_t stagedPages = 0;       // Pages copied by the capture
+    uint32_t missingPages = 0;      // Pages the decode needed but the capture lacked (unread this pass, staged by the next capture)
+    uint32_t primedEntities = 0;    // Entities of newly occupied list slots read during the capture
+    uint32_t missedEntities = 0;    // Entities that ran into a missing page (kept from the previous frame when known)
+    uint32_t missedCategories = 0;  // CategoryBit() of each category with such entities; the scheduler re-reads them
+};
+
 struct FrameGameData {
     std::vector<PlayerEntity*> players;
     std::vector<NpcEntity*> npcs;
@@ -113,7 +171,22 @@ struct FrameGameData {
     std::vector<AttackTargetEntity*> attackTargets;
     std::vector<ItemEntity*> items;
 
-    ankerl::unordered_dense::map<uint32_t, GameEntity*> entityMap;
+    // Entities by agentId, for O(1) lookups. Only the entries listed in indexedAgentIds are
+    // set, so a reset clears those instead of the whole array. Filled from AgentSlotTable handles.
+    std::vector<GameEntity*> byAgentId;
+    std::vector<uint32_t> indexedAgentIds;
+
+    // The same entities as hot/cold columns, in the order of the lists above (see EntityColumns)
+    EntityColumns columns;
+
+    // Entities that appeared, left or changed address since the previously published frame
+    // (see EntityEventDiff). A reader that skipped an epoch has missed the skipped frames' events.
+    std::vector<EntityEvent> events;
+
+    ExtractionStats stats;
+
+    // Publication epoch (increases by one per published frame, 0 = never published)
+    uint64_t epoch = 0;
 
     void Reset() {
         players.clear();
@@ -121,14 +194,47 @@ struct FrameGameData {
         gadgets.clear();
         attackTargets.clear();
         items.clear();
-        entityMap.clear();
+        for (uint32_t agentId : indexedAgentIds) {
+            byAgentId[agentId] = nullptr;
+        }
+        indexedAgentIds.clear();
+        columns.Clear();
+        events.clear();
+        stats = ExtractionStats{};
+        epoch = 0;
+    }
+
+    /**
+     * @brief Index an entity under the agentId of its handle (extraction side)
+     */
+    void IndexAgent(GameEntity* entity, const EntityHandle& handle) {
+        if (!handle.IsValid()) {
+            return;
+        }
+        if (handle.agentId >= byAgentId.size()) {
+            const size_t needed = static_cast<size_t>(handle.agentId) + 1;
+            byAgentId.resize(needed > byAgentId.size() * 2 ? needed : byAgentId.size() * 2, nullptr);
+        }
+        byAgentId[handle.agentId] = entity;
+        indexedAgentIds.push_back(handle.agentId);
     }
 
     template <typename T = GameEntity>
     const T* GetByID(uint32_t id) const {
-        auto it = entityMap.find(id);
-        if (it != entityMap.end()) {
-            return static_cast<const T*>(it->second);
+        if (id < byAgentId.size()) {
+            return static_cast<const T*>(byAgentId[id]);
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Entity of a handle, or nullptr if the agent despawned (or its id was reused) since
+     */
+    template <typename T = GameEntity>
+    const T* GetByHandle(const EntityHandle& handle) const {
+        const T* entity = GetByID<T>(handle.agentId);
+        if (entity && entity->generation == handle.generation) {
+            return entity;
         }
         return nullptr;
     }
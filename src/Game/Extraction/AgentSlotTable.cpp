@@ -0,0 +1,83 @@
+#include "AgentSlotTable.h"
+#include <algorithm>
+
+namespace kx {
+
+    void AgentSlotTable::BeginPass() {
+        ++m_pass;
+        m_stats = Stats{};
+    }
+
+    EntityHandle AgentSlotTable::Touch(int32_t agentId, const void* address) {
+        if (agentId <= 0 || static_cast<uint32_t>(agentId) >= MAX_AGENT_ID) {
+            return {};
+        }
+        const uint32_t id = static_cast<uint32_t>(agentId);
+
+        if (id >= m_slots.size()) {
+            m_slots.resize((std::min)(static_cast<size_t>(MAX_AGENT_ID), (std::max)(static_cast<size_t>(id) + 1, m_slots.size() * 2)));
+        }
+        Slot& slot = m_slots[id];
+
+        if (slot.livePosition != NOT_LIVE && slot.address != address) {
+            if (slot.lastSeenPass == m_pass) {
+                return {}; // Two entities claim the id this pass: the first one keeps it
+            }
+            Despawn(id); // The id now belongs to another wrapper
+        }
+
+        if (slot.livePosition == NOT_LIVE) {
+            if (++slot.generation == 0) {
+                slot.generation = 1; // 0 is the null handle
+            }
+            slot.address = address;
+            slot.livePosition = static_cast<uint32_t>(m_live.size());
+            m_live.push_back(id);
+            ++m_stats.spawned;
+        }
+
+        slot.lastSeenPass = m_pass;
+        return { id, slot.generation };
+    }
+
+    size_t AgentSlotTable::Sweep() {
+        size_t removed = 0;
+        for (size_t i = m_live.size(); i-- > 0;) {
+            const uint32_t id = m_live[i];
+            if (m_slots[id].lastSeenPass != m_pass) {
+                Despawn(id);
+                ++removed;
+            }
+        }
+        return removed;
+    }
+
+    void AgentSlotTable::Clear() {
+        while (!m_live.empty()) {
+            Despawn(m_live.back());
+        }
+        m_stats = Stats{};
+    }
+
+    EntityHandle AgentSlotTable::Find(uint32_t agentId) const {
+        if (agentId >= m_slots.size() || m_slots[agentId].livePosition == NOT_LIVE) {
+            return {};
+        }
+        return { agentId, m_slots[agentId].generation };
+    }
+
+    void AgentSlotTable::Despawn(uint32_t agentId) {
+        Slot& slot = m_slots[agentId];
+
+        // Swap-remove from the live list
+        const uint32_t moved = m_live.back();
+        m_live[slot.livePosition] = moved;
+        m_slots[moved].livePosition = slot.livePosition;
+        m_live.pop_back();
+
+        slot.livePosition = NOT_LIVE;
+        slot.address = nullptr;
+        ++m_stats.despawned;
+    }
+
+} // namespace kx
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "../Data/EntityHandle.h"
+
+namespace kx {
+
+/**
+ * @brief Persistent agentId -> generation table, owned by the extraction pipeline
+ *
+ * Slots are indexed directly by agentId (the game hands them out as small array indices),
+ * so a lookup is one bounds check and one load. A slot changes only when its agent spawns
+ * or despawns: steady-state passes just stamp the pass number on slots already live.
+ *
+ * Usage per extraction pass:
+ * 1. BeginPass()
+ * 2. Touch() every entity of the finished frame
+ * 3. Sweep() to despawn the live slots that were not touched
+ */
+class AgentSlotTable {
+public:
+    // Agent ids at or past this are not indexed (their entities get a null handle)
+    static constexpr uint32_t MAX_AGENT_ID = 1u << 18;
+
+    struct Stats {
+        uint32_t spawned = 0;    // Slots that got a new generation this pass
+        uint32_t despawned = 0;  // Live slots dropped this pass
+    };
+
+    AgentSlotTable() = default;
+
+    void BeginPass();
+
+    /**
+     * @brief Mark an agent as present this pass
+     * A slot that was not live, or was live for another wrapper address, gets a new generation.
+     * @param address Wrapper address of the entity, tells a reused agentId from the same agent
+     * @return Handle of the agent; null for ids that are not indexed or already taken this pass
+     */
+    EntityHandle Touch(int32_t agentId, const void* address);
+
+    /**
+     * @brief Despawn every live slot that was not touched since BeginPass()
+     * @return Number of slots despawned
+     */
+    size_t Sweep();
+
+    /**
+     * @brief Despawn everything (e.g., on map change)
+     * Generations are kept, so handles from before the clear stay dead.
+     */
+    void Clear();
+
+    /**
+     * @brief Current handle of a live agent, or a null handle
+     */
+    [[nodiscard]] EntityHandle Find(uint32_t agentId) const;
+
+    [[nodiscard]] size_t LiveCount() const { return m_live.size(); }
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+
+private:
+    static constexpr uint32_t NOT_LIVE = UINT32_MAX;
+
+    struct Slot {
+        const void* address = nullptr;
+        uint32_t generation = 0;
+        uint32_t lastSeenPass = 0;
+        uint32_t livePosition = NOT_LIVE; // Index in m_live while live
+    };
+
+    void Despawn(uint32_t agentId);
+
+    std::vector<Slot> m_slots;     // Indexed by agentId, grown on demand
+    std::vector<uint32_t> m_live;  // Live agent ids, so Sweep() only visits those
+    uint32_t m_pass = 0;
+    Stats m_stats;
+};
+
+} // namespace kx
@@ -1,186 +1,794 @@
 #include "DataExtractor.h"
+#include <algorithm>
+#include <chrono>
 #include <ankerl/unordered_dense.h>
-#include "../../Memory/AddressManager.h"
 #include "../SdkStructs.h"
 #include "../../Memory/SafeGameArray.h"
 #include "../../Memory/Safety.h"
+#include "../../Memory/MemorySource.h"
+#include "../../Utils/ForkJoinPool.h"
 #include "EntityExtractor.h"
+#include "EntityRecordCache.h"
+#include "ExtractionContext.h"
+#include "ExtractionPlan.h"
+#include "PrefetchPipeline.h"
 #include "../../Rendering/Shared/LayoutConstants.h"
 
 namespace kx {
 
+    namespace {
+
+        template <typename T>
+        void AppendAll(std::vector<T*>& out, const std::vector<T*>& in) {
+            out.insert(out.end(), in.begin(), in.end());
+        }
+
+        // Copy the entities of a category that is not due this pass from the previous frame
+        // into this frame's pool: the previous slot is recycled once its readers let go.
+        template <typename T>
+        void CarryOver(ObjectPool<T>& pool, const std::vector<T*>& previous, std::vector<T*>& out) {
+            ObjectPoolSlice<T> slice = pool.Slice(0, previous.size());
+            for (const T* entity : previous) {
+                T* copy = slice.Get();
+                if (!copy) break; // Pool exhausted
+                *copy = *entity;
+                out.push_back(copy);
+            }
+        }
+
+        // Prefetching only pays against live memory; recorded and replayed reads are image lookups
+        uint32_t PrefetchDistance(const ExtractionContext& context) {
+            return MemorySource::IsLive() ? context.prefetchDistance : 0;
+        }
+
+        template <typename T>
+        void AssignStale(T& copy, const T& previous, uint64_t now) {
+            copy = previous;
+            copy.isStale = true;
+            copy.staleMs = static_cast<uint32_t>(now - (std::min)(now, previous.refreshedAt));
+        }
+
+        // Copy an entity outside this pass's LOD slice: keeps its last values, flagged stale
+        template <typename T>
+        T* CopyStale(ObjectPoolSlice<T>& pool, const T& previous, uint64_t now) {
+            T* copy = pool.Get();
+            if (!copy) return nullptr; // Pool exhausted
+            AssignStale(*copy, previous, now);
+            return copy;
+        }
+
+        template <typename T>
+        void CopyAllStale(ObjectPoolSlice<T>& pool, const std::vector<const T*>& previous, uint64_t now, std::vector<T*>& out) {
+            for (const T* entity : previous) {
+                T* copy = CopyStale(pool, *entity, now);
+                if (!copy) break;
+                out.push_back(copy);
+            }
+        }
+
+        // The previous frame's entity for a wrapper, if it was extracted as the same kind
+        const GameEntity* FindPrevious(const ExtractionContext& context, const void* address, EntityTypes entityType) {
+            auto it = context.previousByAddress.find(address);
+            if (it == context.previousByAddress.end() || it->second->entityType != entityType) {
+                return nullptr;
+            }
+            return it->second;
+        }
+
+        /**
+         * @brief Keep the previous values of the entities a participant did not read before the deadline
+         *
+         * Wrappers without a previous entity are left out of this frame; they are the first
+         * ones read on the next pass. Character records are touched so they are not swept.
+         */
+        template <typename T>
+        void DeferRemaining(ExtractionWorker& worker,
+            ExtractionCategory category,
+            EntityTypes entityType,
+            std::span<const SafeAccess::ValidatedSlot> remaining,
+            ObjectPoolSlice<T>& pool,
+            std::vector<T*>& out,
+            const ExtractionContext& context) {
+            if (remaining.empty()) return;
+
+            const size_t c = static_cast<size_t>(category);
+            worker.firstDeferred[c] = remaining.front().index;
+            worker.deferred[c] += static_cast<uint32_t>(remaining.size());
+
+            const bool hasRecords = entityType == EntityTypes::Player || entityType == EntityTypes::NPC;
+            for (const SafeAccess::ValidatedSlot& slot : remaining) {
+                const GameEntity* previous = FindPrevious(context, slot.object, entityType);
+                if (!previous) continue;
+
+                T* copy = CopyStale(pool, *static_cast<const T*>(previous), context.now);
+                if (!copy) break;
+                if (hasRecords) {
+                    worker.recordCache.Touch(copy->GetCombatKey(), entityType);
+                }
+                out.push_back(copy);
+            }
+        }
+
+        /**
+         * @brief Decide whether an entity just read belongs in the frame
+         *
+         * A staged decode reads pages the capture lacked as missing, so an entity that ran into
+         * one is only partly read. It keeps its previous values instead, flagged stale, rather
+         * than dropping out of the frame (and despawning); an entity without previous values is
+         * left out. Either way its category is reported, so the scheduler reads it again once
+         * the next capture has the pages. Its record is touched and set to re-read the stable tier.
+         *
+         * @param missesBefore MemorySource::GetStagedMisses() before the entity was read
+         * @return True if the entity belongs in the frame
+         */
+        template <typename T>
+        bool SettleEntity(ExtractionWorker& worker,
+            ExtractionCategory category,
+            EntityTypes entityType,
+            T& entity,
+            bool extracted,
+            const void* address,
+            uint64_t missesBefore,
+            const ExtractionContext& context) {
+            if (MemorySource::GetStagedMisses() == missesBefore) {
+                if (extracted) {
+                    entity.refreshedAt = context.now;
+                }
+                return extracted;
+            }
+
+            ++worker.missedEntities;
+            worker.missedCategories |= CategoryBit(category);
+            const GameEntity* previous = FindPrevious(context, address, entityType);
+            if (!previous) return false;
+
+            AssignStale(entity, *static_cast<const T*>(previous), context.now);
+            if (entityType == EntityTypes::Player || entityType == EntityTypes::NPC) {
+                worker.recordCache.Touch(entity.GetCombatKey(), entityType).hasStable = false;
+            }
+            return true;
+        }
+
+        // Start the list at the sweep cursor: slots are in index order, so the ones left unread
+        // by the previous pass come first
+        void RotateToCursor(std::vector<SafeAccess::ValidatedSlot>& slots, uint32_t cursor) {
+            auto first = std::lower_bound(slots.begin(), slots.end(), cursor,
+                [](const SafeAccess::ValidatedSlot& slot, uint32_t index) { return slot.index < index; });
+            std::rotate(slots.begin(), first, slots.end());
+        }
+
+        /**
+         * @brief Decide per slot whether it is read this pass or copied from the previous frame
+         *
+         * Slots without a previous entity are always read. The others are tiered by their
+         * last-known distance; near ones are read, mid and far ones only within the tier's
+         * round-robin slice. emit(slot, previous) gets previous == nullptr for slots to read.
+         */
+        template <typename Emit>
+        void SelectByLod(std::span<const SafeAccess::ValidatedSlot> slots,
+            EntityTypes entityType,
+            const ExtractionContext& context,
+            const glm::vec3& reference,
+            LodCursor& cursor,
+            Emit&& emit) {
+            struct Entry {
+                const GameEntity* previous;
+                LodTier tier;
+            };
+            static thread_local std::vector<Entry> entries;
+            entries.clear();
+            entries.reserve(slots.size());
+
+            size_t midCount = 0;
+            size_t farCount = 0;
+            for (const SafeAccess::ValidatedSlot& slot : slots) {
+                const GameEntity* previous = FindPrevious(context, slot.object, entityType);
+                if (!previous) {
+                    entries.push_back({ nullptr, LodTier::Near });
+                    continue;
+                }
+                const glm::vec3 offset = previous->position - reference;
+                const LodTier tier = ExtractionLod::Classify(glm::dot(offset, offset));
+                midCount += tier == LodTier::Mid;
+                farCount += tier == LodTier::Far;
+                entries.push_back({ previous, tier });
+            }
+
+            size_t midOrdinal = 0;
+            size_t farOrdinal = 0;
+            for (size_t i = 0; i < slots.size(); ++i) {
+                const Entry& entry = entries[i];
+                bool read = true;
+                if (entry.tier == LodTier::Mid) {
+                    read = ExtractionLod::InSlice(midOrdinal++, midCount, cursor.nextMid, ExtractionLod::MID_BUDGET);
+                } else if (entry.tier == LodTier::Far) {
+                    read = ExtractionLod::InSlice(farOrdinal++, farCount, cursor.nextFar, ExtractionLod::FAR_BUDGET);
+                }
+                emit(slots[i], read ? nullptr : entry.previous);
+            }
+
+            cursor.nextMid = ExtractionLod::AdvanceCursor(cursor.nextMid, midCount, ExtractionLod::MID_BUDGET);
+            cursor.nextFar = ExtractionLod::AdvanceCursor(cursor.nextFar, farCount, ExtractionLod::FAR_BUDGET);
+        }
+
+        template <typename T>
+        void SelectByLod(std::span<const SafeAccess::ValidatedSlot> slots,
+            EntityTypes entityType,
+            const ExtractionContext& context,
+            const glm::vec3& reference,
+            LodCursor& cursor,
+            std::vector<SafeAccess::ValidatedSlot>& read,
+            std::vector<const T*>& stale) {
+            read.clear();
+            SelectByLod(slots, entityType, context, reference, cursor,
+                [&](const SafeAccess::ValidatedSlot& slot, const GameEntity* previous) {
+                    if (previous) {
+                        stale.push_back(static_cast<const T*>(previous));
+                    } else {
+                        read.push_back(slot);
+                    }
+                });
+        }
+
+        template <typename T>
+        void IndexByAddress(ExtractionContext& context, const std::vector<T*>& entities) {
+            for (const T* entity : entities) {
+                context.previousByAddress[entity->address] = entity;
+            }
+        }
+
+        template <typename T>
+        void IndexAgents(FrameGameData& pooledData, AgentSlotTable& agentSlots, const std::vector<T*>& entities) {
+            for (T* entity : entities) {
+                const EntityHandle handle = agentSlots.Touch(entity->agentId, entity->address);
+                entity->generation = handle.generation;
+                pooledData.IndexAgent(entity, handle);
+            }
+        }
+
+    } // namespace
+
     bool DataExtractor::ExtractFrameData(ObjectPool<PlayerEntity>& playerPool,
         ObjectPool<NpcEntity>& npcPool,
         ObjectPool<GadgetEntity>& gadgetPool,
         ObjectPool<AttackTargetEntity>& attackTargetPool,
         ObjectPool<ItemEntity>& itemPool,
         FrameGameData& pooledData,
-        ankerl::unordered_dense::map<void*, const wchar_t*>& characterToPlayerNameMap) {
+        ExtractionContext& context) {
+        const auto start = std::chrono::steady_clock::now();
         pooledData.Reset();
 
-        void* pContextCollection = AddressManager::GetContextCollectionPtr();
-        if (!pContextCollection || !SafeAccess::IsMemorySafe(pContextCollection)) {
-            return false;
+        // Recorded and replayed memory is bound to this thread: only live passes fork
+        ForkJoinPool* pool = MemorySource::IsLive() ? context.workerPool : nullptr;
+        const size_t participants = pool ? pool->GetWorkerCount() + 1 : 1;
+        if (context.workers.size() != participants) {
+            // Shards are routed by participant count; records in the wrong shard would go cold anyway
+            context.ClearRecords();
+            context.workers.resize(participants);
         }
 
-        // Build the map of character pointers to player names (using persistent map passed by reference)
+        // The caller's probe cache doubles as participant 0's. A new generation per pass:
+        // readability proven last tick is not trusted.
+        ExtractionWorker& caller = context.workers.front();
+        caller.probeCache.NextGeneration();
+        caller.shapeCache.ResetStats();
+
+        bool extracted = false;
         {
-            ReClass::ContextCollection ctxCollection(pContextCollection);
-            ReClass::ChCliContext charContext = ctxCollection.GetChCliContext();
-            if (charContext.data()) {
-                auto playerList = charContext.GetPlayers();
-                for (const auto& player : playerList) {
-                    auto character = player.GetCharacter();
-                    if (character.data()) {
-                        characterToPlayerNameMap[character.data()] = player.GetName();
-                    }
-                }
-            }
+            SafeAccess::ScopedPageProbeCache probeScope(caller.probeCache);
+            extracted = ExtractPass(playerPool, npcPool, gadgetPool, attackTargetPool, itemPool, pooledData, context);
         }
 
-        // Single pass extraction for both players and NPCs
-        ExtractCharacterData(playerPool, npcPool, pooledData.players, pooledData.npcs, pooledData, characterToPlayerNameMap);
-        ExtractGadgetData(gadgetPool, pooledData.gadgets, pooledData);
-        ExtractAttackTargetData(attackTargetPool, pooledData.attackTargets, pooledData);
-        ExtractItemData(itemPool, pooledData.items, pooledData);
+        ExtractionStats& stats = pooledData.stats;
+        const size_t counted = extracted ? participants : 1;
+        for (size_t i = 0; i < counted; ++i) {
+            stats.probeCacheHits += context.workers[i].probeCache.GetStats().hits;
+            stats.probeCacheMisses += context.workers[i].probeCache.GetStats().misses;
+            stats.shapeCacheHits += context.workers[i].shapeCache.GetStats().hits;
+            stats.shapeCacheMisses += context.workers[i].shapeCache.GetStats().misses;
+        }
+        stats.extractionThreads = static_cast<uint32_t>(counted);
+        stats.extractionMicros = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count());
+        stats.budgetMicros = context.budgetMicros;
 
-        return true;
+        context.shapeWindowHits += stats.shapeCacheHits;
+        if (context.shapeWindowStart == 0 || context.now < context.shapeWindowStart) {
+            context.shapeWindowStart = context.now;
+            context.shapeWindowHits = 0;
+        } else if (const uint64_t elapsed = context.now - context.shapeWindowStart; elapsed >= 1000) {
+            context.shapeHitsPerSecond = static_cast<uint32_t>(context.shapeWindowHits * 1000ull / elapsed);
+            context.shapeWindowStart = context.now;
+            context.shapeWindowHits = 0;
+        }
+        stats.shapeWalksSavedPerSecond = context.shapeHitsPerSecond;
+
+        return extracted;
     }
 
-    void DataExtractor::ExtractCharacterData(ObjectPool<PlayerEntity>& playerPool,
+    bool DataExtractor::ExtractPass(ObjectPool<PlayerEntity>& playerPool,
         ObjectPool<NpcEntity>& npcPool,
-        std::vector<PlayerEntity*>& players,
-        std::vector<NpcEntity*>& npcs,
+        ObjectPool<GadgetEntity>& gadgetPool,
+        ObjectPool<AttackTargetEntity>& attackTargetPool,
+        ObjectPool<ItemEntity>& itemPool,
         FrameGameData& pooledData,
-        const ankerl::unordered_dense::map<void*, const wchar_t*>& characterToPlayerNameMap) {
-        players.clear();
-        npcs.clear();
-        players.reserve(EntityLimits::MAX_PLAYERS);
-        npcs.reserve(EntityLimits::MAX_NPCS);
-
-        void* pContextCollection = AddressManager::GetContextCollectionPtr();
-        if (!pContextCollection) return;
-
-        ReClass::ContextCollection ctxCollection(pContextCollection);
-        ReClass::ChCliContext charContext = ctxCollection.GetChCliContext();
-        if (!charContext.data()) return;
-
-        void* localPlayerPtr = AddressManager::GetLocalPlayer();
-
-        // Single pass over the character list - process both players and NPCs
-        auto characterList = charContext.GetCharacters();
-        for (const auto& character : characterList) {
-            void* charPtr = const_cast<void*>(character.data());
-            
-            // Check if this character is a player
-            auto it = characterToPlayerNameMap.find(charPtr);
-            if (it != characterToPlayerNameMap.end()) {
-                // This is a player
-                PlayerEntity* renderablePlayer = playerPool.Get();
-                if (!renderablePlayer) continue; // Pool exhausted, skip this entity
-
-                // Delegate all extraction logic to the helper class
-                if (EntityExtractor::ExtractPlayer(*renderablePlayer, character, it->second, localPlayerPtr)) {
-                    players.push_back(renderablePlayer);
-                    pooledData.entityMap[static_cast<uint32_t>(renderablePlayer->agentId)] = renderablePlayer;
+        ExtractionContext& context) {
+        void* pContextCollection = MemorySource::GetContextCollectionPtr();
+        if (!pContextCollection || !SafeAccess::IsMemorySafe(pContextCollection)) {
+            return false;
+        }
+
+        const size_t participants = context.workers.size();
+        ForkJoinPool* pool = participants > 1 ? context.workerPool : nullptr;
+        for (auto& worker : context.workers) {
+            worker.ClearFrame();
+        }
+
+        // Categories that are not due are neither validated nor read; they are carried over below.
+        // Categories no feature consumes are neither read nor carried over.
+        ExtractionPlan plan(context.categories, context.consumed, context.previousFrame != nullptr);
+        const ExtractionCategoryMask due = plan.GetRead();
+        auto isDue = [&plan](ExtractionCategory category) { return plan.Reads(category); };
+        const bool playersDue = isDue(ExtractionCategory::Players);
+        const bool npcsDue = isDue(ExtractionCategory::Npcs);
+        const bool gadgetsDue = isDue(ExtractionCategory::Gadgets);
+        const bool attackTargetsDue = isDue(ExtractionCategory::AttackTargets);
+        const bool itemsDue = isDue(ExtractionCategory::Items);
+
+        // Distance LOD: last-known distances are measured from the local player's previous position
+        const PlayerEntity* previousLocalPlayer = nullptr;
+        if (context.distanceLod && context.previousFrame) {
+            for (const PlayerEntity* player : context.previousFrame->players) {
+                if (player->isLocalPlayer) {
+                    previousLocalPlayer = player;
+                    break;
                 }
-            } else {
-                // This is an NPC
-                NpcEntity* renderableNpc = npcPool.Get();
-                if (!renderableNpc) continue; // Pool exhausted, skip this entity
-
-                // Delegate all extraction logic to the helper class
-                if (EntityExtractor::ExtractNpc(*renderableNpc, character)) {
-                    npcs.push_back(renderableNpc);
-                    pooledData.entityMap[static_cast<uint32_t>(renderableNpc->agentId)] = renderableNpc;
+            }
+        }
+        const bool useLod = previousLocalPlayer != nullptr;
+        const glm::vec3 lodReference = useLod ? previousLocalPlayer->position : glm::vec3(0.0f);
+
+        // LOD, the time budget and staged misses all fall back on the previous values of an entity
+        const bool staged = MemorySource::GetMode() == MemorySource::Mode::Staged;
+        context.previousByAddress.clear();
+        if (context.previousFrame && (useLod || context.budgetMicros != 0 || staged)) {
+            const FrameGameData& previous = *context.previousFrame;
+            if (playersDue && (context.budgetMicros != 0 || staged)) IndexByAddress(context, previous.players);
+            if (npcsDue) IndexByAddress(context, previous.npcs);
+            if (gadgetsDue) IndexByAddress(context, previous.gadgets);
+            if (attackTargetsDue) IndexByAddress(context, previous.attackTargets);
+            if (itemsDue) IndexByAddress(context, previous.items);
+        }
+        auto lodCursor = [&](ExtractionCategory category) -> LodCursor& {
+            return context.lodCursors[static_cast<size_t>(category)];
+        };
+        auto sweepCursor = [&](ExtractionCategory category) {
+            return context.sweeps[static_cast<size_t>(category)].cursor;
+        };
+
+        // One walk per list: names, player and NPC candidates, gadget, attack target and item slots.
+        // Not resumable: the time budget starts once the lists are resolved and covers decoding only.
+        const auto resolveStart = std::chrono::steady_clock::now();
+        plan.Resolve(pContextCollection, context);
+        const auto resolveEnd = std::chrono::steady_clock::now();
+        pooledData.stats.resolveMicros = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(resolveEnd - resolveStart).count());
+        context.deadline = resolveEnd + std::chrono::microseconds(context.budgetMicros);
+        const std::span<const SafeAccess::ValidatedSlot> gadgetCandidates = plan.GetGadgetCandidates();
+        const std::span<const SafeAccess::ValidatedSlot> attackTargetCandidates = plan.GetAttackTargetCandidates();
+        const std::span<const SafeAccess::ValidatedSlot> itemCandidates = plan.GetItemCandidates();
+        if (playersDue || npcsDue) {
+            pooledData.stats.rosterPlayers = context.roster.GetStats().players;
+            pooledData.stats.namesTranscoded = context.roster.GetStats().namesTranscoded;
+        }
+        auto addSlotStats = [&](const SafeAccess::SlotOccupancy& occupancy) {
+            pooledData.stats.slotsProbed += occupancy.GetStats().probed;
+            pooledData.stats.slotCapacity += occupancy.GetStats().capacity;
+        };
+        if (playersDue || npcsDue) addSlotStats(context.characterOccupancy);
+        if (gadgetsDue) addSlotStats(context.gadgetOccupancy);
+        if (attackTargetsDue) addSlotStats(context.attackTargetOccupancy);
+        if (itemsDue) {
+            const GroundItemIndex::Stats& itemStats = context.groundItems.GetStats();
+            pooledData.stats.itemListSize = itemStats.listItems;
+            pooledData.stats.groundItems = itemStats.groundItems;
+            pooledData.stats.itemsReclassified = itemStats.reclassified;
+        }
+        // Read-only from here until the join; entries of another map are dropped first
+        context.staticGadgets.BeginPass(context.mapId);
+        if (gadgetsDue) {
+            pooledData.stats.staticGadgets = static_cast<uint32_t>(context.staticGadgets.Size());
+        }
+
+        // Distance LOD picks the slots to read; stale NPCs go to the shard that owns their record
+        context.staleGadgets.clear();
+        context.staleAttackTargets.clear();
+        context.staleItems.clear();
+        if (useLod) {
+            context.npcSlots.clear();
+            SelectByLod(context.npcCandidates, EntityTypes::NPC, context, lodReference, lodCursor(ExtractionCategory::Npcs),
+                [&](const SafeAccess::ValidatedSlot& slot, const GameEntity* previous) {
+                    if (previous) {
+                        context.workers[slot.index % participants].staleNpcs.push_back(static_cast<const NpcEntity*>(previous));
+                    } else {
+                        context.npcSlots.push_back(slot);
+                    }
+                });
+            SelectByLod(gadgetCandidates, EntityTypes::Gadget, context, lodReference, lodCursor(ExtractionCategory::Gadgets), context.gadgetSlots, context.staleGadgets);
+            SelectByLod(attackTargetCandidates, EntityTypes::AttackTarget, context, lodReference, lodCursor(ExtractionCategory::AttackTargets), context.attackTargetSlots, context.staleAttackTargets);
+            SelectByLod(itemCandidates, EntityTypes::Item, context, lodReference, lodCursor(ExtractionCategory::Items), context.itemSlots, context.staleItems);
+        } else {
+            context.npcSlots.assign(context.npcCandidates.begin(), context.npcCandidates.end());
+            context.gadgetSlots.assign(gadgetCandidates.begin(), gadgetCandidates.end());
+            context.attackTargetSlots.assign(attackTargetCandidates.begin(), attackTargetCandidates.end());
+            context.itemSlots.assign(itemCandidates.begin(), itemCandidates.end());
+        }
+
+        // Under a time budget each list resumes where the previous pass ran out
+        if (context.budgetMicros != 0) {
+            RotateToCursor(context.playerCandidates, sweepCursor(ExtractionCategory::Players));
+            RotateToCursor(context.npcSlots, sweepCursor(ExtractionCategory::Npcs));
+            RotateToCursor(context.gadgetSlots, sweepCursor(ExtractionCategory::Gadgets));
+            RotateToCursor(context.attackTargetSlots, sweepCursor(ExtractionCategory::AttackTargets));
+            RotateToCursor(context.itemSlots, sweepCursor(ExtractionCategory::Items));
+        }
+
+        // Route characters to participants by slot index. Slot indices are stable while a
+        // character exists, so the same character keeps hitting the same record shard.
+        for (const SafeAccess::ValidatedSlot& slot : context.playerCandidates) {
+            ExtractionWorker& worker = context.workers[slot.index % participants];
+            worker.playerSlots.push_back(slot);
+            worker.playerEntries.push_back(context.roster.Find(slot.object));
+        }
+        for (const SafeAccess::ValidatedSlot& slot : context.npcSlots) {
+            context.workers[slot.index % participants].npcSlots.push_back(slot);
+        }
+
+        // Gadget, attack target and item lists are split into contiguous ranges; they keep no records
+        const std::span<const SafeAccess::ValidatedSlot> gadgets = context.gadgetSlots;
+        const std::span<const SafeAccess::ValidatedSlot> attackTargets = context.attackTargetSlots;
+        const std::span<const SafeAccess::ValidatedSlot> items = context.itemSlots;
+
+        // Each input consumes at most one pooled object, so a participant's pool slice starts
+        // where its inputs start: no slice can run out before the pool itself would.
+        static thread_local std::vector<ParticipantRanges> ranges;
+        ranges.assign(participants, ParticipantRanges{});
+        size_t playerOffset = 0;
+        size_t npcOffset = 0;
+        for (size_t p = 0; p < participants; ++p) {
+            const ExtractionWorker& worker = context.workers[p];
+            ParticipantRanges& range = ranges[p];
+
+            range.players = playerPool.Slice(playerOffset, playerOffset + worker.playerSlots.size());
+            const size_t npcCount = worker.npcSlots.size() + worker.staleNpcs.size();
+            range.npcs = npcPool.Slice(npcOffset, npcOffset + npcCount);
+            playerOffset += worker.playerSlots.size();
+            npcOffset += npcCount;
+
+            range.gadgetBegin = gadgets.size() * p / participants;
+            range.gadgetEnd = gadgets.size() * (p + 1) / participants;
+            range.gadgets = gadgetPool.Slice(range.gadgetBegin, range.gadgetEnd);
+
+            range.attackTargetBegin = attackTargets.size() * p / participants;
+            range.attackTargetEnd = attackTargets.size() * (p + 1) / participants;
+            range.attackTargets = attackTargetPool.Slice(range.attackTargetBegin, range.attackTargetEnd);
+
+            range.itemBegin = items.size() * p / participants;
+            range.itemEnd = items.size() * (p + 1) / participants;
+            range.items = itemPool.Slice(range.itemBegin, range.itemEnd);
+        }
+
+        void* localPlayerPtr = MemorySource::GetLocalPlayerPtr();
+        auto runParticipant = [&](size_t p) {
+            if (p >= participants) return; // The pool grew since the split; nothing was assigned
+            ExtractionWorker& worker = context.workers[p];
+            if (p == 0) {
+                // The caller's cache is already active and holds the pages proven during validation
+                ExtractParticipant(worker, ranges[p], gadgets, attackTargets, items, localPlayerPtr, due, context);
+                return;
+            }
+            worker.probeCache.NextGeneration();
+            worker.shapeCache.ResetStats();
+            SafeAccess::ScopedPageProbeCache probeScope(worker.probeCache);
+            ExtractParticipant(worker, ranges[p], gadgets, attackTargets, items, localPlayerPtr, due, context);
+        };
+
+        size_t ran = pool ? pool->Run(runParticipant) : 0;
+        // The pool may have shrunk since the split (shutdown): finish the leftover shares here
+        for (; ran < participants; ++ran) {
+            runParticipant(ran);
+        }
+
+        // Merge in participant order
+        pooledData.players.reserve(EntityLimits::MAX_PLAYERS);
+        pooledData.npcs.reserve(EntityLimits::MAX_NPCS);
+        pooledData.gadgets.reserve(EntityLimits::MAX_GADGETS);
+        pooledData.attackTargets.reserve(EntityLimits::MAX_ATTACK_TARGETS);
+        pooledData.items.reserve(EntityLimits::MAX_ITEMS);
+        // Stale copies go right after the read range of their pool
+        ObjectPoolSlice<GadgetEntity> staleGadgetSlice = gadgetPool.Slice(gadgets.size(), gadgets.size() + context.staleGadgets.size());
+        ObjectPoolSlice<AttackTargetEntity> staleAttackTargetSlice = attackTargetPool.Slice(attackTargets.size(), attackTargets.size() + context.staleAttackTargets.size());
+        ObjectPoolSlice<ItemEntity> staleItemSlice = itemPool.Slice(items.size(), items.size() + context.staleItems.size());
+        CopyAllStale(staleGadgetSlice, context.staleGadgets, context.now, pooledData.gadgets);
+        CopyAllStale(staleAttackTargetSlice, context.staleAttackTargets, context.now, pooledData.attackTargets);
+        CopyAllStale(staleItemSlice, context.staleItems, context.now, pooledData.items);
+
+        uint32_t staleCount = static_cast<uint32_t>(
+            context.staleGadgets.size() + context.staleAttackTargets.size() + context.staleItems.size());
+        for (const auto& worker : context.workers) {
+            staleCount += static_cast<uint32_t>(worker.staleNpcs.size());
+        }
+        pooledData.stats.staleEntities = staleCount;
+        for (const auto& worker : context.workers) {
+            pooledData.stats.missedEntities += worker.missedEntities;
+            pooledData.stats.missedCategories |= worker.missedCategories;
+        }
+
+        if (const FrameGameData* previous = context.previousFrame) {
+            if (plan.Carries(ExtractionCategory::Players)) CarryOver(playerPool, previous->players, pooledData.players);
+            if (plan.Carries(ExtractionCategory::Npcs)) CarryOver(npcPool, previous->npcs, pooledData.npcs);
+            if (plan.Carries(ExtractionCategory::Gadgets)) CarryOver(gadgetPool, previous->gadgets, pooledData.gadgets);
+            if (plan.Carries(ExtractionCategory::AttackTargets)) CarryOver(attackTargetPool, previous->attackTargets, pooledData.attackTargets);
+            if (plan.Carries(ExtractionCategory::Items)) CarryOver(itemPool, previous->items, pooledData.items);
+        }
+        for (const auto& worker : context.workers) {
+            for (const PlayerEntity* player : worker.players) {
+                context.roster.BindAgent(player->address, player->agentId);
+            }
+            for (const auto& [gadget, entry] : worker.staticGadgetStores) {
+                context.staticGadgets.Store(gadget, entry);
+            }
+            pooledData.stats.staticGadgetHits += worker.staticGadgetHits;
+            AppendAll(pooledData.players, worker.players);
+            AppendAll(pooledData.npcs, worker.npcs);
+            AppendAll(pooledData.gadgets, worker.gadgets);
+            AppendAll(pooledData.attackTargets, worker.attackTargets);
+            AppendAll(pooledData.items, worker.items);
+        }
+
+        // Every entity of the frame (read, stale or carried over) keeps its agent slot alive
+        context.agentSlots.BeginPass();
+        IndexAgents(pooledData, context.agentSlots, pooledData.players);
+        IndexAgents(pooledData, context.agentSlots, pooledData.npcs);
+        IndexAgents(pooledData, context.agentSlots, pooledData.gadgets);
+        IndexAgents(pooledData, context.agentSlots, pooledData.attackTargets);
+        IndexAgents(pooledData, context.agentSlots, pooledData.items);
+        context.agentSlots.Sweep();
+        pooledData.stats.liveAgents = static_cast<uint32_t>(context.agentSlots.LiveCount());
+        pooledData.stats.spawnedAgents = context.agentSlots.GetStats().spawned;
+        pooledData.stats.despawnedAgents = context.agentSlots.GetStats().despawned;
+        pooledData.columns.Build(pooledData);
+
+        if (context.budgetMicros != 0) {
+            const std::array<size_t, EXTRACTION_CATEGORY_COUNT> listSizes = {
+                context.playerCandidates.size(), context.npcSlots.size(),
+                gadgets.size(), attackTargets.size(), items.size()
+            };
+            for (size_t c = 0; c < EXTRACTION_CATEGORY_COUNT; ++c) {
+                if (isDue(static_cast<ExtractionCategory>(c))) {
+                    AdvanceSweep(context, static_cast<ExtractionCategory>(c), listSizes[c], pooledData.stats);
                 }
             }
+            for (const ExtractionSweep& sweep : context.sweeps) {
+                pooledData.stats.sweepLatencyMs = (std::max)(pooledData.stats.sweepLatencyMs, sweep.lastLatencyMs);
+                pooledData.stats.sweepPasses = (std::max)(pooledData.stats.sweepPasses, sweep.lastPasses);
+            }
         }
+
+        return true;
     }
 
-    void DataExtractor::ExtractGadgetData(ObjectPool<GadgetEntity>& gadgetPool,
-        std::vector<GadgetEntity*>& gadgets,
-        FrameGameData& pooledData) {
-        gadgets.clear();
-        gadgets.reserve(EntityLimits::MAX_GADGETS);
+    void DataExtractor::AdvanceSweep(ExtractionContext& context,
+        ExtractionCategory category,
+        size_t listSize,
+        ExtractionStats& stats) {
+        ExtractionSweep& sweep = context.sweeps[static_cast<size_t>(category)];
+        if (!sweep.active) {
+            sweep.active = true;
+            sweep.startedAt = context.now;
+            sweep.passes = 0;
+            sweep.remaining = listSize;
+        }
+        ++sweep.passes;
 
-        void* pContextCollection = AddressManager::GetContextCollectionPtr();
-        if (!pContextCollection) return;
+        // Resume from the deferred slot that comes first in this pass's rotated order: every
+        // slot before it was read by some participant
+        const size_t c = static_cast<size_t>(category);
+        size_t deferred = 0;
+        std::optional<uint32_t> resumeAt;
+        for (const auto& worker : context.workers) {
+            deferred += worker.deferred[c];
+            const std::optional<uint32_t>& first = worker.firstDeferred[c];
+            if (first && (!resumeAt || *first - sweep.cursor < *resumeAt - sweep.cursor)) {
+                resumeAt = first;
+            }
+        }
+        stats.deferredEntities += static_cast<uint32_t>(deferred);
 
-        ReClass::ContextCollection ctxCollection(pContextCollection);
-        ReClass::GdCliContext gadgetContext = ctxCollection.GetGdCliContext();
-        if (!gadgetContext.data()) return;
+        const size_t read = listSize - (std::min)(listSize, deferred);
+        if (!resumeAt || read >= sweep.remaining) {
+            sweep.active = false;
+            sweep.lastLatencyMs = static_cast<uint32_t>(context.now - sweep.startedAt);
+            sweep.lastPasses = sweep.passes;
+        } else {
+            sweep.remaining -= read;
+        }
+        if (resumeAt) {
+            sweep.cursor = *resumeAt;
+        }
+    }
 
-        auto gadgetList = gadgetContext.GetGadgets();
-        for (const auto& gadget : gadgetList) {
-            GadgetEntity* renderableGadget = gadgetPool.Get();
-            if (!renderableGadget) break; // Pool exhausted
+    void DataExtractor::ExtractParticipant(ExtractionWorker& worker,
+        ParticipantRanges& ranges,
+        std::span<const SafeAccess::ValidatedSlot> gadgets,
+        std::span<const SafeAccess::ValidatedSlot> attackTargets,
+        std::span<const SafeAccess::ValidatedSlot> items,
+        void* localPlayerPtr,
+        ExtractionCategoryMask due,
+        const ExtractionContext& context) {
+        const bool playersDue = (due & CategoryBit(ExtractionCategory::Players)) != 0;
+        const bool npcsDue = (due & CategoryBit(ExtractionCategory::Npcs)) != 0;
+        const bool charactersDue = playersDue || npcsDue;
+
+        if (charactersDue) {
+            worker.recordCache.BeginTick(context.now);
+            ExtractCharacterData(worker, ranges.players, ranges.npcs, localPlayerPtr, context);
+        }
+        ExtractGadgetData(worker, ranges.gadgets, gadgets.subspan(ranges.gadgetBegin, ranges.gadgetEnd - ranges.gadgetBegin), context);
+        ExtractAttackTargetData(worker, ranges.attackTargets, attackTargets.subspan(ranges.attackTargetBegin, ranges.attackTargetEnd - ranges.attackTargetBegin), context);
+        ExtractItemData(worker, ranges.items, items.subspan(ranges.itemBegin, ranges.itemEnd - ranges.itemBegin), context);
+
+        // Drop records of characters that despawned since the last tick. Only the kinds read
+        // this pass are swept: records of a category that is not due were simply not touched.
+        if (playersDue && npcsDue) {
+            worker.recordCache.Sweep();
+        } else if (charactersDue) {
+            worker.recordCache.Sweep(playersDue ? EntityTypes::Player : EntityTypes::NPC);
+        }
+    }
+
+    void DataExtractor::ExtractCharacterData(ExtractionWorker& worker,
+        ObjectPoolSlice<PlayerEntity>& playerPool,
+        ObjectPoolSlice<NpcEntity>& npcPool,
+        void* localPlayerPtr,
+        const ExtractionContext& context) {
+        const uint32_t prefetchDistance = PrefetchDistance(context);
+
+        const SafeAccess::SafeGameArray<ReClass::ChCliCharacter>::ValidatedView playerCharacters(worker.playerSlots);
+        const PrefetchPipeline<ReClass::ChCliCharacter, ReClass::AgChar> playerPipeline(worker.playerSlots, prefetchDistance);
+        size_t playerIndex = 0;
+        for (const auto& character : playerCharacters) {
+            if (context.BudgetExhausted()) break;
+            playerPipeline.Advance(playerIndex);
+            const PlayerRoster::Entry* rosterEntry = worker.playerEntries[playerIndex++];
+
+            PlayerEntity* renderablePlayer = playerPool.Get();
+            if (!renderablePlayer) continue; // Pool exhausted, skip this entity
+
+            // Delegate all extraction logic to the helper class
+            const uint64_t misses = MemorySource::GetStagedMisses();
+            const bool extracted = EntityExtractor::ExtractPlayer(*renderablePlayer, character, rosterEntry, localPlayerPtr, worker.recordCache, worker.shapeCache);
+            if (SettleEntity(worker, ExtractionCategory::Players, EntityTypes::Player, *renderablePlayer, extracted, character.data(), misses, context)) {
+                worker.players.push_back(renderablePlayer);
+            }
+        }
+        DeferRemaining(worker, ExtractionCategory::Players, EntityTypes::Player,
+            std::span<const SafeAccess::ValidatedSlot>(worker.playerSlots).subspan(playerIndex), playerPool, worker.players, context);
+
+        const SafeAccess::SafeGameArray<ReClass::ChCliCharacter>::ValidatedView npcCharacters(worker.npcSlots);
+        const PrefetchPipeline<ReClass::ChCliCharacter, ReClass::AgChar> npcPipeline(worker.npcSlots, prefetchDistance);
+        size_t npcIndex = 0;
+        for (const auto& character : npcCharacters) {
+            if (context.BudgetExhausted()) break;
+            npcPipeline.Advance(npcIndex++);
+
+            NpcEntity* renderableNpc = npcPool.Get();
+            if (!renderableNpc) continue; // Pool exhausted, skip this entity
 
             // Delegate all extraction logic to the helper class
-            if (EntityExtractor::ExtractGadget(*renderableGadget, gadget)) {
-                gadgets.push_back(renderableGadget);
-                pooledData.entityMap[static_cast<uint32_t>(renderableGadget->agentId)] = renderableGadget;
+            const uint64_t misses = MemorySource::GetStagedMisses();
+            const bool extracted = EntityExtractor::ExtractNpc(*renderableNpc, character, worker.recordCache, worker.shapeCache);
+            if (SettleEntity(worker, ExtractionCategory::Npcs, EntityTypes::NPC, *renderableNpc, extracted, character.data(), misses, context)) {
+                worker.npcs.push_back(renderableNpc);
             }
         }
+        DeferRemaining(worker, ExtractionCategory::Npcs, EntityTypes::NPC,
+            std::span<const SafeAccess::ValidatedSlot>(worker.npcSlots).subspan(npcIndex), npcPool, worker.npcs, context);
+
+        for (const NpcEntity* previous : worker.staleNpcs) {
+            NpcEntity* staleNpc = CopyStale(npcPool, *previous, context.now);
+            if (!staleNpc) break;
+
+            // Not read this pass, but still present: keep its record from being swept
+            worker.recordCache.Touch(staleNpc->GetCombatKey(), EntityTypes::NPC);
+            worker.npcs.push_back(staleNpc);
+        }
     }
 
-    void DataExtractor::ExtractAttackTargetData(ObjectPool<AttackTargetEntity>& attackTargetPool,
-        std::vector<AttackTargetEntity*>& attackTargets,
-        FrameGameData& pooledData) {
-        attackTargets.clear();
-        attackTargets.reserve(EntityLimits::MAX_ATTACK_TARGETS);
+    void DataExtractor::ExtractGadgetData(ExtractionWorker& worker,
+        ObjectPoolSlice<GadgetEntity>& gadgetPool,
+        std::span<const SafeAccess::ValidatedSlot> gadgetSlots,
+        const ExtractionContext& context) {
+        const SafeAccess::SafeGameArray<ReClass::GdCliGadget>::ValidatedView gadgetList(gadgetSlots);
+        const PrefetchPipeline<ReClass::GdCliGadget, ReClass::AgKeyFramed> pipeline(gadgetSlots, PrefetchDistance(context));
+        size_t index = 0;
+        for (const auto& gadget : gadgetList) {
+            if (context.BudgetExhausted()) break;
+            pipeline.Advance(index++);
 
-        void* pContextCollection = AddressManager::GetContextCollectionPtr();
-        if (!pContextCollection) return;
+            GadgetEntity* renderableGadget = gadgetPool.Get();
+            if (!renderableGadget) break; // Pool exhausted
 
-        ReClass::ContextCollection ctxCollection(pContextCollection);
-        ReClass::GdCliContext gadgetContext = ctxCollection.GetGdCliContext();
-        if (!gadgetContext.data()) return;
+            // Delegate all extraction logic to the helper class
+            StaticGadgetCache::Lookup staticLookup;
+            staticLookup.cached = context.staticGadgets.Find(gadget.data());
+            const uint64_t misses = MemorySource::GetStagedMisses();
+            const bool extracted = EntityExtractor::ExtractGadget(*renderableGadget, gadget, worker.shapeCache, staticLookup);
+            if (SettleEntity(worker, ExtractionCategory::Gadgets, EntityTypes::Gadget, *renderableGadget, extracted, gadget.data(), misses, context)) {
+                worker.gadgets.push_back(renderableGadget);
 
-        auto attackTargetList = gadgetContext.GetAttackTargets();
+                // Static gadgets read in full are stored after the join (the cache is shared);
+                // one kept from the previous frame was not read
+                if (renderableGadget->isStale) continue;
+                if (staticLookup.hit) {
+                    ++worker.staticGadgetHits;
+                } else if (context.staticGadgets.IsEnabled() && StaticGadgetCache::IsStaticType(renderableGadget->type)) {
+                    worker.staticGadgetStores.emplace_back(gadget.data(), StaticGadgetCache::Capture(*renderableGadget, staticLookup.coKeyframed));
+                }
+            }
+        }
+        DeferRemaining(worker, ExtractionCategory::Gadgets, EntityTypes::Gadget,
+            gadgetSlots.subspan(index), gadgetPool, worker.gadgets, context);
+    }
+
+    void DataExtractor::ExtractAttackTargetData(ExtractionWorker& worker,
+        ObjectPoolSlice<AttackTargetEntity>& attackTargetPool,
+        std::span<const SafeAccess::ValidatedSlot> attackTargetSlots,
+        const ExtractionContext& context) {
+        const SafeAccess::SafeGameArray<ReClass::AgentInl>::ValidatedView attackTargetList(attackTargetSlots);
+        size_t index = 0;
         for (const auto& agentInl : attackTargetList) {
+            if (context.BudgetExhausted()) break;
+            ++index;
+
             AttackTargetEntity* renderableAttackTarget = attackTargetPool.Get();
             if (!renderableAttackTarget) break; // Pool exhausted
 
             // Delegate all extraction logic to the helper class
-            if (EntityExtractor::ExtractAttackTarget(*renderableAttackTarget, agentInl)) {
-                attackTargets.push_back(renderableAttackTarget);
-                pooledData.entityMap[static_cast<uint32_t>(renderableAttackTarget->agentId)] = renderableAttackTarget;
+            const uint64_t misses = MemorySource::GetStagedMisses();
+            const bool extracted = EntityExtractor::ExtractAttackTarget(*renderableAttackTarget, agentInl, worker.shapeCache);
+            if (SettleEntity(worker, ExtractionCategory::AttackTargets, EntityTypes::AttackTarget, *renderableAttackTarget, extracted, agentInl.data(), misses, context)) {
+                worker.attackTargets.push_back(renderableAttackTarget);
             }
         }
+        DeferRemaining(worker, ExtractionCategory::AttackTargets, EntityTypes::AttackTarget,
+            attackTargetSlots.subspan(index), attackTargetPool, worker.attackTargets, context);
     }
 
-    void DataExtractor::ExtractItemData(ObjectPool<ItemEntity>& itemPool,
-        std::vector<ItemEntity*>& items,
-        FrameGameData& pooledData) {
-        items.clear();
-        items.reserve(EntityLimits::MAX_ITEMS);
-
-        void* pContextCollection = AddressManager::GetContextCollectionPtr();
-        if (!pContextCollection) return;
-
-        ReClass::ContextCollection ctxCollection(pContextCollection);
-        ReClass::ItCliContext itemContext = ctxCollection.GetItCliContext();
-        if (!itemContext.data()) return;
-
-        auto itemList = itemContext.GetItems();
+    void DataExtractor::ExtractItemData(ExtractionWorker& worker,
+        ObjectPoolSlice<ItemEntity>& itemPool,
+        std::span<const SafeAccess::ValidatedSlot> itemSlots,
+        const ExtractionContext& context) {
+        // The slots come from the ground item index: equipment items never reach this loop
+        const SafeAccess::SafeGameArray<ReClass::ItCliItem>::ValidatedView itemList(itemSlots);
+        size_t index = 0;
         for (const auto& item : itemList) {
-            // Pre-filter: Don't waste a pool slot on equipment items
-            // Only process items with LocationType == Agent (ground loot)
-            if (item.GetLocationType() != Game::ItemLocation::Agent) {
-                continue;
-            }
+            if (context.BudgetExhausted()) break;
+            ++index;
 
             ItemEntity* renderableItem = itemPool.Get();
             if (!renderableItem) break; // Pool exhausted
 
             // Delegate all extraction logic to the helper class
             // Note: ExtractItem also checks LocationType as a double-safety check
-            if (EntityExtractor::ExtractItem(*renderableItem, item)) {
-                items.push_back(renderableItem);
-                pooledData.entityMap[static_cast<uint32_t>(renderableItem->agentId)] = renderableItem;
+            const uint64_t misses = MemorySource::GetStagedMisses();
+            const bool extracted = EntityExtractor::ExtractItem(*renderableItem, item, worker.shapeCache);
+            if (SettleEntity(worker, ExtractionCategory::Items, EntityTypes::Item, *renderableItem, extracted, item.data(), misses, context)) {
+                worker.items.push_back(renderableItem);
             }
         }
+        DeferRemaining(worker, ExtractionCategory::Items, EntityTypes::Item,
+            itemSlots.subspan(index), itemPool, worker.items, context);
     }
 
-} // namespace kx
\ No newline at end of file
+} // namespace kx
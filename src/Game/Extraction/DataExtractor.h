@@ -1,13 +1,19 @@
 #pragma once
 
+#include <span>
 #include <vector>
 #include <ankerl/unordered_dense.h>
 #include "../Data/EntityData.h"
 #include "../Data/FrameData.h"
 #include "../../Utils/ObjectPool.h"
+#include "../../Memory/ValidatedSlot.h"
+#include "ExtractionScheduler.h"
 
 namespace kx {
 
+    struct ExtractionContext;
+    struct ExtractionWorker;
+
     /**
      * @brief Handles data extraction from game memory (Stage 1 of rendering pipeline)
      *
@@ -18,6 +24,14 @@ namespace kx {
      * Performance Optimization:
      * - Implements fail-fast validation of root ContextCollection pointer
      * - Prevents thousands of failed memory reads during loading screens or when game is not ready
+     * - Optional fork-join mode: the validated lists are split across the context's worker
+     *   pool, each participant writing into its own pool slices and output vectors
+     * - Per-category scheduling: lists of categories that are not due are never walked
+     * - Extraction plan: contexts are resolved once per pass, each list is walked at most once,
+     *   and categories no feature consumes are skipped (see ExtractionPlan.h)
+     * - Distance LOD: mid and far entities are read in round-robin slices (see ExtractionLod.h)
+     * - Time budget: participants stop reading at a deadline and the next pass resumes each list
+     *   where this one ran out; unread entities keep their previous values, flagged stale
      */
     class DataExtractor {
     public:
@@ -28,8 +42,14 @@ namespace kx {
          * @param gadgetPool Object pool for gadgets
          * @param attackTargetPool Object pool for attack targets
          * @param itemPool Object pool for items
-         * @param pooledData Output container for pooled data pointers
-         * @param charToNameMap Persistent map for character-to-player-name lookup (cleared each frame, retains capacity)
+         * @param pooledData Output container for pooled data pointers; its stats receive the pass counters
+         * @param context Persistent extraction state (name map, record shards, probe caches, worker pool)
+         * @note Runs in parallel only against live memory; recorded and replayed passes stay on the caller.
+         * @note Only the categories in context.categories are read; the others are copied from
+         *       context.previousFrame into the pools, so the frame is always complete. Categories
+         *       outside context.consumed are skipped entirely and left empty.
+         * @note With context.budgetMicros set, the pass is cut short at the deadline. Entities not
+         *       read yet keep their previous values with their age (GameEntity::staleMs).
          */
         static bool ExtractFrameData(ObjectPool<PlayerEntity>& playerPool,
             ObjectPool<NpcEntity>& npcPool,
@@ -37,30 +57,81 @@ namespace kx {
             ObjectPool<AttackTargetEntity>& attackTargetPool,
             ObjectPool<ItemEntity>& itemPool,
             FrameGameData& pooledData,
-            ankerl::unordered_dense::map<void*, const wchar_t*>& charToNameMap);
+            ExtractionContext& context);
 
     private:
         /**
-         * @brief OPTIMIZED extraction methods - write directly into object pools
+         * @brief Validate and route the lists, run every participant of the context, merge their outputs
+         * @return False if the game context is not available
          */
-        static void ExtractCharacterData(ObjectPool<PlayerEntity>& playerPool,
+        static bool ExtractPass(ObjectPool<PlayerEntity>& playerPool,
             ObjectPool<NpcEntity>& npcPool,
-            std::vector<PlayerEntity*>& players,
-            std::vector<NpcEntity*>& npcs,
+            ObjectPool<GadgetEntity>& gadgetPool,
+            ObjectPool<AttackTargetEntity>& attackTargetPool,
+            ObjectPool<ItemEntity>& itemPool,
             FrameGameData& pooledData,
-            const ankerl::unordered_dense::map<void*, const wchar_t*>& characterToPlayerNameMap);
+            ExtractionContext& context);
+
+        /**
+         * @brief Move a category's sweep cursor past what this pass read and record sweep completion
+         * @param listSize Entities the category had to read this pass
+         */
+        static void AdvanceSweep(ExtractionContext& context,
+            ExtractionCategory category,
+            size_t listSize,
+            ExtractionStats& stats);
+
+        /**
+         * @brief Pool slices and list ranges assigned to one participant
+         */
+        struct ParticipantRanges {
+            ObjectPoolSlice<PlayerEntity> players;
+            ObjectPoolSlice<NpcEntity> npcs;
+            ObjectPoolSlice<GadgetEntity> gadgets;
+            ObjectPoolSlice<AttackTargetEntity> attackTargets;
+            ObjectPoolSlice<ItemEntity> items;
+            size_t gadgetBegin = 0, gadgetEnd = 0;
+            size_t attackTargetBegin = 0, attackTargetEnd = 0;
+            size_t itemBegin = 0, itemEnd = 0;
+        };
+
+        /**
+         * @brief Extract every entity assigned to one participant (runs on that participant's thread)
+         */
+        static void ExtractParticipant(ExtractionWorker& worker,
+            ParticipantRanges& ranges,
+            std::span<const SafeAccess::ValidatedSlot> gadgets,
+            std::span<const SafeAccess::ValidatedSlot> attackTargets,
+            std::span<const SafeAccess::ValidatedSlot> items,
+            void* localPlayerPtr,
+            ExtractionCategoryMask due,
+            const ExtractionContext& context);
+
+        /**
+         * @brief OPTIMIZED extraction methods - write directly into pool slices
+         *
+         * Each stops at the context's deadline and keeps the previous values of the rest of its slots.
+         */
+        static void ExtractCharacterData(ExtractionWorker& worker,
+            ObjectPoolSlice<PlayerEntity>& playerPool,
+            ObjectPoolSlice<NpcEntity>& npcPool,
+            void* localPlayerPtr,
+            const ExtractionContext& context);
 
-        static void ExtractGadgetData(ObjectPool<GadgetEntity>& gadgetPool,
-            std::vector<GadgetEntity*>& gadgets,
-            FrameGameData& pooledData);
+        static void ExtractGadgetData(ExtractionWorker& worker,
+            ObjectPoolSlice<GadgetEntity>& gadgetPool,
+            std::span<const SafeAccess::ValidatedSlot> gadgetSlots,
+            const ExtractionContext& context);
 
-        static void ExtractAttackTargetData(ObjectPool<AttackTargetEntity>& attackTargetPool,
-            std::vector<AttackTargetEntity*>& attackTargets,
-            FrameGameData& pooledData);
+        static void ExtractAttackTargetData(ExtractionWorker& worker,
+            ObjectPoolSlice<AttackTargetEntity>& attackTargetPool,
+            std::span<const SafeAccess::ValidatedSlot> attackTargetSlots,
+            const ExtractionContext& context);
 
-        static void ExtractItemData(ObjectPool<ItemEntity>& itemPool,
-            std::vector<ItemEntity*>& items,
-            FrameGameData& pooledData);
+        static void ExtractItemData(ExtractionWorker& worker,
+            ObjectPoolSlice<ItemEntity>& itemPool,
+            std::span<const SafeAccess::ValidatedSlot> itemSlots,
+            const ExtractionContext& context);
     };
 
 } // namespace kx
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "EntityEventDiff.h"
+#include <algorithm>
+
+namespace kx {
+
+namespace {
+
+    uintptr_t AddressOf(const void* address) {
+        return reinterpret_cast<uintptr_t>(address);
+    }
+
+    // Identity order: agentId first; the address only separates keys without an agentId
+    template<typename K>
+    bool IdentityBefore(const K& a, const K& b) {
+        if (a.agentId != b.agentId) {
+            return a.agentId < b.agentId;
+        }
+        return a.agentId == 0 && AddressOf(a.address) < AddressOf(b.address);
+    }
+
+    template<typename K>
+    EntityEvent MakeEvent(EntityEventKind kind, const K& key) {
+        return { kind, key.entityType, key.agentId, key.address, nullptr };
+    }
+
+} // namespace
+
+void EntityEventDiff::Diff(std::vector<EntityEvent>& outEvents) {
+    outEvents.clear();
+
+    // Full (agentId, address) order refines the identity order, so the first of a run of
+    // duplicates is picked the same way every frame
+    std::sort(m_current.begin(), m_current.end(), [](const Key& a, const Key& b) {
+        return a.agentId != b.agentId ? a.agentId < b.agentId : AddressOf(a.address) < AddressOf(b.address);
+    });
+    m_current.erase(std::unique(m_current.begin(), m_current.end(), [](const Key& a, const Key& b) {
+        return !IdentityBefore(a, b) && !IdentityBefore(b, a);
+    }), m_current.end());
+
+    size_t previous = 0;
+    size_t current = 0;
+    while (previous < m_previous.size() && current < m_current.size()) {
+        const Key& before = m_previous[previous];
+        const Key& now = m_current[current];
+        if (IdentityBefore(before, now)) {
+            outEvents.push_back(MakeEvent(EntityEventKind::Despawned, before));
+            ++previous;
+        } else if (IdentityBefore(now, before)) {
+            outEvents.push_back(MakeEvent(EntityEventKind::Spawned, now));
+            ++current;
+        } else {
+            if (now.address != before.address || now.entityType != before.entityType) {
+                EntityEvent event = MakeEvent(EntityEventKind::Respawned, now);
+                event.previousAddress = before.address;
+                outEvents.push_back(event);
+            }
+            ++previous;
+            ++current;
+        }
+    }
+    for (; previous < m_previous.size(); ++previous) {
+        outEvents.push_back(MakeEvent(EntityEventKind::Despawned, m_previous[previous]));
+    }
+    for (; current < m_current.size(); ++current) {
+        outEvents.push_back(MakeEvent(EntityEventKind::Spawned, m_current[current]));
+    }
+
+    m_previous.swap(m_current);
+    m_current.clear();
+}
+
+void EntityEventDiff::Clear() {
+    m_previous.clear();
+    m_current.clear();
+}
+
+} // namespace kx
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Data/EntityEvent.h"
+
+namespace kx {
+
+/**
+ * @brief Spawn/despawn/respawn events from the entity keys of two consecutive frames
+ *
+ * Each frame's keys are sorted once and merged linearly with the previous frame's, so
+ * consumers get O(changes) events instead of rebuilding a set of every live entity.
+ * Keys are compared like CombatStateKey: by agentId, or by address when the agentId is 0.
+ *
+ * Usage per published frame:
+ * 1. Add() every entity of the new frame
+ * 2. Diff() writes the events and makes the new frame the previous one
+ */
+class EntityEventDiff {
+public:
+    EntityEventDiff() = default;
+
+    /**
+     * @brief Add an entity of the frame being built
+     * Duplicates of a key (same agentId in two categories) count once.
+     */
+    void Add(uint32_t agentId, const void* address, EntityTypes entityType) {
+        m_current.push_back({ agentId, address, entityType });
+    }
+
+    /**
+     * @brief Compare the added keys with the previous frame's
+     * @param outEvents Cleared, then filled with the changes in key order
+     */
+    void Diff(std::vector<EntityEvent>& outEvents);
+
+    /**
+     * @brief Keys of the last diffed frame
+     */
+    [[nodiscard]] size_t GetPreviousSize() const { return m_previous.size(); }
+
+    /**
+     * @brief Forget both frames: the next Diff() reports every key as spawned
+     */
+    void Clear();
+
+private:
+    struct Key {
+        uint32_t agentId;
+        const void* address;
+        EntityTypes entityType;
+    };
+
+    std::vector<Key> m_previous;    // Sorted, unique
+    std::vector<Key> m_current;
+};
+
+} // namespace kx
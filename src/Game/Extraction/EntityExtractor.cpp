@@ -1,8 +1,11 @@
 #include "EntityExtractor.h"
+#include "EntityRecordCache.h"
+#include "ShapeDimensionCache.h"
+#include <cstring>
 #include "../GameEnums.h"
 #include "../SDK/HavokStructs.h"
-#include "../../Utils/StringHelpers.h"
 #include "../../Memory/Safety.h"
+#include "../../Memory/MemorySource.h"
 
 #include "../../Features/Visuals/Presentation/Formatting.h"
 
@@ -21,145 +24,241 @@ namespace PhysicsValidation {
     constexpr float WIDTH_TO_HEIGHT_RATIO = 0.35f;  // 35% - typical humanoid/object proportions
 }
 
-    bool EntityExtractor::ExtractPlayer(PlayerEntity& outPlayer,
-        const ReClass::ChCliCharacter& inCharacter,
-        const wchar_t* playerName,
-        void* localPlayerPtr) {
+namespace {
+    // Primitive type byte at shape + 0x10, the validity tag of shape cache entries
+    uint8_t ReadShapeTypeTag(const void* shapePtr) {
+        return MemorySource::Read<uint8_t>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpShapeBase::SHAPE_TYPE_PRIMITIVE,
+            static_cast<uint8_t>(Havok::HkcdShapeType::INVALID));
+    }
+
+    // 64-bit mix of the gear slot pointers; equal fingerprints mean the same items in the same slots
+    uint64_t FingerprintGearSlots(const ReClass::ChCliInventory::GearSlots& slots) {
+        uint64_t hash = 0x9E3779B97F4A7C15ull;
+        for (const void* item : slots) {
+            hash = (hash ^ reinterpret_cast<uintptr_t>(item)) * 0xFF51AFD7ED558CCDull;
+            hash ^= hash >> 32;
+        }
+        return hash;
+    }
+
+    bool IsZeroPosition(const glm::vec3& position) {
+        return position.x == 0.0f && position.y == 0.0f && position.z == 0.0f;
+    }
+
+    // Per-frame members of a character: one bulk copy of the character and one of its agent
+    struct CharacterCore {
+        ReClass::ChCliCharacter::Fields fields;
+        ReClass::AgChar agent{ nullptr };
+        ReClass::AgChar::Header header;
+        glm::vec3 gamePos{ 0.0f };
+    };
+
+    bool ReadCharacterCore(const ReClass::ChCliCharacter& character, CharacterCore& out) {
+        out.fields = character.ReadFields();
+        if (!out.fields.loaded) return false;
 
         // --- TYPE GUARD: Verify this memory actually belongs to a Character ---
         // Prevents "Ghost ESP" from stale pointers that have been reused for other entity types
-        ReClass::AgChar agent = inCharacter.GetAgent();
-        if (!agent.isValid()) return false;
-        
-        const Game::AgentType agentType = agent.GetType();
-        if (agentType != Game::AgentType::Character) {
+        out.agent = ReClass::AgChar(out.fields.agent);
+        if (!out.agent.isValid()) return false;
+
+        out.header = out.agent.ReadHeader();
+        if (!out.header.loaded || out.header.type != Game::AgentType::Character) {
             return false; // This is a stale pointer or reused address (e.g., now a Gadget)
         }
 
         // --- Agent ID Sanity Check ---
-        const int32_t agentId = agent.GetId();
-        if (!SafeAccess::IsAgentIdSane(agentId)) {
+        if (!SafeAccess::IsAgentIdSane(out.header.id)) {
             return false; // Garbage memory or corrupted agent ID
         }
 
-        // --- Validation and Position ---
-        glm::vec3 gamePos;
-        if (!ValidateAndExtractGamePosition(inCharacter, gamePos)) return false;
+        // --- Position ---
+        ReClass::CoChar coChar(out.header.coChar);
+        if (!coChar) return false;
+
+        out.gamePos = coChar.GetVisualPosition();
+        return !IsZeroPosition(out.gamePos);
+    }
+
+    // Per-frame members of a keyframed agent (gadgets, attack targets, items)
+    struct KeyframedCore {
+        ReClass::AgKeyFramed::Header header;
+        ReClass::CoKeyFramed coKeyframed{ nullptr };
+        glm::vec3 gamePos{ 0.0f };
+    };
+
+    // Resolves the coordinate system and position named by an already-read header
+    bool ReadKeyframedPosition(KeyframedCore& core) {
+        core.coKeyframed = ReClass::CoKeyFramed(core.header.coKeyframed);
+        if (!core.coKeyframed) return false;
+
+        core.gamePos = core.coKeyframed.GetPosition();
+        return !IsZeroPosition(core.gamePos);
+    }
+
+    bool ReadKeyframedCore(const ReClass::AgKeyFramed& agent, KeyframedCore& core) {
+        if (!agent) return false;
+
+        core.header = agent.ReadHeader();
+        return core.header.loaded && ReadKeyframedPosition(core);
+    }
+}
+
+    bool EntityExtractor::ExtractPlayer(PlayerEntity& outPlayer,
+        const ReClass::ChCliCharacter& inCharacter,
+        const PlayerRoster::Entry* rosterEntry,
+        void* localPlayerPtr,
+        EntityRecordCache& recordCache,
+        ShapeDimensionCache& shapeCache) {
+
+        // --- Type guard, agent ID and position ---
+        CharacterCore core;
+        if (!ReadCharacterCore(inCharacter, core)) return false;
+        const int32_t agentId = core.header.id;
 
         // --- Populate Core Data ---
-        outPlayer.position = TransformGamePositionToMumble(gamePos);
+        outPlayer.position = TransformGamePositionToMumble(core.gamePos);
         outPlayer.isValid = true;
         outPlayer.entityType = EntityTypes::Player;
         outPlayer.address = inCharacter.data();
         outPlayer.isLocalPlayer = (outPlayer.address == localPlayerPtr);
-        if (playerName) {
-            StringHelpers::WriteWCharToUTF8(playerName, outPlayer.playerName);
+        // The roster converted the name when the player showed up. An entry bound to another
+        // agent is stale: the name stays empty until the roster re-reads it next pass.
+        if (rosterEntry && (rosterEntry->agentId == 0 || rosterEntry->agentId == agentId)) {
+            std::memcpy(outPlayer.playerName, rosterEntry->name, sizeof(outPlayer.playerName));
         } else {
             outPlayer.playerName[0] = '\0';
         }
 
         // --- Agent Info (using pre-validated agent reference) ---
-        outPlayer.agentType = agentType;
+        outPlayer.agentType = core.header.type;
         outPlayer.agentId = agentId;
-        outPlayer.agent = agent.data();
+        outPlayer.agent = core.agent.data();
 
         // --- Health & Energy ---
-        ReClass::ChCliHealth health = inCharacter.GetHealth();
-        ExtractHealthData(outPlayer, health);
+        ExtractHealthData(outPlayer, ReClass::ChCliHealth(core.fields.health));
 
         // Dodge Endurance
-        ReClass::ChCliEndurance endurance = inCharacter.GetEndurance();
+        ReClass::ChCliEndurance endurance(core.fields.endurance);
         if (endurance) {
-            outPlayer.currentEndurance = endurance.GetCurrent();
-            outPlayer.maxEndurance = endurance.GetMax();
+            const ReClass::ChCliEndurance::Values values = endurance.ReadValues();
+            outPlayer.currentEndurance = values.current;
+            outPlayer.maxEndurance = values.max;
         }
 
         // Energy
-        ReClass::ChCliEnergies energies = inCharacter.GetEnergies();
+        ReClass::ChCliEnergies energies(core.fields.energies);
         if (energies) {
-            outPlayer.currentEnergy = energies.GetCurrent();
-            outPlayer.maxEnergy = energies.GetMax();
+            const ReClass::ChCliEnergies::Values values = energies.ReadValues();
+            outPlayer.currentEnergy = values.current;
+            outPlayer.maxEnergy = values.max;
+        }
+
+        outPlayer.attitude = core.fields.attitude;
+
+        // --- Stable Tier: read on a slow cadence, copied from the record otherwise ---
+        EntityRecord& record = recordCache.Touch(outPlayer.GetCombatKey(), EntityTypes::Player);
+        if (recordCache.NeedsStableRefresh(record)) {
+            ExtractPlayerStableData(outPlayer, inCharacter, record.stable, shapeCache);
+            record.stable.CaptureFrom(outPlayer);
+            recordCache.MarkStableRefreshed(record, static_cast<uint32_t>(agentId));
+        } else {
+            record.stable.ApplyTo(outPlayer);
         }
 
+        return true;
+    }
+
+    void EntityExtractor::ExtractPlayerStableData(PlayerEntity& outPlayer, const ReClass::ChCliCharacter& inCharacter,
+        CharacterStableFields& stable, ShapeDimensionCache& shapeCache) {
         // --- Core Stats ---
         ReClass::ChCliCoreStats coreStats = inCharacter.GetCoreStats();
         if (coreStats) {
-            outPlayer.level = coreStats.GetLevel();
-            outPlayer.scaledLevel = coreStats.GetScaledLevel();
-            outPlayer.profession = coreStats.GetProfession();
-            outPlayer.attitude = inCharacter.GetAttitude();
-            outPlayer.race = coreStats.GetRace();
+            const ReClass::ChCliCoreStats::Values stats = coreStats.ReadValues();
+            outPlayer.level = stats.level;
+            outPlayer.scaledLevel = stats.scaledLevel;
+            outPlayer.profession = stats.profession;
+            outPlayer.race = stats.race;
         }
 
         // --- Gear ---
         ReClass::ChCliInventory inventory = inCharacter.GetInventory();
         if (inventory) {
-            ExtractGear(outPlayer, inventory);
+            ExtractGear(outPlayer, inventory, stable);
+        } else {
+            stable.ForgetGearFingerprint();
         }
         
         // --- Physics Shape Dimensions ---
-        ExtractPlayerShapeDimensions(outPlayer, inCharacter);
-
-        return true;
+        ExtractPlayerShapeDimensions(outPlayer, inCharacter, shapeCache);
     }
 
-    bool EntityExtractor::ExtractNpc(NpcEntity& outNpc, const ReClass::ChCliCharacter& inCharacter) {
-
-        // --- TYPE GUARD: Verify this memory actually belongs to a Character ---
-        ReClass::AgChar agent = inCharacter.GetAgent();
-        if (!agent.isValid()) return false;
-        
-        const Game::AgentType agentType = agent.GetType();
-        if (agentType != Game::AgentType::Character) {
-            return false; // Stale pointer or type mismatch
-        }
-
-        // --- Agent ID Sanity Check ---
-        const int32_t agentId = agent.GetId();
-        if (!SafeAccess::IsAgentIdSane(agentId)) {
-            return false; // Corrupted or invalid agent ID
-        }
+    bool EntityExtractor::ExtractNpc(NpcEntity& outNpc,
+        const ReClass::ChCliCharacter& inCharacter,
+        EntityRecordCache& recordCache,
+        ShapeDimensionCache& shapeCache) {
 
-        // --- Validation and Position ---
-        glm::vec3 gamePos;
-        if (!ValidateAndExtractGamePosition(inCharacter, gamePos)) return false;
+        // --- Type guard, agent ID and position ---
+        CharacterCore core;
+        if (!ReadCharacterCore(inCharacter, core)) return false;
+        const int32_t agentId = core.header.id;
 
         // --- Populate Core Data ---
-        outNpc.position = TransformGamePositionToMumble(gamePos);
+        outNpc.position = TransformGamePositionToMumble(core.gamePos);
         outNpc.isValid = true;
         outNpc.entityType = EntityTypes::NPC;
         outNpc.address = inCharacter.data();
 
         // --- Agent Info (using pre-validated agent reference) ---
-        outNpc.agentType = agentType;
+        outNpc.agentType = core.header.type;
         outNpc.agentId = agentId;
-        outNpc.agent = agent.data();
+        outNpc.agent = core.agent.data();
 
         // --- Health ---
-        ReClass::ChCliHealth health = inCharacter.GetHealth();
-        ExtractHealthData(outNpc, health);
+        ExtractHealthData(outNpc, ReClass::ChCliHealth(core.fields.health));
 
+        outNpc.attitude = core.fields.attitude;
+
+        // --- Stable Tier: read on a slow cadence, copied from the record otherwise ---
+        EntityRecord& record = recordCache.Touch(outNpc.GetCombatKey(), EntityTypes::NPC);
+        if (recordCache.NeedsStableRefresh(record)) {
+            ExtractNpcStableData(outNpc, inCharacter, shapeCache);
+            record.stable.CaptureFrom(outNpc);
+            recordCache.MarkStableRefreshed(record, static_cast<uint32_t>(agentId));
+        } else {
+            record.stable.ApplyTo(outNpc);
+        }
+
+        return true;
+    }
+
+    void EntityExtractor::ExtractNpcStableData(NpcEntity& outNpc, const ReClass::ChCliCharacter& inCharacter, ShapeDimensionCache& shapeCache) {
         // --- Stats ---
         ReClass::ChCliCoreStats coreStats = inCharacter.GetCoreStats();
         if (coreStats) {
             outNpc.level = coreStats.GetLevel();
         }
-        outNpc.attitude = inCharacter.GetAttitude();
         outNpc.rank = inCharacter.GetRank();
         
         // --- Physics Shape Dimensions ---
-        ExtractNpcShapeDimensions(outNpc, inCharacter);
-
-        return true;
+        ExtractNpcShapeDimensions(outNpc, inCharacter, shapeCache);
     }
 
-    bool EntityExtractor::ExtractGadget(GadgetEntity& outGadget, const ReClass::GdCliGadget& inGadget) {
+    bool EntityExtractor::ExtractGadget(GadgetEntity& outGadget, const ReClass::GdCliGadget& inGadget, ShapeDimensionCache& shapeCache,
+        StaticGadgetCache::Lookup& staticLookup) {
+
+        const ReClass::GdCliGadget::Fields fields = inGadget.ReadFields();
+        if (!fields.loaded) return false;
 
         // --- TYPE GUARD: Verify this memory actually belongs to a Gadget ---
-        ReClass::AgKeyFramed agent = inGadget.GetAgKeyFramed();
+        ReClass::AgKeyFramed agent(fields.agKeyframed);
         if (!agent.isValid()) return false;
+
+        KeyframedCore core;
+        core.header = agent.ReadHeader();
+        if (!core.header.loaded) return false;
         
-        const Game::AgentType agentType = agent.GetType();
+        const Game::AgentType agentType = core.header.type;
         // Gadgets can be type 10 (Gadget) or 11 (GadgetAttackTarget)
         if (agentType != Game::AgentType::Gadget && 
             agentType != Game::AgentType::GadgetAttackTarget) {
@@ -167,22 +266,30 @@ namespace PhysicsValidation {
         }
 
         // --- Agent ID Sanity Check ---
-        const int32_t agentId = agent.GetId();
+        const int32_t agentId = core.header.id;
         if (!SafeAccess::IsAgentIdSane(agentId)) {
             return false; // Invalid agent ID
         }
 
+        // --- Static gadget still in place: position and shape come from the cache ---
+        staticLookup.coKeyframed = core.header.coKeyframed;
+        staticLookup.hit = staticLookup.cached && core.header.coKeyframed &&
+            staticLookup.cached->Matches(fields.agKeyframed, agentId, agentType, core.header.coKeyframed, fields.type);
+
         // --- Validation and Position ---
-        glm::vec3 gamePos;
-        if (!ValidateAndExtractGamePosition(inGadget, gamePos)) return false;
+        if (staticLookup.hit) {
+            staticLookup.cached->ApplyTo(outGadget);
+        } else {
+            if (!ReadKeyframedPosition(core)) return false;
+            outGadget.position = TransformGamePositionToMumble(core.gamePos);
+        }
 
         // --- Populate Core Data ---
-        outGadget.position = TransformGamePositionToMumble(gamePos);
         outGadget.isValid = true;
         outGadget.entityType = EntityTypes::Gadget;
         outGadget.address = inGadget.data();
-        outGadget.type = inGadget.GetGadgetType();
-        outGadget.isGatherable = inGadget.IsGatherable();
+        outGadget.type = fields.type;
+        outGadget.isGatherable = fields.isGatherable;
 
         // --- Agent Info (using pre-validated agent reference) ---
         outGadget.agentType = agentType;
@@ -190,44 +297,48 @@ namespace PhysicsValidation {
         outGadget.agent = agent.data();
 
         // --- Health ---
-        ReClass::GdCliHealth health = inGadget.GetHealth();
-        ExtractHealthData(outGadget, health);
+        ExtractHealthData(outGadget, ReClass::GdCliHealth(fields.health));
 
         if (outGadget.type == Game::GadgetType::ResourceNode) {
-            outGadget.resourceType = inGadget.GetResourceNodeType();
+            outGadget.resourceType = fields.resourceType;
         }
         
         // --- Physics Shape Dimensions ---
-        ExtractShapeDimensions(outGadget, inGadget);
+        if (!staticLookup.hit) {
+            ExtractShapeDimensionsFromCoKeyframed(outGadget, core.coKeyframed, shapeCache);
+        }
 
         return true;
     }
 
     bool EntityExtractor::ExtractAttackTarget(AttackTargetEntity& outAttackTarget,
-        const ReClass::AgentInl& inAgentInl) {
+        const ReClass::AgentInl& inAgentInl,
+        ShapeDimensionCache& shapeCache) {
 
         if (!inAgentInl) return false;
 
+        const ReClass::AgentInl::Fields fields = inAgentInl.ReadFields();
+
         // --- Get AgKeyFramed for agent type/ID, position, and physics dimensions ---
-        ReClass::AgKeyFramed agKeyframed = inAgentInl.GetAgKeyFramed();
+        ReClass::AgKeyFramed agKeyframed(fields.agKeyframed);
         if (!agKeyframed) return false;
 
         // --- Position ---
         // Use position from AgKeyFramed->CoKeyFramed (AgentInl position appears to be in wrong coordinate system)
-        glm::vec3 gamePos;
-        if (!ValidateAndExtractGamePosition(agKeyframed, gamePos)) return false;
+        KeyframedCore core;
+        if (!ReadKeyframedCore(agKeyframed, core)) return false;
 
         // --- Populate Core Data ---
-        outAttackTarget.position = TransformGamePositionToMumble(gamePos);
+        outAttackTarget.position = TransformGamePositionToMumble(core.gamePos);
         outAttackTarget.isValid = true;
         outAttackTarget.entityType = EntityTypes::AttackTarget;
         outAttackTarget.address = inAgentInl.data();
-        outAttackTarget.agentType = agKeyframed.GetType();
-        outAttackTarget.agentId = agKeyframed.GetId();
+        outAttackTarget.agentType = core.header.type;
+        outAttackTarget.agentId = core.header.id;
         outAttackTarget.agent = agKeyframed.data();
 
         // --- Combat State ---
-        outAttackTarget.combatState = inAgentInl.GetCombatState();
+        outAttackTarget.combatState = fields.combatState;
 
         // Health data not available - AgentInl health pointer not confirmed/working
         outAttackTarget.currentHealth = 0.0f;
@@ -235,12 +346,12 @@ namespace PhysicsValidation {
         outAttackTarget.currentBarrier = 0.0f;
 
         // --- Physics Shape Dimensions ---
-        ExtractBoxShapeDimensions(outAttackTarget, agKeyframed);
+        ExtractShapeDimensionsFromCoKeyframed(outAttackTarget, core.coKeyframed, shapeCache);
 
         return true;
     }
 
-    bool EntityExtractor::ExtractItem(ItemEntity& outItem, const ReClass::ItCliItem& inItem) {
+    bool EntityExtractor::ExtractItem(ItemEntity& outItem, const ReClass::ItCliItem& inItem, ShapeDimensionCache& shapeCache) {
         if (!inItem) return false;
 
         // --- Check Location Type ---
@@ -261,16 +372,16 @@ namespace PhysicsValidation {
         if (!agKeyFramed) return false;
 
         // --- Position ---
-        glm::vec3 gamePos;
-        if (!ValidateAndExtractGamePosition(agKeyFramed, gamePos)) return false;
+        KeyframedCore core;
+        if (!ReadKeyframedCore(agKeyFramed, core)) return false;
 
         // --- Populate Core Data ---
-        outItem.position = TransformGamePositionToMumble(gamePos);
+        outItem.position = TransformGamePositionToMumble(core.gamePos);
         outItem.isValid = true;
         outItem.entityType = EntityTypes::Item;
         outItem.address = inItem.data();
-        outItem.agentType = agKeyFramed.GetType();
-        outItem.agentId = agKeyFramed.GetId();
+        outItem.agentType = core.header.type;
+        outItem.agentId = core.header.id;
         outItem.agent = agKeyFramed.data();
 
         // --- Get Definition Info ---
@@ -282,12 +393,12 @@ namespace PhysicsValidation {
 
         // --- Physics Shape Dimensions ---
         // AgKeyFramed handles physics exactly like Gadgets
-        ExtractBoxShapeDimensions(outItem, agKeyFramed);
+        ExtractShapeDimensionsFromCoKeyframed(outItem, core.coKeyframed, shapeCache);
 
         return true;
     }
 
-    void EntityExtractor::ExtractGear(PlayerEntity& outPlayer, const ReClass::ChCliInventory& inventory) {
+    void EntityExtractor::ExtractGear(PlayerEntity& outPlayer, const ReClass::ChCliInventory& inventory, CharacterStableFields& stable) {
         // Note: gearCount is already initialized to 0 by PlayerEntity constructor (via ObjectPool placement-new)
         
         static constexpr Game::EquipmentSlot slotsToCheck[] = {
@@ -299,12 +410,22 @@ namespace PhysicsValidation {
             Game::EquipmentSlot::MainhandWeapon2, Game::EquipmentSlot::OffhandWeapon2
         };
 
+        // --- Fingerprint: unchanged slot pointers mean unchanged gear ---
+        const ReClass::ChCliInventory::GearSlots slots = inventory.ReadGearSlots();
+        if (stable.TryReuseGear(FingerprintGearSlots(slots), outPlayer)) {
+            return;
+        }
+
         for (const auto& slotEnum : slotsToCheck) {
-            ReClass::ItCliItem slot = inventory.GetEquipSlot(static_cast<int>(slotEnum));
+            ReClass::ItCliItem slot(slots[static_cast<size_t>(slotEnum)]);
             if (!slot) continue;
 
             ReClass::ItemDef itemDef = slot.GetItemDefinition();
-            if (!itemDef || itemDef.GetId() == 0) continue;
+            if (!itemDef || itemDef.GetId() == 0) {
+                // An item whose definition did not decode must not be cached under these slot pointers
+                stable.ForgetGearFingerprint();
+                continue;
+            }
 
             GearSlotInfo slotInfo;
             slotInfo.itemId = itemDef.GetId();
@@ -324,44 +445,6 @@ namespace PhysicsValidation {
     }
 
 // Helper method implementations
-bool EntityExtractor::ValidateAndExtractGamePosition(const ReClass::ChCliCharacter& character, glm::vec3& outGamePos) {
-    ReClass::AgChar agent = character.GetAgent();
-    if (!agent) return false;
-
-    ReClass::CoChar coChar = agent.GetCoChar();
-    if (!coChar) return false;
-
-    outGamePos = coChar.GetVisualPosition();
-    if (outGamePos.x == 0.0f && outGamePos.y == 0.0f && outGamePos.z == 0.0f) return false;
-
-    return true;
-}
-
-bool EntityExtractor::ValidateAndExtractGamePosition(const ReClass::GdCliGadget& gadget, glm::vec3& outGamePos) {
-    ReClass::AgKeyFramed agKeyFramed = gadget.GetAgKeyFramed();
-    if (!agKeyFramed) return false;
-
-    ReClass::CoKeyFramed coKeyFramed = agKeyFramed.GetCoKeyFramed();
-    if (!coKeyFramed) return false;
-
-    outGamePos = coKeyFramed.GetPosition();
-    if (outGamePos.x == 0.0f && outGamePos.y == 0.0f && outGamePos.z == 0.0f) return false;
-
-    return true;
-}
-
-bool EntityExtractor::ValidateAndExtractGamePosition(const ReClass::AgKeyFramed& agKeyframed, glm::vec3& outGamePos) {
-    if (!agKeyframed) return false;
-
-    ReClass::CoKeyFramed coKeyFramed = agKeyframed.GetCoKeyFramed();
-    if (!coKeyFramed) return false;
-
-    outGamePos = coKeyFramed.GetPosition();
-    if (outGamePos.x == 0.0f && outGamePos.y == 0.0f && outGamePos.z == 0.0f) return false;
-
-    return true;
-}
-
 glm::vec3 EntityExtractor::TransformGamePositionToMumble(const glm::vec3& gamePos) {
     return glm::vec3(
         gamePos.x / CoordinateTransform::GAME_TO_MUMBLE_SCALE_FACTOR,
@@ -372,21 +455,23 @@ glm::vec3 EntityExtractor::TransformGamePositionToMumble(const glm::vec3& gamePo
 
 void EntityExtractor::ExtractHealthData(GameEntity& entity, const ReClass::ChCliHealth& health) {
     if (health) {
-        entity.currentHealth = health.GetCurrent();
-        entity.maxHealth = health.GetMax();
-        entity.currentBarrier = health.GetBarrier();
+        const ReClass::ChCliHealth::Values values = health.ReadValues();
+        entity.currentHealth = values.current;
+        entity.maxHealth = values.max;
+        entity.currentBarrier = values.barrier;
     }
 }
 
 void EntityExtractor::ExtractHealthData(GameEntity& entity, const ReClass::GdCliHealth& health) {
     if (health) {
-        entity.currentHealth = health.GetCurrent();
-        entity.maxHealth = health.GetMax();
+        const ReClass::GdCliHealth::Values values = health.ReadValues();
+        entity.currentHealth = values.current;
+        entity.maxHealth = values.max;
         entity.currentBarrier = 0.0f;
     }
 }
 
-void EntityExtractor::ExtractPlayerShapeDimensions(GameEntity& entity, const ReClass::ChCliCharacter& character) {
+void EntityExtractor::ExtractPlayerShapeDimensions(GameEntity& entity, const ReClass::ChCliCharacter& character, ShapeDimensionCache& shapeCache) {
     // Navigate: ChCliCharacter -> AgChar -> CoChar -> HkpRigidBody (PLAYER ONLY)
     // Players use HkpRigidBody path at CoChar+0x60 which provides full shape type detection
     // The RigidBody contains an HkpBoxShape at +0x20 (always BOX type for players)
@@ -400,8 +485,14 @@ void EntityExtractor::ExtractPlayerShapeDimensions(GameEntity& entity, const ReC
     ReClass::HkpRigidBody rigidBody = coChar.GetRigidBodyPlayer();
     if (!rigidBody) return;
     
+    // Shape cache: a known shape with an unchanged type byte needs no further reads
+    void* shapePtr = rigidBody.GetShapePtr();
+    if (!shapePtr) return;
+    const uint8_t typeTag = ReadShapeTypeTag(shapePtr);
+    if (shapeCache.TryApply(shapePtr, typeTag, ShapeDimensionCache::Path::PlayerRigidBody, entity)) return;
+    
     // Extract shape type for debug display and validation
-    entity.shapeType = rigidBody.GetShapeType();
+    entity.shapeType = static_cast<Havok::HkcdShapeType>(typeTag);
     
     // Validate shape type: reject INVALID shapes before attempting dimension extraction
     if (entity.shapeType == Havok::HkcdShapeType::INVALID) {
@@ -420,9 +511,10 @@ void EntityExtractor::ExtractPlayerShapeDimensions(GameEntity& entity, const ReC
     entity.physicsDepth = dimensions.y;   // Y is depth
     
     entity.hasPhysicsDimensions = true;
+    shapeCache.Store(shapePtr, typeTag, ShapeDimensionCache::Path::PlayerRigidBody, entity);
 }
 
-void EntityExtractor::ExtractNpcShapeDimensions(GameEntity& entity, const ReClass::ChCliCharacter& character) {
+void EntityExtractor::ExtractNpcShapeDimensions(GameEntity& entity, const ReClass::ChCliCharacter& character, ShapeDimensionCache& shapeCache) {
     // Navigate: ChCliCharacter -> AgChar -> CoChar -> CoCharSimpleCliWrapper -> HkpBoxShape (NPC ONLY)
     // NPCs use HkpBoxShape path at CoCharSimpleCliWrapper+0xE8 (only BOX shapes supported)
     // 
@@ -442,37 +534,28 @@ void EntityExtractor::ExtractNpcShapeDimensions(GameEntity& entity, const ReClas
     ReClass::HkpBoxShape boxShape = wrapper.GetBoxShapeNpc();
     if (!boxShape) return;
     
-    ExtractBoxShapeDimensionsFromHkpBoxShape(entity, boxShape);
-}
-
-void EntityExtractor::ExtractShapeDimensions(GameEntity& entity, const ReClass::GdCliGadget& gadget) {
-    // Navigate: GdCliGadget -> AgKeyFramed -> CoKeyFramed
-    ReClass::AgKeyFramed agent = gadget.GetAgKeyFramed();
-    if (!agent) return;
-    
-    ReClass::CoKeyFramed coKeyframed = agent.GetCoKeyFramed();
-    if (!coKeyframed) return;
-    
-    ExtractShapeDimensionsFromCoKeyframed(entity, coKeyframed);
-}
-
-void EntityExtractor::ExtractBoxShapeDimensions(GameEntity& entity, const ReClass::AgKeyFramed& agKeyframed) {
-    // Navigate: AgKeyFramed -> CoKeyFramed
-    ReClass::CoKeyFramed coKeyframed = agKeyframed.GetCoKeyFramed();
-    if (!coKeyframed) return;
+    const uint8_t typeTag = static_cast<uint8_t>(boxShape.GetShapeType());
+    if (shapeCache.TryApply(boxShape.data(), typeTag, ShapeDimensionCache::Path::NpcBox, entity)) return;
     
-    ExtractShapeDimensionsFromCoKeyframed(entity, coKeyframed);
+    ExtractBoxShapeDimensionsFromHkpBoxShape(entity, boxShape);
+    shapeCache.Store(boxShape.data(), typeTag, ShapeDimensionCache::Path::NpcBox, entity);
 }
 
-void EntityExtractor::ExtractShapeDimensionsFromCoKeyframed(GameEntity& entity, const ReClass::CoKeyFramed& coKeyframed) {
+void EntityExtractor::ExtractShapeDimensionsFromCoKeyframed(GameEntity& entity, const ReClass::CoKeyFramed& coKeyframed, ShapeDimensionCache& shapeCache) {
     // Navigate: CoKeyFramed -> HkpRigidBody
     // This path is used for gadgets and attack targets (AgKeyFramed), which support CYLINDER, BOX, and MOPP shapes.
     // Characters use different extraction functions (ExtractPlayerShapeDimensions or ExtractNpcShapeDimensions).
     ReClass::HkpRigidBody rigidBody = coKeyframed.GetRigidBody();
     if (!rigidBody) return;
     
+    // Shape cache: a known shape with an unchanged type byte needs no further reads
+    void* shapePtr = rigidBody.GetShapePtr();
+    if (!shapePtr) return;
+    const uint8_t typeTag = ReadShapeTypeTag(shapePtr);
+    if (shapeCache.TryApply(shapePtr, typeTag, ShapeDimensionCache::Path::KeyframedRigidBody, entity)) return;
+    
     // Extract shape type for debug display and validation
-    entity.shapeType = rigidBody.GetShapeType();
+    entity.shapeType = static_cast<Havok::HkcdShapeType>(typeTag);
     
     // Validate shape type: reject INVALID shapes before attempting dimension extraction
     if (entity.shapeType == Havok::HkcdShapeType::INVALID) {
@@ -515,6 +598,7 @@ void EntityExtractor::ExtractShapeDimensionsFromCoKeyframed(GameEntity& entity,
     }
     
     entity.hasPhysicsDimensions = true;
+    shapeCache.Store(shapePtr, typeTag, ShapeDimensionCache::Path::KeyframedRigidBody, entity);
 }
 
 void EntityExtractor::ExtractBoxShapeDimensionsFromHkpBoxShape(GameEntity& entity, const ReClass::HkpBoxShape& boxShape) {
@@ -2,9 +2,15 @@
 
 #include "../Data/EntityData.h"
 #include "../SdkStructs.h"
+#include "PlayerRoster.h"
+#include "StaticGadgetCache.h"
 
 namespace kx {
 
+    class EntityRecordCache;
+    class ShapeDimensionCache;
+    struct CharacterStableFields;
+
     /**
      * @brief A static helper class that encapsulates the logic for extracting data
      *        for a single entity from game memory structures into a safe Renderable object.
@@ -15,74 +21,110 @@ namespace kx {
          * @brief Populates a RenderablePlayer object from a ChCliCharacter game structure.
          * @param outPlayer The RenderablePlayer object to populate (from an object pool).
          * @param inCharacter The source ChCliCharacter structure from the game.
-         * @param playerName The player's name, obtained from the player list.
+         * @param rosterEntry The player's roster entry (UTF-8 name), nullptr if unknown.
          * @param localPlayerPtr A pointer to the local player's character object for comparison.
+         * @param recordCache Persistent records; stable fields are copied from here between refreshes.
+         * @param shapeCache Resolved Havok shape dimensions, keyed by shape pointer.
          * @return True if extraction was successful and the entity is valid, false otherwise.
          */
         static bool ExtractPlayer(PlayerEntity& outPlayer,
             const ReClass::ChCliCharacter& inCharacter,
-            const wchar_t* playerName,
-            void* localPlayerPtr);
+            const PlayerRoster::Entry* rosterEntry,
+            void* localPlayerPtr,
+            EntityRecordCache& recordCache,
+            ShapeDimensionCache& shapeCache);
 
         /**
          * @brief Populates a RenderableNpc object from a ChCliCharacter game structure.
          * @param outNpc The RenderableNpc object to populate (from an object pool).
          * @param inCharacter The source ChCliCharacter structure from the game.
+         * @param recordCache Persistent records; stable fields are copied from here between refreshes.
+         * @param shapeCache Resolved Havok shape dimensions, keyed by shape pointer.
          * @return True if extraction was successful and the entity is valid, false otherwise.
          */
         static bool ExtractNpc(NpcEntity& outNpc,
-            const ReClass::ChCliCharacter& inCharacter);
+            const ReClass::ChCliCharacter& inCharacter,
+            EntityRecordCache& recordCache,
+            ShapeDimensionCache& shapeCache);
 
         /**
          * @brief Populates a RenderableGadget object from a GdCliGadget game structure.
          * @param outGadget The RenderableGadget object to populate (from an object pool).
          * @param inGadget The source GdCliGadget structure from the game.
+         * @param shapeCache Resolved Havok shape dimensions, keyed by shape pointer.
+         * @param staticLookup The gadget's static cache entry, if any; position and shape are taken
+         *        from it while the gadget still matches. Reports whether it did.
          * @return True if extraction was successful and the entity is valid, false otherwise.
          */
         static bool ExtractGadget(GadgetEntity& outGadget,
-            const ReClass::GdCliGadget& inGadget);
+            const ReClass::GdCliGadget& inGadget,
+            ShapeDimensionCache& shapeCache,
+            StaticGadgetCache::Lookup& staticLookup);
 
         /**
          * @brief Populates a RenderableAttackTarget object from an AgentInl game structure.
          * @param outAttackTarget The RenderableAttackTarget object to populate (from an object pool).
          * @param inAgentInl The source AgentInl structure from the attack target list.
+         * @param shapeCache Resolved Havok shape dimensions, keyed by shape pointer.
          * @return True if extraction was successful and the entity is valid, false otherwise.
          */
         static bool ExtractAttackTarget(AttackTargetEntity& outAttackTarget,
-            const ReClass::AgentInl& inAgentInl);
+            const ReClass::AgentInl& inAgentInl,
+            ShapeDimensionCache& shapeCache);
 
         /**
          * @brief Populates a RenderableItem object from an ItCliItem game structure.
          * @param outItem The RenderableItem object to populate (from an object pool).
          * @param inItem The source ItCliItem structure from the item list.
+         * @param shapeCache Resolved Havok shape dimensions, keyed by shape pointer.
          * @return True if extraction was successful and the entity is valid, false otherwise.
          */
         static bool ExtractItem(ItemEntity& outItem,
-            const ReClass::ItCliItem& inItem);
+            const ReClass::ItCliItem& inItem,
+            ShapeDimensionCache& shapeCache);
 
     private:
+        /**
+         * @brief Reads the stable tier of a player: core stats, gear and shape dimensions.
+         * @param outPlayer The RenderablePlayer object to populate.
+         * @param inCharacter The source ChCliCharacter structure from the game.
+         * @param stable The record's stable fields; holds the gear cache.
+         */
+        static void ExtractPlayerStableData(PlayerEntity& outPlayer, const ReClass::ChCliCharacter& inCharacter,
+            CharacterStableFields& stable, ShapeDimensionCache& shapeCache);
+
+        /**
+         * @brief Reads the stable tier of an NPC: level, rank and shape dimensions.
+         * @param outNpc The RenderableNpc object to populate.
+         * @param inCharacter The source ChCliCharacter structure from the game.
+         */
+        static void ExtractNpcStableData(NpcEntity& outNpc, const ReClass::ChCliCharacter& inCharacter, ShapeDimensionCache& shapeCache);
+
         /**
          * @brief Helper to encapsulate the detailed gear extraction logic for a player.
+         * Copies the gear slot pointers in one read and walks the item chains only if their
+         * fingerprint differs from the one the cached gear was decoded from.
          * @param outPlayer The RenderablePlayer object to add gear information to.
          * @param inventory The player's inventory structure from the game.
+         * @param stable The record's stable fields holding the cached gear.
          */
-        static void ExtractGear(PlayerEntity& outPlayer, const ReClass::ChCliInventory& inventory);
+        static void ExtractGear(PlayerEntity& outPlayer, const ReClass::ChCliInventory& inventory, CharacterStableFields& stable);
 
         // Common extraction pattern helpers
-        static bool ValidateAndExtractGamePosition(const ReClass::ChCliCharacter& character, glm::vec3& outGamePos);
-        static bool ValidateAndExtractGamePosition(const ReClass::GdCliGadget& gadget, glm::vec3& outGamePos);
-        static bool ValidateAndExtractGamePosition(const ReClass::AgKeyFramed& agKeyframed, glm::vec3& outGamePos);
         static glm::vec3 TransformGamePositionToMumble(const glm::vec3& gamePos);
         static void ExtractHealthData(GameEntity& entity, const ReClass::ChCliHealth& health);
         static void ExtractHealthData(GameEntity& entity, const ReClass::GdCliHealth& health);
         
+        // Havok shape dimensions: each resolves the shape pointer, then walks the rest of the
+        // chain only if the shape cache has no entry with the same type tag
+
         /**
          * @brief Extract physics shape dimensions from player character
          * @param entity The entity to populate with dimensions
          * @param character The character to extract dimensions from
          * @note Players use HkpRigidBody path (CoChar+0x60) which provides full shape type detection
          */
-        static void ExtractPlayerShapeDimensions(GameEntity& entity, const ReClass::ChCliCharacter& character);
+        static void ExtractPlayerShapeDimensions(GameEntity& entity, const ReClass::ChCliCharacter& character, ShapeDimensionCache& shapeCache);
         
         /**
          * @brief Extract physics box shape dimensions from NPC character
@@ -90,23 +132,7 @@ namespace kx {
          * @param character The character to extract dimensions from
          * @note NPCs use HkpBoxShape path (CoCharSimpleCliWrapper+0xE8) which only supports BOX shapes
          */
-        static void ExtractNpcShapeDimensions(GameEntity& entity, const ReClass::ChCliCharacter& character);
-        
-        /**
-         * @brief Extract physics shape dimensions from gadget
-         * @param entity The entity to populate with dimensions
-         * @param gadget The gadget to extract dimensions from
-         * @note Uses unified type-safe dimension extraction (supports CYLINDER, BOX, and MOPP shapes)
-         */
-        static void ExtractShapeDimensions(GameEntity& entity, const ReClass::GdCliGadget& gadget);
-        
-        /**
-         * @brief Extract physics shape dimensions from AgKeyFramed (for attack targets)
-         * @param entity The entity to populate with dimensions
-         * @param agKeyframed The AgKeyFramed to extract dimensions from
-         * @note Uses unified type-safe dimension extraction (supports CYLINDER, BOX, and MOPP shapes)
-         */
-        static void ExtractBoxShapeDimensions(GameEntity& entity, const ReClass::AgKeyFramed& agKeyframed);
+        static void ExtractNpcShapeDimensions(GameEntity& entity, const ReClass::ChCliCharacter& character, ShapeDimensionCache& shapeCache);
         
     private:
         /**
@@ -114,10 +140,10 @@ namespace kx {
          * @param entity The entity to populate with dimensions
          * @param coKeyframed The CoKeyFramed to extract dimensions from
          * @note Uses unified type-safe dimension extraction (supports CYLINDER, BOX, and MOPP shapes)
-         *       This path is used for gadgets and attack targets. Characters use ExtractBoxShapeDimensions instead.
+         *       This path is used for gadgets, attack targets and items. Characters use the player/NPC paths instead.
          *       All dimensions are returned in meters with proper coordinate conversion applied.
          */
-        static void ExtractShapeDimensionsFromCoKeyframed(GameEntity& entity, const ReClass::CoKeyFramed& coKeyframed);
+        static void ExtractShapeDimensionsFromCoKeyframed(GameEntity& entity, const ReClass::CoKeyFramed& coKeyframed, ShapeDimensionCache& shapeCache);
         
         /**
          * @brief Internal helper to extract dimensions from HkpBoxShape
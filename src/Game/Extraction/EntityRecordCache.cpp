@@ -0,0 +1,42 @@
+#include "EntityRecordCache.h"
+
+namespace kx {
+
+void EntityRecordCache::BeginTick(uint64_t now) {
+    m_now = now;
+    ++m_tick;
+}
+
+EntityRecord& EntityRecordCache::Touch(const CombatStateKey& key, EntityTypes entityType) {
+    EntityRecord& record = m_records[key];
+
+    // Same agentId but a different wrapper or kind: this is a new entity, start over
+    if (record.address != key.address || record.entityType != entityType) {
+        record = EntityRecord{};
+        record.address = key.address;
+        record.entityType = entityType;
+    }
+
+    record.lastSeenTick = m_tick;
+    return record;
+}
+
+size_t EntityRecordCache::Sweep() {
+    const uint32_t tick = m_tick;
+    return std::erase_if(m_records, [tick](const auto& entry) {
+        return entry.second.lastSeenTick != tick;
+    });
+}
+
+size_t EntityRecordCache::Sweep(EntityTypes entityType) {
+    const uint32_t tick = m_tick;
+    return std::erase_if(m_records, [tick, entityType](const auto& entry) {
+        return entry.second.entityType == entityType && entry.second.lastSeenTick != tick;
+    });
+}
+
+void EntityRecordCache::Clear() {
+    m_records.clear();
+}
+
+} // namespace kx
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <array>
+#include <ankerl/unordered_dense.h>
+#include "../Data/EntityData.h"
+#include "../Services/Combat/CombatStateKey.h"
+
+namespace kx {
+
+/**
+ * @brief Stable-tier fields of a character: expensive to read, rarely changing
+ *
+ * Core stats, gear and Havok shape dimensions all sit behind several pointer hops.
+ * They are read on a slow cadence and copied into the pooled entity on every other tick.
+ * Volatile fields (position, health, barrier, endurance, energy, attitude) are not stored here.
+ */
+struct CharacterStableFields {
+    uint32_t level = 0;
+    uint32_t scaledLevel = 0;
+    Game::Profession profession = Game::Profession::None;
+    Game::Race race = Game::Race::None;
+    Game::CharacterRank rank = Game::CharacterRank::Normal;
+
+    // A matching gear fingerprint is trusted this many stable refreshes in a row, then the gear
+    // is decoded anyway: a stat swap changes an item's stats without changing the slot pointers,
+    // so a swap shows up within a few seconds
+    static constexpr uint8_t MAX_GEAR_REUSES = 3;
+
+    std::array<PlayerEntity::GearItem, PlayerEntity::MAX_GEAR_ITEMS> gear{};
+    size_t gearCount = 0;
+    uint64_t gearFingerprint = 0;       // Hash of the slot pointers the gear was decoded from
+    bool hasGearFingerprint = false;
+    uint8_t gearReuses = 0;             // Refreshes served from the cached gear since the last decode
+
+    float physicsWidth = 0.0f;
+    float physicsDepth = 0.0f;
+    float physicsHeight = 0.0f;
+    bool hasPhysicsDimensions = false;
+    Havok::HkcdShapeType shapeType = Havok::HkcdShapeType::INVALID;
+
+    void CaptureFrom(const PlayerEntity& player) {
+        level = player.level;
+        scaledLevel = player.scaledLevel;
+        profession = player.profession;
+        race = player.race;
+        gearCount = player.gearCount;
+        std::copy_n(player.gear.begin(), gearCount, gear.begin());
+        CaptureShape(player);
+    }
+
+    void ApplyTo(PlayerEntity& player) const {
+        player.level = level;
+        player.scaledLevel = scaledLevel;
+        player.profession = profession;
+        player.race = race;
+        player.gearCount = gearCount;
+        std::copy_n(gear.begin(), gearCount, player.gear.begin());
+        ApplyShape(player);
+    }
+
+    /**
+     * @brief Copy the cached gear into a player if it was decoded from the same slot pointers
+     * @param fingerprint Hash of the inventory's gear slot pointers, read this refresh
+     * @return False if the gear must be decoded again; the new fingerprint is then recorded
+     */
+    bool TryReuseGear(uint64_t fingerprint, PlayerEntity& player) {
+        if (hasGearFingerprint && fingerprint == gearFingerprint && gearReuses < MAX_GEAR_REUSES) {
+            ++gearReuses;
+            player.gearCount = gearCount;
+            std::copy_n(gear.begin(), gearCount, player.gear.begin());
+            return true;
+        }
+        gearFingerprint = fingerprint;
+        hasGearFingerprint = true;
+        gearReuses = 0;
+        return false;
+    }
+
+    /**
+     * @brief Drop the gear fingerprint after a refresh that could not decode all of the gear
+     *
+     * The partial gear is still captured, but the next refresh decodes it again instead of
+     * reusing it for the same slot pointers.
+     */
+    void ForgetGearFingerprint() {
+        hasGearFingerprint = false;
+        gearReuses = 0;
+    }
+
+    void CaptureFrom(const NpcEntity& npc) {
+        level = npc.level;
+        rank = npc.rank;
+        CaptureShape(npc);
+    }
+
+    void ApplyTo(NpcEntity& npc) const {
+        npc.level = level;
+        npc.rank = rank;
+        ApplyShape(npc);
+    }
+
+private:
+    void CaptureShape(const GameEntity& entity) {
+        physicsWidth = entity.physicsWidth;
+        physicsDepth = entity.physicsDepth;
+        physicsHeight = entity.physicsHeight;
+        hasPhysicsDimensions = entity.hasPhysicsDimensions;
+        shapeType = entity.shapeType;
+    }
+
+    void ApplyShape(GameEntity& entity) const {
+        entity.physicsWidth = physicsWidth;
+        entity.physicsDepth = physicsDepth;
+        entity.physicsHeight = physicsHeight;
+        entity.hasPhysicsDimensions = hasPhysicsDimensions;
+        entity.shapeType = shapeType;
+    }
+};
+
+/**
+ * @brief Persistent per-entity extraction state, kept across ticks
+ */
+struct EntityRecord {
+    const void* address = nullptr;          // Wrapper address the record was built for
+    EntityTypes entityType = EntityTypes::Player;
+    bool hasStable = false;                 // False until the first stable read
+    uint64_t nextStableRefresh = 0;         // Tick time (ms) at which the stable tier is re-read
+    uint32_t lastSeenTick = 0;              // Used to drop records of despawned entities
+    CharacterStableFields stable;
+};
+
+/**
+ * @brief Persistent records keyed by CombatStateKey, owned by the Game Thread
+ *
+ * Usage per extraction tick:
+ * 1. BeginTick(now)
+ * 2. Touch() every extracted entity; read its stable tier only if NeedsStableRefresh()
+ * 3. Sweep() to drop records that were not touched this tick
+ *
+ * A record is reset when the entity behind its key changes (different wrapper address
+ * or entity type), so a reused agentId never inherits the previous entity's stable data.
+ */
+class EntityRecordCache {
+public:
+    // How often the stable tier of a known entity is re-read
+    static constexpr uint64_t STABLE_REFRESH_INTERVAL_MS = 1000;
+    // Per-entity offset added to the interval so refreshes spread over several ticks
+    static constexpr uint64_t STABLE_REFRESH_JITTER_MS = 250;
+
+    EntityRecordCache() = default;
+
+    /**
+     * @brief Start a new extraction tick
+     * @param now Current time in milliseconds
+     */
+    void BeginTick(uint64_t now);
+
+    /**
+     * @brief Find or create the record for an entity and mark it as seen this tick
+     * @param key Combat key of the entity (agentId + wrapper address)
+     * @param entityType Kind of entity the record must describe
+     * @return The record; reset to empty if it previously described a different entity
+     */
+    EntityRecord& Touch(const CombatStateKey& key, EntityTypes entityType);
+
+    /**
+     * @brief Check whether the stable tier of a record must be read from game memory
+     */
+    [[nodiscard]] bool NeedsStableRefresh(const EntityRecord& record) const {
+        return !record.hasStable || m_now >= record.nextStableRefresh;
+    }
+
+    /**
+     * @brief Mark the stable tier as freshly read and schedule the next refresh
+     * @param record The record whose stable fields were just written
+     * @param agentId Used to stagger refreshes of entities that appeared on the same tick
+     */
+    void MarkStableRefreshed(EntityRecord& record, uint32_t agentId) const {
+        record.hasStable = true;
+        record.nextStableRefresh = m_now + STABLE_REFRESH_INTERVAL_MS + (agentId % STABLE_REFRESH_JITTER_MS);
+    }
+
+    /**
+     * @brief Drop records of entities that were not touched since BeginTick()
+     * @return Number of records removed
+     */
+    size_t Sweep();
+
+    /**
+     * @brief Drop untouched records of one entity kind only
+     * Used when a pass read players but not NPCs (or the reverse): the other kind was not touched.
+     * @return Number of records removed
+     */
+    size_t Sweep(EntityTypes entityType);
+
+    /**
+     * @brief Drop all records (e.g., on map change)
+     */
+    void Clear();
+
+    [[nodiscard]] size_t Size() const { return m_records.size(); }
+
+private:
+    ankerl::unordered_dense::map<CombatStateKey, EntityRecord, CombatStateKeyHash> m_records;
+    uint64_t m_now = 0;
+    uint32_t m_tick = 0;
+};
+
+} // namespace kx
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <ankerl/unordered_dense.h>
+#include "../Data/EntityData.h"
+#include "../../Memory/PageProbeCache.h"
+#include "../../Memory/SlotOccupancy.h"
+#include "../../Memory/ValidatedSlot.h"
+#include "AgentSlotTable.h"
+#include "EntityRecordCache.h"
+#include "ShapeDimensionCache.h"
+#include "ExtractionScheduler.h"
+#include "ExtractionLod.h"
+#include "GroundItemIndex.h"
+#include "PlayerRoster.h"
+#include "StaticGadgetCache.h"
+
+namespace kx {
+
+    class ForkJoinPool;
+    struct FrameGameData;
+
+    /**
+     * @brief Progress of one category through its list when passes are cut short by the time budget
+     *
+     * Each pass starts reading at the cursor, so entities left unread by one pass are the
+     * first ones read by the next. A sweep completes once every entity of the list has been
+     * read since the sweep started; without a budget overrun that is a single pass.
+     */
+    struct ExtractionSweep {
+        uint32_t cursor = 0;            // Slot index the next pass starts reading from
+
+        bool active = false;
+        uint64_t startedAt = 0;         // Extraction time (ms) of the sweep's first pass
+        uint32_t passes = 0;
+        size_t remaining = 0;           // Entities still to read before the sweep completes
+
+        uint32_t lastLatencyMs = 0;     // Duration of the last completed sweep
+        uint32_t lastPasses = 0;        // Passes it took
+    };
+
+    /**
+     * @brief State of one participant of an extraction pass
+     *
+     * Participant 0 is the Game Thread itself; the others are fork-join workers.
+     * Everything here is touched by exactly one thread during a pass, so no locking
+     * is needed. The forking thread fills the inputs before the fork and reads the
+     * outputs after the join.
+     */
+    struct ExtractionWorker {
+        // Inputs: characters routed to this participant (stable per slot index, see DataExtractor)
+        std::vector<SafeAccess::ValidatedSlot> playerSlots;
+        std::vector<const PlayerRoster::Entry*> playerEntries; // Parallel to playerSlots
+        std::vector<SafeAccess::ValidatedSlot> npcSlots;
+        std::vector<const NpcEntity*> staleNpcs; // Previous values of NPCs outside this pass's LOD slice
+
+        // Time budget: entities left unread when the deadline passed, per category, and the slot
+        // index of the first of them in this participant's (rotated) order
+        std::array<uint32_t, EXTRACTION_CATEGORY_COUNT> deferred{};
+        std::array<std::optional<uint32_t>, EXTRACTION_CATEGORY_COUNT> firstDeferred{};
+
+        // Staged decode: entities that ran into a page the capture lacked, and their categories
+        uint32_t missedEntities = 0;
+        ExtractionCategoryMask missedCategories = 0;
+
+        // Outputs, merged into FrameGameData in participant order
+        std::vector<PlayerEntity*> players;
+        std::vector<NpcEntity*> npcs;
+        std::vector<GadgetEntity*> gadgets;
+        std::vector<AttackTargetEntity*> attackTargets;
+        std::vector<ItemEntity*> items;
+
+        // Record shard: a character always lands on the same participant while the
+        // worker count is unchanged, so its stable tier stays warm
+        EntityRecordCache recordCache;
+        SafeAccess::PageProbeCache probeCache;
+        ShapeDimensionCache shapeCache; // Per participant, so lookups need no locking
+
+        // Static gadgets read in full this pass, stored into the shared cache after the join
+        std::vector<std::pair<const void*, StaticGadgetCache::Entry>> staticGadgetStores;
+        uint32_t staticGadgetHits = 0;
+
+        void ClearFrame() {
+            playerSlots.clear();
+            playerEntries.clear();
+            npcSlots.clear();
+            staleNpcs.clear();
+            deferred.fill(0);
+            firstDeferred.fill(std::nullopt);
+            missedEntities = 0;
+            missedCategories = 0;
+            players.clear();
+            npcs.clear();
+            gadgets.clear();
+            attackTargets.clear();
+            items.clear();
+            staticGadgetStores.clear();
+            staticGadgetHits = 0;
+        }
+    };
+
+    /**
+     * @brief Persistent state of the extraction pipeline, owned by the Game Thread
+     *
+     * Kept across passes so maps and vectors retain their capacity (high-water mark strategy).
+     */
+    struct ExtractionContext {
+        // Character pointer -> player with its UTF-8 name, re-read only where the player list changed
+        PlayerRoster roster;
+
+        // One entry per participant; never empty
+        std::vector<ExtractionWorker> workers = std::vector<ExtractionWorker>(1);
+
+        // Optional fork-join pool; extraction runs serially on the caller when null or empty
+        ForkJoinPool* workerPool = nullptr;
+
+        // Current time in milliseconds, drives the stable-tier refresh cadence
+        uint64_t now = 0;
+
+        // Categories read from game memory this pass. The others are copied from previousFrame
+        // (or left empty without one), so a slow category still shows up in every published frame.
+        ExtractionCategoryMask categories = ALL_EXTRACTION_CATEGORIES;
+        const FrameGameData* previousFrame = nullptr;
+
+        // Categories some feature uses (see IFeature::GetConsumedCategories). The others are
+        // neither read nor carried over and stay empty in the frame (see ExtractionPlan).
+        ExtractionCategoryMask consumed = ALL_EXTRACTION_CATEGORIES;
+
+        // agentId -> generation, changed only on spawn and despawn; indexes every published frame
+        AgentSlotTable agentSlots;
+
+        // Ground items of the item list, reclassified only where the list changed (see GroundItemIndex.h)
+        GroundItemIndex groundItems;
+
+        // Slots of the character, gadget and attack target lists that held objects last pass (see SlotOccupancy.h)
+        SafeAccess::SlotOccupancy characterOccupancy;
+        SafeAccess::SlotOccupancy gadgetOccupancy;
+        SafeAccess::SlotOccupancy attackTargetOccupancy;
+
+        // MumbleLink map ID of the pass (0 = unknown) and the gadgets that never move on that map
+        uint32_t mapId = 0;
+        StaticGadgetCache staticGadgets;
+
+        // Distance LOD (see ExtractionLod.h). Needs previousFrame for last-known positions.
+        bool distanceLod = false;
+        std::array<LodCursor, EXTRACTION_CATEGORY_COUNT> lodCursors{};
+
+        // Pipelined traversal of the character and gadget lists (see PrefetchPipeline.h):
+        // slots to look ahead while decoding, 0 = off. Live memory only.
+        uint32_t prefetchDistance = 0;
+
+        // Time budget per pass in microseconds (0 = unlimited). Participants stop reading at the
+        // deadline; the rest of each list keeps its previous values, flagged stale with their age.
+        // Covers decoding only: the deadline is set once ExtractionPlan::Resolve has validated the
+        // lists and walked the roster, whose cost is reported in ExtractionStats::resolveMicros.
+        uint32_t budgetMicros = 0;
+        std::chrono::steady_clock::time_point deadline{};
+        std::array<ExtractionSweep, EXTRACTION_CATEGORY_COUNT> sweeps{};
+
+        // Per-pass scratch: previous entities by wrapper address, the slots to read per category
+        // (after LOD, rotated to the sweep cursor) and previous entities copied as stale by LOD
+        ankerl::unordered_dense::map<const void*, const GameEntity*> previousByAddress;
+        std::vector<SafeAccess::ValidatedSlot> playerCandidates;
+        std::vector<SafeAccess::ValidatedSlot> npcCandidates;
+        std::vector<SafeAccess::ValidatedSlot> npcSlots;
+        std::vector<SafeAccess::ValidatedSlot> gadgetSlots;
+        std::vector<SafeAccess::ValidatedSlot> attackTargetSlots;
+        std::vector<SafeAccess::ValidatedSlot> itemSlots;
+        std::vector<const GadgetEntity*> staleGadgets;
+        std::vector<const AttackTargetEntity*> staleAttackTargets;
+        std::vector<const ItemEntity*> staleItems;
+
+        // Havok chain walks saved by the shape caches, counted over windows of about a second
+        uint64_t shapeWindowStart = 0;
+        uint32_t shapeWindowHits = 0;
+        uint32_t shapeHitsPerSecond = 0;
+
+        [[nodiscard]] bool BudgetExhausted() const {
+            return budgetMicros != 0 && std::chrono::steady_clock::now() >= deadline;
+        }
+
+        /**
+         * @brief Drop all per-entity records (e.g., on map change)
+         */
+        void ClearRecords() {
+            for (auto& worker : workers) {
+                worker.recordCache.Clear();
+            }
+        }
+
+        /**
+         * @brief Drop all resolved shape dimensions (on map change: shapes are map resources)
+         */
+        void ClearShapeCaches() {
+            for (auto& worker : workers) {
+                worker.shapeCache.Clear();
+            }
+        }
+
+        /**
+         * @brief Drop everything keyed by game pointers or slot indices of the old map
+         *
+         * The new map frees and reuses those addresses, so nothing may be looked up across a map change.
+         */
+        void ClearMapState() {
+            ClearRecords();
+            agentSlots.Clear();
+            groundItems.Clear();
+            roster.Clear();
+            characterOccupancy.Clear();
+            gadgetOccupancy.Clear();
+            attackTargetOccupancy.Clear();
+            staticGadgets.Clear();
+            ClearShapeCaches();
+            sweeps = {};
+        }
+    };
+
+} // namespace kx
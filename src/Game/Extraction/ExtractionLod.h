@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace kx {
+
+    /**
+     * @brief Distance level-of-detail tiers for extraction
+     *
+     * An entity's tier comes from its last-known gameplay distance (previous frame position
+     * against the local player's previous position). Near entities are read every pass;
+     * mid and far entities are read in round-robin slices of a fixed size per pass and keep
+     * their previous values, flagged stale, in between. Players are never tiered.
+     */
+    enum class LodTier : uint8_t {
+        Near,
+        Mid,
+        Far
+    };
+
+    namespace ExtractionLod {
+        constexpr float NEAR_DISTANCE = 60.0f;   // Read every pass up to here (meters)
+        constexpr float FAR_DISTANCE = 150.0f;   // Mid tier up to here, far tier beyond
+
+        // Entities of one category refreshed per pass, per tier. The cost of a pass is
+        // bounded by the near tier plus these, however many entities are in range.
+        constexpr size_t MID_BUDGET = 64;
+        constexpr size_t FAR_BUDGET = 16;
+
+        constexpr LodTier Classify(float distanceSquared) {
+            if (distanceSquared <= NEAR_DISTANCE * NEAR_DISTANCE) return LodTier::Near;
+            if (distanceSquared <= FAR_DISTANCE * FAR_DISTANCE) return LodTier::Mid;
+            return LodTier::Far;
+        }
+
+        /**
+         * @brief Whether the entity at ordinal (within its tier) is in this pass's slice
+         * @param count Entities in the tier this pass
+         * @param cursor First ordinal of the slice; wraps around the tier
+         */
+        constexpr bool InSlice(size_t ordinal, size_t count, uint32_t cursor, size_t budget) {
+            if (count <= budget) return true;
+            return (ordinal + count - cursor % count) % count < budget;
+        }
+
+        constexpr uint32_t AdvanceCursor(uint32_t cursor, size_t count, size_t budget) {
+            return count > budget ? static_cast<uint32_t>((cursor + budget) % count) : 0;
+        }
+    }
+
+    /**
+     * @brief Round-robin position of one category within its mid and far tiers
+     */
+    struct LodCursor {
+        uint32_t nextMid = 0; // First mid-tier ordinal of the next slice
+        uint32_t nextFar = 0;
+    };
+
+} // namespace kx
@@ -0,0 +1,79 @@
+#include "ExtractionPlan.h"
+#include "../SdkStructs.h"
+#include "../../Memory/SafeGameArray.h"
+#include "ExtractionContext.h"
+
+namespace kx {
+
+    ExtractionPlan::ExtractionPlan(ExtractionCategoryMask due, ExtractionCategoryMask consumed, bool hasPreviousFrame) {
+        consumed &= ALL_EXTRACTION_CATEGORIES;
+        m_read = (hasPreviousFrame ? due : ALL_EXTRACTION_CATEGORIES) & consumed;
+        m_carried = hasPreviousFrame ? consumed & ~m_read : 0;
+    }
+
+    void ExtractionPlan::Resolve(void* contextCollection, ExtractionContext& context) {
+        context.playerCandidates.clear();
+        context.npcCandidates.clear();
+        m_gadgetCandidates = {};
+        m_attackTargetCandidates = {};
+        m_itemCandidates = {};
+
+        // The caller proved the collection readable; its three context pointers are one copy
+        ReClass::ContextCollection collection(nullptr);
+        collection.AdoptValidated(contextCollection);
+        const ReClass::ContextCollection::Contexts contexts = collection.ReadContexts();
+
+        const bool playersRead = Reads(ExtractionCategory::Players);
+        const bool npcsRead = Reads(ExtractionCategory::Npcs);
+        if (playersRead || npcsRead) {
+            const ReClass::ChCliContext charContext(contexts.character);
+            if (!charContext.data()) {
+                context.roster.Update(nullptr, 0);
+                context.characterOccupancy.Clear();
+            } else {
+                // Players are told apart from NPCs by the roster, so it is updated for either. Its
+                // character pointers are only keys: the character list walk validates them.
+                const SafeAccess::SafeGameArray<ReClass::ChCliPlayer> playerList = charContext.GetPlayers();
+                context.roster.Update(playerList.GetRawArray(), playerList.GetCapacity());
+
+                for (const SafeAccess::ValidatedSlot& slot : charContext.GetCharacters().Validated(context.characterOccupancy).Slots()) {
+                    if (context.roster.Find(slot.object)) {
+                        if (playersRead) context.playerCandidates.push_back(slot);
+                    } else if (npcsRead) {
+                        context.npcCandidates.push_back(slot);
+                    }
+                }
+            }
+        }
+
+        const bool gadgetsRead = Reads(ExtractionCategory::Gadgets);
+        const bool attackTargetsRead = Reads(ExtractionCategory::AttackTargets);
+        if (gadgetsRead || attackTargetsRead) {
+            const ReClass::GdCliContext gadgetContext(contexts.gadget);
+            if (gadgetContext.data()) {
+                // Both lists are mostly empty slots: probing starts from last pass's occupancy
+                if (gadgetsRead) {
+                    m_gadgetCandidates = gadgetContext.GetGadgets().Validated(context.gadgetOccupancy).Slots();
+                }
+                if (attackTargetsRead) {
+                    m_attackTargetCandidates = gadgetContext.GetAttackTargets().Validated(context.attackTargetOccupancy).Slots();
+                }
+            } else {
+                context.gadgetOccupancy.Clear();
+                context.attackTargetOccupancy.Clear();
+            }
+        }
+
+        if (Reads(ExtractionCategory::Items)) {
+            // Only the ground items are candidates; the index skips the equipped and bagged majority
+            const ReClass::ItCliContext itemContext(contexts.item);
+            if (itemContext.data()) {
+                const SafeAccess::SafeGameArray<ReClass::ItCliItem> itemList = itemContext.GetItems();
+                m_itemCandidates = context.groundItems.Update(itemList.GetRawArray(), itemList.GetCapacity());
+            } else {
+                context.groundItems.Update(nullptr, 0);
+            }
+        }
+    }
+
+} // namespace kx
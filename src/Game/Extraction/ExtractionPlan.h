@@ -0,0 +1,58 @@
+#pragma once
+
+#include <span>
+#include "../../Memory/ValidatedSlot.h"
+#include "ExtractionScheduler.h"
+
+namespace kx {
+
+    struct ExtractionContext;
+
+    /**
+     * @brief What one extraction pass reads, resolved once at the start of the pass
+     *
+     * A category is read when it is due and some feature consumes it, carried over from the
+     * previous frame when it is consumed but not due, and left empty otherwise. Resolve() reads
+     * the context pointers of the ContextCollection with one bulk copy, validates only the
+     * contexts a read category needs, and walks each game list at most once.
+     */
+    class ExtractionPlan {
+    public:
+        /**
+         * @param due Categories whose schedule is due (see ExtractionScheduler)
+         * @param consumed Categories some feature currently uses
+         * @param hasPreviousFrame Whether there is a frame to carry categories over from;
+         *        without one every consumed category is read
+         */
+        ExtractionPlan(ExtractionCategoryMask due, ExtractionCategoryMask consumed, bool hasPreviousFrame);
+
+        [[nodiscard]] ExtractionCategoryMask GetRead() const { return m_read; }
+        [[nodiscard]] ExtractionCategoryMask GetCarried() const { return m_carried; }
+        [[nodiscard]] bool Reads(ExtractionCategory category) const { return (m_read & CategoryBit(category)) != 0; }
+        [[nodiscard]] bool Carries(ExtractionCategory category) const { return (m_carried & CategoryBit(category)) != 0; }
+
+        /**
+         * @brief Resolve the contexts and walk the lists of the read categories
+         *
+         * Fills context.playerCandidates and context.npcCandidates and updates context.roster
+         * and context.groundItems. The gadget and attack target candidates stay valid until
+         * the next Resolve() on this thread, the item candidates (ground items only) until the
+         * next update of the index.
+         * @param contextCollection ContextCollection pointer, already proven readable
+         */
+        void Resolve(void* contextCollection, ExtractionContext& context);
+
+        [[nodiscard]] std::span<const SafeAccess::ValidatedSlot> GetGadgetCandidates() const { return m_gadgetCandidates; }
+        [[nodiscard]] std::span<const SafeAccess::ValidatedSlot> GetAttackTargetCandidates() const { return m_attackTargetCandidates; }
+        [[nodiscard]] std::span<const SafeAccess::ValidatedSlot> GetItemCandidates() const { return m_itemCandidates; }
+
+    private:
+        ExtractionCategoryMask m_read = 0;
+        ExtractionCategoryMask m_carried = 0;
+
+        std::span<const SafeAccess::ValidatedSlot> m_gadgetCandidates;
+        std::span<const SafeAccess::ValidatedSlot> m_attackTargetCandidates;
+        std::span<const SafeAccess::ValidatedSlot> m_itemCandidates;
+    };
+
+} // namespace kx
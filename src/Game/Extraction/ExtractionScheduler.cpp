@@ -0,0 +1,55 @@
+#include "ExtractionScheduler.h"
+#include <algorithm>
+#include <cmath>
+#include "../../Core/Settings/ExtractionSettings.h"
+
+namespace kx {
+
+    namespace {
+
+        uint32_t RateToIntervalMs(float rate) {
+            const float clamped = std::clamp(rate, ExtractionScheduler::MIN_RATE, ExtractionScheduler::MAX_RATE);
+            return (std::max)(1u, static_cast<uint32_t>(std::lround(1000.0f / clamped)));
+        }
+
+    } // namespace
+
+    ExtractionScheduler::ExtractionScheduler() {
+        m_intervalMs.fill(RateToIntervalMs(60.0f));
+    }
+
+    void ExtractionScheduler::SetRates(const ExtractionSettings& settings) {
+        m_intervalMs[static_cast<size_t>(ExtractionCategory::Players)] = RateToIntervalMs(settings.playerRate);
+        m_intervalMs[static_cast<size_t>(ExtractionCategory::Npcs)] = RateToIntervalMs(settings.npcRate);
+        m_intervalMs[static_cast<size_t>(ExtractionCategory::Gadgets)] = RateToIntervalMs(settings.gadgetRate);
+        m_intervalMs[static_cast<size_t>(ExtractionCategory::AttackTargets)] = RateToIntervalMs(settings.attackTargetRate);
+        m_intervalMs[static_cast<size_t>(ExtractionCategory::Items)] = RateToIntervalMs(settings.itemRate);
+    }
+
+    ExtractionCategoryMask ExtractionScheduler::GetDue(uint64_t now) const {
+        ExtractionCategoryMask due = 0;
+        for (size_t i = 0; i < EXTRACTION_CATEGORY_COUNT; ++i) {
+            if (now >= m_nextDue[i]) {
+                due |= CategoryBit(static_cast<ExtractionCategory>(i));
+            }
+        }
+        return due;
+    }
+
+    void ExtractionScheduler::MarkExtracted(ExtractionCategoryMask categories, uint64_t now) {
+        for (size_t i = 0; i < EXTRACTION_CATEGORY_COUNT; ++i) {
+            if (!(categories & CategoryBit(static_cast<ExtractionCategory>(i)))) continue;
+
+            uint64_t next = m_nextDue[i] + m_intervalMs[i];
+            if (next <= now) {
+                next = now + m_intervalMs[i];
+            }
+            m_nextDue[i] = next;
+        }
+    }
+
+    void ExtractionScheduler::Reset() {
+        m_nextDue.fill(0);
+    }
+
+} // namespace kx
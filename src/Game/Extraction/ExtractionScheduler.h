@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace kx {
+
+    struct ExtractionSettings;
+
+    /**
+     * @brief Entity categories that are extracted on independent cadences
+     */
+    enum class ExtractionCategory : uint8_t {
+        Players,
+        Npcs,
+        Gadgets,
+        AttackTargets,
+        Items,
+        Count
+    };
+
+    constexpr size_t EXTRACTION_CATEGORY_COUNT = static_cast<size_t>(ExtractionCategory::Count);
+
+    // Bit set of ExtractionCategory values
+    using ExtractionCategoryMask = uint32_t;
+
+    constexpr ExtractionCategoryMask CategoryBit(ExtractionCategory category) {
+        return ExtractionCategoryMask(1) << static_cast<uint32_t>(category);
+    }
+
+    constexpr ExtractionCategoryMask ALL_EXTRACTION_CATEGORIES =
+        (ExtractionCategoryMask(1) << static_cast<uint32_t>(ExtractionCategory::Count)) - 1;
+
+    /**
+     * @brief Decides which entity categories are re-extracted on a given Game Thread tick
+     *
+     * Each category has its own rate and an absolute deadline in integer milliseconds,
+     * so the cadence does not drift or lose precision over long uptimes. Categories that
+     * are not due keep the entities of the previously published frame (see DataExtractor).
+     */
+    class ExtractionScheduler {
+    public:
+        static constexpr float MIN_RATE = 1.0f;
+        static constexpr float MAX_RATE = 360.0f;
+
+        ExtractionScheduler();
+
+        /**
+         * @brief Convert the per-category rates (extractions per second) into intervals
+         */
+        void SetRates(const ExtractionSettings& settings);
+
+        /**
+         * @brief Categories whose deadline has been reached
+         * @param now Current time in milliseconds
+         */
+        [[nodiscard]] ExtractionCategoryMask GetDue(uint64_t now) const;
+
+        /**
+         * @brief Schedule the next deadline of every category in the mask
+         *
+         * Deadlines advance by whole intervals to hold the configured cadence; a category
+         * that fell more than one interval behind restarts from now instead of bursting.
+         */
+        void MarkExtracted(ExtractionCategoryMask categories, uint64_t now);
+
+        /**
+         * @brief Make every category due immediately (e.g., after a map change)
+         */
+        void Reset();
+
+        [[nodiscard]] uint32_t GetIntervalMs(ExtractionCategory category) const {
+            return m_intervalMs[static_cast<size_t>(category)];
+        }
+
+    private:
+        std::array<uint32_t, EXTRACTION_CATEGORY_COUNT> m_intervalMs{};
+        std::array<uint64_t, EXTRACTION_CATEGORY_COUNT> m_nextDue{};
+    };
+
+} // namespace kx
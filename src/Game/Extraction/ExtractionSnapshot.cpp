@@ -0,0 +1,57 @@
+#include "ExtractionSnapshot.h"
+#include "../../Memory/MemoryImage.h"
+#include "../../Memory/MemorySource.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace kx {
+
+    bool ExtractionSnapshot::Capture(const std::filesystem::path& path, const ExtractFn& extract, CaptureResult& outResult) {
+        MemoryImage image;
+        bool extracted = false;
+        {
+            MemorySource::ScopedRecording recording(image);
+            extracted = extract();
+        }
+
+        if (!extracted || image.GetPageCount() == 0) {
+            return false;
+        }
+
+        outResult.pageCount = image.GetPageCount();
+        outResult.byteCount = image.GetByteCount();
+        return image.SaveToFile(path);
+    }
+
+    bool ExtractionSnapshot::Replay(const std::filesystem::path& path, uint32_t iterations,
+        const ExtractFn& extract, ReplayResult& outResult) {
+        MemoryImage image;
+        if (!image.LoadFromFile(path) || iterations == 0) {
+            return false;
+        }
+
+        using Clock = std::chrono::steady_clock;
+        outResult = ReplayResult{};
+        outResult.minUs = 1e300;
+
+        MemorySource::ScopedReplay replay(image);
+        for (uint32_t i = 0; i < iterations; ++i) {
+            const auto start = Clock::now();
+            const bool extracted = extract();
+            const double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+            if (!extracted) {
+                return false;
+            }
+
+            outResult.iterations++;
+            outResult.totalMs += us / 1000.0;
+            outResult.minUs = (std::min)(outResult.minUs, us);
+            outResult.maxUs = (std::max)(outResult.maxUs, us);
+        }
+
+        outResult.avgUs = (outResult.totalMs * 1000.0) / outResult.iterations;
+        return true;
+    }
+
+} // namespace kx
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+
+namespace kx {
+
+    /**
+     * @brief Capture and replay of extraction input for offline profiling
+     *
+     * Capture runs one extraction pass with the MemorySource in Recording mode, which
+     * copies every page the extractor touches while walking ChCliContext, GdCliContext
+     * and ItCliContext, and writes the resulting MemoryImage to disk.
+     *
+     * Replay loads such an image and runs the same extraction pass against it
+     * repeatedly, giving repeatable throughput numbers for a recorded scene
+     * independent of the live game.
+     */
+    class ExtractionSnapshot {
+    public:
+        /**
+         * @brief One extraction pass. Returns false if the root pointers were unusable.
+         */
+        using ExtractFn = std::function<bool()>;
+
+        struct CaptureResult {
+            size_t pageCount = 0;
+            size_t byteCount = 0;
+        };
+
+        struct ReplayResult {
+            uint32_t iterations = 0;
+            double totalMs = 0.0;
+            double minUs = 0.0;
+            double maxUs = 0.0;
+            double avgUs = 0.0;
+        };
+
+        /**
+         * @brief Record one extraction pass and write the touched memory to a file
+         * @return false if extraction failed or the file could not be written
+         */
+        static bool Capture(const std::filesystem::path& path, const ExtractFn& extract, CaptureResult& outResult);
+
+        /**
+         * @brief Load an image and time repeated extraction passes against it
+         * @return false if the image could not be loaded or extraction failed
+         */
+        static bool Replay(const std::filesystem::path& path, uint32_t iterations,
+            const ExtractFn& extract, ReplayResult& outResult);
+    };
+
+} // namespace kx
@@ -0,0 +1,80 @@
+#include "GroundItemIndex.h"
+#include "../SdkStructs.h"
+#include "../../Memory/MemorySource.h"
+#include "../../Memory/Safety.h"
+
+namespace kx {
+
+namespace {
+
+    // A slot is a ground item if its object is a live game object located on an agent
+    bool ReadGroundItem(uint32_t index, void* object, SafeAccess::ValidatedSlot& out) {
+        if (!object || !SafeAccess::IsValidGameObject(object)) {
+            return false;
+        }
+
+        ReClass::ItCliItem item(nullptr);
+        item.AdoptValidated(object);
+        if (item.GetLocationType() != Game::ItemLocation::Agent) {
+            return false;
+        }
+
+        out = { index, object, MemorySource::Read<uintptr_t>(reinterpret_cast<uintptr_t>(object), 0) };
+        return true;
+    }
+
+} // namespace
+
+std::span<const SafeAccess::ValidatedSlot> GroundItemIndex::Update(void** list, uint32_t capacity) {
+    m_stats = Stats{};
+    m_groundSlots.clear();
+    if (!m_diff.Read(list, capacity)) {
+        Clear();
+        return {};
+    }
+    m_ground.resize(capacity, 0);
+
+    SafeAccess::ValidatedSlot slot{};
+    m_diff.ForEachChanged([&](uint32_t i, void* object) {
+        // Ground slots are validated again below; only the classification is stored here
+        m_ground[i] = 0;
+        if (object) {
+            m_ground[i] = ReadGroundItem(i, object, slot) ? 1 : 0;
+            ++m_stats.reclassified;
+        }
+    });
+
+    // Round-robin re-check of unchanged slots: an item can move from a bag to the ground in place
+    m_diff.ForEachRecheck(RECHECK_PER_PASS, [&](uint32_t i, void* object) {
+        if (object && !m_ground[i]) {
+            m_ground[i] = ReadGroundItem(i, object, slot) ? 1 : 0;
+            ++m_stats.reclassified;
+        }
+    });
+
+    // The few ground items are validated every pass: they may have been picked up since
+    const std::span<void* const> objects = m_diff.GetSlots();
+    for (uint32_t i = 0; i < capacity; ++i) {
+        if (objects[i]) {
+            ++m_stats.listItems;
+        }
+        if (!m_ground[i]) continue;
+        if (ReadGroundItem(i, objects[i], slot)) {
+            m_groundSlots.push_back(slot);
+        } else {
+            m_ground[i] = 0;
+        }
+    }
+    m_stats.groundItems = static_cast<uint32_t>(m_groundSlots.size());
+
+    return m_groundSlots;
+}
+
+void GroundItemIndex::Clear() {
+    m_diff.Clear();
+    m_ground.clear();
+    m_groundSlots.clear();
+    m_stats = Stats{};
+}
+
+} // namespace kx
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "../../Memory/PointerArrayDiff.h"
+#include "../../Memory/ValidatedSlot.h"
+
+namespace kx {
+
+/**
+ * @brief Incrementally maintained index of the ground items in the ItCliContext item list
+ *
+ * The item list holds every equipped, bagged and vendor item of every loaded character; the
+ * ground drops (ItemLocation::Agent) are a handful among thousands. The pointer array is diffed
+ * against the previous pass (SafeAccess::PointerArrayDiff): only slots whose pointer changed
+ * (including slots added when the list grows) are classified again.
+ * Ground slots are re-validated every pass, and a few unchanged slots are re-checked per pass
+ * in round-robin to catch items whose location changes in place.
+ *
+ * Owned by the thread running the pass (see ExtractionContext). Cleared on map change
+ * (ExtractionContext::ClearMapState()): the pointer diff only holds within one item list.
+ */
+class GroundItemIndex {
+public:
+    // Unchanged non-ground slots re-classified per pass
+    static constexpr uint32_t RECHECK_PER_PASS = 256;
+
+    struct Stats {
+        uint32_t listItems = 0;     // Occupied slots of the item list
+        uint32_t groundItems = 0;   // Of which lie on the ground
+        uint32_t reclassified = 0;  // Slots classified this pass (changed, new or re-checked)
+    };
+
+    GroundItemIndex() = default;
+
+    /**
+     * @brief Bring the index up to date with the item list
+     * @param list The game's sparse item pointer array
+     * @param capacity Number of slots in the array
+     * @return The ground items in slot order, validated this pass; valid until the next Update()
+     */
+    std::span<const SafeAccess::ValidatedSlot> Update(void** list, uint32_t capacity);
+
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+
+    /**
+     * @brief Forget every classification and the stats (e.g., on map change)
+     */
+    void Clear();
+
+private:
+    SafeAccess::PointerArrayDiff m_diff;
+    std::vector<uint8_t> m_ground;      // Slot -> 1 if classified as a ground item
+    std::vector<SafeAccess::ValidatedSlot> m_groundSlots;
+    Stats m_stats;
+};
+
+} // namespace kx
@@ -0,0 +1,118 @@
+#include "PlayerRoster.h"
+#include "../SdkStructs.h"
+#include "../../Memory/MemorySource.h"
+#include "../../Memory/Safety.h"
+#include "../../Utils/StringHelpers.h"
+
+namespace kx {
+
+void PlayerRoster::Update(void** list, uint32_t capacity) {
+    m_stats.namesTranscoded = 0;
+    if (!m_diff.Read(list, capacity)) {
+        Clear();
+        return;
+    }
+
+    // A shrinking list drops the entries of its tail; a growing one adds empty slots
+    for (uint32_t slot = capacity; slot < m_characters.size(); ++slot) {
+        EraseSlot(slot);
+    }
+    m_characters.resize(capacity, nullptr);
+
+    m_diff.ForEachChanged([this](uint32_t slot, void* player) {
+        ReadSlot(slot, player);
+    });
+
+    // Round-robin re-read of unchanged slots: a player object can get a new character in place
+    m_diff.ForEachRecheck(RECHECK_PER_PASS, [this](uint32_t slot, void* player) {
+        if (player) {
+            ReadSlot(slot, player);
+        }
+    });
+
+    m_stats.players = static_cast<uint32_t>(m_byCharacter.size());
+}
+
+void PlayerRoster::ReadSlot(uint32_t slot, void* player) {
+    ReClass::ChCliPlayer::Fields fields;
+    if (player && SafeAccess::IsValidGameObject(player)) {
+        ReClass::ChCliPlayer wrapper(nullptr);
+        wrapper.AdoptValidated(player);
+        fields = wrapper.ReadFields();
+    }
+
+    // Unchanged player: keep the converted name
+    const void* previous = m_characters[slot];
+    if (previous && previous == fields.character) {
+        const auto it = m_byCharacter.find(previous);
+        if (it != m_byCharacter.end() && it->second.slot == slot && it->second.nameSource == fields.name) {
+            return;
+        }
+    }
+
+    EraseSlot(slot);
+    if (!fields.character) {
+        return;
+    }
+
+    Entry& entry = m_byCharacter[fields.character];
+    entry = Entry{};
+    entry.nameSource = fields.name;
+    entry.slot = slot;
+    TranscodeName(fields.name, entry.name);
+    m_characters[slot] = fields.character;
+    ++m_stats.namesTranscoded;
+}
+
+void PlayerRoster::EraseSlot(uint32_t slot) {
+    if (slot >= m_characters.size()) {
+        return;
+    }
+    if (const void* character = m_characters[slot]) {
+        // Another slot may have claimed the character since; its entry stays
+        const auto it = m_byCharacter.find(character);
+        if (it != m_byCharacter.end() && it->second.slot == slot) {
+            m_byCharacter.erase(it);
+        }
+        m_characters[slot] = nullptr;
+    }
+}
+
+void PlayerRoster::BindAgent(const void* character, int32_t agentId) {
+    const auto it = m_byCharacter.find(character);
+    if (it == m_byCharacter.end()) {
+        return;
+    }
+
+    Entry& entry = it->second;
+    if (entry.agentId == 0) {
+        entry.agentId = agentId;
+    } else if (entry.agentId != agentId) {
+        // The character's memory now belongs to another agent: the next Update() reads the slot again
+        m_diff.Invalidate(entry.slot);
+        entry.nameSource = nullptr;
+        entry.agentId = agentId;
+    }
+}
+
+void PlayerRoster::TranscodeName(const wchar_t* source, std::span<char> out) {
+    if (!source) {
+        out[0] = '\0';
+    } else if (MemorySource::IsLive()) {
+        StringHelpers::WriteWCharToUTF8(source, out);
+    } else {
+        // Recorded/replayed memory: copy the characters through the memory source first
+        wchar_t buffer[NAME_SIZE];
+        MemorySource::CopyWideString(source, buffer, std::size(buffer));
+        StringHelpers::WriteWCharToUTF8(buffer, out);
+    }
+}
+
+void PlayerRoster::Clear() {
+    m_byCharacter.clear();
+    m_diff.Clear();
+    m_characters.clear();
+    m_stats = Stats{};
+}
+
+} // namespace kx
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <ankerl/unordered_dense.h>
+#include "../Data/EntityData.h"
+#include "../../Memory/PointerArrayDiff.h"
+
+namespace kx {
+
+/**
+ * @brief Players of the ChCliContext player list with their names already converted to UTF-8
+ *
+ * Names never change while a player is loaded, yet the player list used to be re-read and
+ * every name re-transcoded on every pass. The roster diffs the list's pointer array against
+ * the previous pass (SafeAccess::PointerArrayDiff) and re-reads only the slots whose player
+ * changed, plus a few slots per pass in round-robin. Entries are keyed by character pointer and tagged with the agentId the
+ * extraction saw: a character whose agent changed under the same address is re-read.
+ *
+ * Updated on the thread running the pass, before the fork; read-only during the fork.
+ * Cleared on map change (ExtractionContext::ClearMapState()): the new map reuses character addresses.
+ */
+class PlayerRoster {
+public:
+    static constexpr size_t NAME_SIZE = sizeof(PlayerEntity::playerName);
+
+    // Unchanged slots re-read per pass
+    static constexpr uint32_t RECHECK_PER_PASS = 8;
+
+    struct Entry {
+        const wchar_t* nameSource = nullptr;  // Name string in game memory
+        uint32_t slot = 0;                     // Player list slot the entry came from
+        int32_t agentId = 0;                   // Agent seen by the extraction; 0 until the first pass
+        char name[NAME_SIZE] = {};             // UTF-8, null-terminated
+    };
+
+    struct Stats {
+        uint32_t players = 0;           // Entries in the roster
+        uint32_t namesTranscoded = 0;   // Names converted this pass
+    };
+
+    PlayerRoster() = default;
+
+    /**
+     * @brief Bring the roster up to date with the player list
+     * @param list The game's sparse ChCliPlayer pointer array
+     * @param capacity Number of slots in the array
+     */
+    void Update(void** list, uint32_t capacity);
+
+    /**
+     * @brief Entry of the player owning a character
+     * @return The entry, or nullptr if the character is not a player. Valid until the next Update().
+     */
+    [[nodiscard]] const Entry* Find(const void* character) const {
+        const auto it = m_byCharacter.find(character);
+        return it != m_byCharacter.end() ? &it->second : nullptr;
+    }
+
+    /**
+     * @brief Record the agent extracted for a character; a different agent than before makes
+     *        the next Update() re-read the entry's slot
+     */
+    void BindAgent(const void* character, int32_t agentId);
+
+    /**
+     * @brief Convert a name in game memory to UTF-8 (through the memory source unless live)
+     */
+    static void TranscodeName(const wchar_t* source, std::span<char> out);
+
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+
+    /**
+     * @brief Drop every entry and the stats (e.g., on map change)
+     */
+    void Clear();
+
+private:
+    void ReadSlot(uint32_t slot, void* player);
+    void EraseSlot(uint32_t slot);
+
+    ankerl::unordered_dense::map<const void*, Entry> m_byCharacter;
+    SafeAccess::PointerArrayDiff m_diff;        // Slot -> player last read
+    std::vector<const void*> m_characters;      // Slot -> character key of its entry, or nullptr
+    Stats m_stats;
+};
+
+} // namespace kx
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "../../Memory/ValidatedSlot.h"
+
+namespace kx {
+
+/**
+ * @brief Software pipeline over a validated slot list whose entities are decoded by chasing pointers
+ *
+ * Decoding an entity walks object -> agent -> coordinate system, and on a large game heap each
+ * hop is a likely cache miss. Advance(i), called before slot i is decoded:
+ * - first hop: requests the hot lines of the object `distance` slots ahead
+ * - second hop: for the object distance/2 ahead (its lines requested earlier, so they should
+ *   have arrived), reads the agent pointer and requests the agent's header lines
+ * The misses of the next entities then overlap the decode of the current one.
+ *
+ * @tparam Object Wrapper with static PrefetchHot(const void*) and PeekAgent(const void*)
+ * @tparam Agent  Wrapper with static PrefetchHeader(const void*)
+ */
+template<typename Object, typename Agent>
+class PrefetchPipeline {
+public:
+    static constexpr uint32_t MAX_DISTANCE = 32;
+
+    /**
+     * @param distance Slots to look ahead; 0 disables the pipeline
+     */
+    PrefetchPipeline(std::span<const SafeAccess::ValidatedSlot> slots, uint32_t distance)
+        : m_slots(slots),
+          m_distance(distance < MAX_DISTANCE ? distance : MAX_DISTANCE),
+          m_agentDistance(m_distance / 2) {
+        // Warm-up: the first objects are requested now, Advance() takes over from there
+        const size_t warm = m_distance < slots.size() ? m_distance : slots.size();
+        for (size_t i = 0; i < warm; ++i) {
+            Object::PrefetchHot(slots[i].object);
+        }
+    }
+
+    void Advance(size_t index) const {
+        if (m_distance == 0) return;
+
+        if (index + m_distance < m_slots.size()) {
+            Object::PrefetchHot(m_slots[index + m_distance].object);
+        }
+        if (index + m_agentDistance < m_slots.size()) {
+            if (const void* agent = Object::PeekAgent(m_slots[index + m_agentDistance].object)) {
+                Agent::PrefetchHeader(agent);
+            }
+        }
+    }
+
+private:
+    std::span<const SafeAccess::ValidatedSlot> m_slots;
+    uint32_t m_distance;
+    uint32_t m_agentDistance;
+};
+
+} // namespace kx
@@ -0,0 +1,35 @@
+#include "ShapeDimensionCache.h"
+
+namespace kx {
+
+bool ShapeDimensionCache::TryApply(const void* shape, uint8_t typeTag, Path path, GameEntity& entity) {
+    auto it = m_entries.find(shape);
+    if (it == m_entries.end() || it->second.typeTag != typeTag || it->second.path != path) {
+        ++m_stats.misses;
+        return false;
+    }
+
+    const Entry& entry = it->second;
+    entity.shapeType = entry.shapeType;
+    entity.physicsWidth = entry.width;
+    entity.physicsDepth = entry.depth;
+    entity.physicsHeight = entry.height;
+    entity.hasPhysicsDimensions = true;
+    ++m_stats.hits;
+    return true;
+}
+
+void ShapeDimensionCache::Store(const void* shape, uint8_t typeTag, Path path, const GameEntity& entity) {
+    if (!entity.hasPhysicsDimensions) return;
+
+    if (m_entries.size() >= MAX_ENTRIES && !m_entries.contains(shape)) {
+        m_entries.clear();
+    }
+    m_entries[shape] = { typeTag, path, entity.shapeType, entity.physicsWidth, entity.physicsDepth, entity.physicsHeight };
+}
+
+void ShapeDimensionCache::Clear() {
+    m_entries.clear();
+}
+
+} // namespace kx
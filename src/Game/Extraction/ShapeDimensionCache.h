@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <ankerl/unordered_dense.h>
+#include "../Data/EntityData.h"
+
+namespace kx {
+
+/**
+ * @brief Resolved Havok shape dimensions, keyed by shape pointer
+ *
+ * Resolving a shape walks rigid body -> shape (-> MOPP -> extended mesh) and validates
+ * every extent, yet the collision shapes of an agent almost never change. Entries are
+ * tagged with the shape's primitive type byte and the path that resolved them; a lookup
+ * with a different tag is a miss, so memory reused for another kind of shape is re-read.
+ *
+ * Only successful resolutions are stored. Shapes are map resources: clear on map change.
+ */
+class ShapeDimensionCache {
+public:
+    // The same shape can be reached through several paths that map its extents differently
+    enum class Path : uint8_t {
+        PlayerRigidBody,    // CoChar rigid body, extents used as-is
+        NpcBox,             // CoCharSimpleCliWrapper box shape, height only
+        KeyframedRigidBody  // CoKeyFramed rigid body, mapping depends on the shape type
+    };
+
+    // Past this many shapes the cache starts over rather than growing for the whole session
+    static constexpr size_t MAX_ENTRIES = 16384;
+
+    struct Stats {
+        uint32_t hits = 0;      // Chain walks saved
+        uint32_t misses = 0;    // Chain walks done
+    };
+
+    ShapeDimensionCache() = default;
+
+    /**
+     * @brief Copy the cached dimensions of a shape into an entity
+     * Counts a hit or a miss.
+     * @param typeTag Primitive type byte read from the shape this pass
+     * @return False if the shape is unknown or its tag changed
+     */
+    bool TryApply(const void* shape, uint8_t typeTag, Path path, GameEntity& entity);
+
+    /**
+     * @brief Remember the dimensions just resolved into an entity
+     * Ignored unless the entity has physics dimensions.
+     */
+    void Store(const void* shape, uint8_t typeTag, Path path, const GameEntity& entity);
+
+    /**
+     * @brief Reset the counters. Call once per extraction pass.
+     */
+    void ResetStats() { m_stats = Stats{}; }
+
+    [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+    [[nodiscard]] size_t Size() const { return m_entries.size(); }
+
+    /**
+     * @brief Drop all entries (e.g., on map change)
+     */
+    void Clear();
+
+private:
+    struct Entry {
+        uint8_t typeTag = 0;
+        Path path = Path::KeyframedRigidBody;
+        Havok::HkcdShapeType shapeType = Havok::HkcdShapeType::INVALID;
+        float width = 0.0f;
+        float depth = 0.0f;
+        float height = 0.0f;
+    };
+
+    ankerl::unordered_dense::map<const void*, Entry> m_entries;
+    Stats m_stats;
+};
+
+} // namespace kx
@@ -0,0 +1,123 @@
+#include "StagingPrimer.h"
+#include "../SdkStructs.h"
+#include "../../Memory/MemorySource.h"
+#include "../../Memory/SafeGameArray.h"
+#include "../../Memory/Safety.h"
+#include "EntityExtractor.h"
+
+namespace kx {
+
+namespace {
+
+    // Wrapper of a changed slot's object, or an empty wrapper if the slot is empty or invalid
+    template <typename T>
+    T AdoptObject(void* object) {
+        T wrapper(nullptr);
+        if (object && SafeAccess::IsValidGameObject(object)) {
+            wrapper.AdoptValidated(object);
+        }
+        return wrapper;
+    }
+
+    // Read this pass's pointers of one list; an unreadable list forgets its baseline
+    template <typename T>
+    bool ReadList(SafeAccess::PointerArrayDiff& diff, const SafeAccess::SafeGameArray<T>& list) {
+        return diff.Read(list.GetRawArray(), list.GetCapacity());
+    }
+
+} // namespace
+
+uint32_t StagingPrimer::Prime(ExtractionCategoryMask categories, uint64_t now) {
+    void* contextCollection = MemorySource::GetContextCollectionPtr();
+    if (!contextCollection || !SafeAccess::IsMemorySafe(contextCollection)) {
+        return 0;
+    }
+    ReClass::ContextCollection collection(nullptr);
+    collection.AdoptValidated(contextCollection);
+    const ReClass::ContextCollection::Contexts contexts = collection.ReadContexts();
+
+    auto reads = [categories](ExtractionCategory category) {
+        return (categories & CategoryBit(category)) != 0;
+    };
+
+    // Cold on every call: a cached record or shape would skip the pages behind it
+    m_records.Clear();
+    m_records.BeginTick(now);
+    m_shapes.Clear();
+
+    uint32_t primed = 0;
+    const bool playersRead = reads(ExtractionCategory::Players);
+    const bool npcsRead = reads(ExtractionCategory::Npcs);
+    const ReClass::ChCliContext charContext(contexts.character);
+    if ((playersRead || npcsRead) && charContext.data()) {
+        const SafeAccess::SafeGameArray<ReClass::ChCliPlayer> playerList = charContext.GetPlayers();
+        m_roster.Update(playerList.GetRawArray(), playerList.GetCapacity());
+        void* localPlayer = MemorySource::GetLocalPlayerPtr();
+
+        if (ReadList(m_characters, charContext.GetCharacters())) {
+            m_characters.ForEachChanged([&](uint32_t slot, void* object) {
+                const ReClass::ChCliCharacter character = AdoptObject<ReClass::ChCliCharacter>(object);
+                if (!character.data()) return;
+
+                // A character of a category this decode skips is reported again next call
+                const PlayerRoster::Entry* entry = m_roster.Find(object);
+                if (entry ? !playersRead : !npcsRead) {
+                    m_characters.Invalidate(slot);
+                    return;
+                }
+                if (entry) {
+                    EntityExtractor::ExtractPlayer(m_player, character, entry, localPlayer, m_records, m_shapes);
+                } else {
+                    EntityExtractor::ExtractNpc(m_npc, character, m_records, m_shapes);
+                }
+                ++primed;
+            });
+        }
+    }
+
+    const ReClass::GdCliContext gadgetContext(contexts.gadget);
+    if (reads(ExtractionCategory::Gadgets) && gadgetContext.data() && ReadList(m_gadgets, gadgetContext.GetGadgets())) {
+        m_gadgets.ForEachChanged([&](uint32_t, void* object) {
+            const ReClass::GdCliGadget gadget = AdoptObject<ReClass::GdCliGadget>(object);
+            if (!gadget.data()) return;
+            StaticGadgetCache::Lookup lookup; // No cached entry: the position and shape pages are read
+            EntityExtractor::ExtractGadget(m_gadget, gadget, m_shapes, lookup);
+            ++primed;
+        });
+    }
+    if (reads(ExtractionCategory::AttackTargets) && gadgetContext.data() && ReadList(m_attackTargets, gadgetContext.GetAttackTargets())) {
+        m_attackTargets.ForEachChanged([&](uint32_t, void* object) {
+            const ReClass::AgentInl agentInl = AdoptObject<ReClass::AgentInl>(object);
+            if (!agentInl.data()) return;
+            EntityExtractor::ExtractAttackTarget(m_attackTarget, agentInl, m_shapes);
+            ++primed;
+        });
+    }
+
+    // Bagged and equipped items stop at their location: only ground items are read further
+    const ReClass::ItCliContext itemContext(contexts.item);
+    if (reads(ExtractionCategory::Items) && itemContext.data() && ReadList(m_items, itemContext.GetItems())) {
+        m_items.ForEachChanged([&](uint32_t, void* object) {
+            const ReClass::ItCliItem item = AdoptObject<ReClass::ItCliItem>(object);
+            if (!item.data()) return;
+            if (EntityExtractor::ExtractItem(m_item, item, m_shapes)) {
+                ++primed;
+            }
+        });
+    }
+
+    m_records.Clear();
+    return primed;
+}
+
+void StagingPrimer::Clear() {
+    m_characters.Clear();
+    m_gadgets.Clear();
+    m_attackTargets.Clear();
+    m_items.Clear();
+    m_roster.Clear();
+    m_records.Clear();
+    m_shapes.Clear();
+}
+
+} // namespace kx
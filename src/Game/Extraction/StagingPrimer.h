@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include "../Data/EntityData.h"
+#include "../../Memory/PointerArrayDiff.h"
+#include "EntityRecordCache.h"
+#include "ExtractionScheduler.h"
+#include "PlayerRoster.h"
+#include "ShapeDimensionCache.h"
+
+namespace kx {
+
+/**
+ * @brief Capture-time read of the entities that newly occupy a list slot (background decode)
+ *
+ * The staging capture copies the pages the previous decode read, so an entity that was not in
+ * any list then has none of its pages in the image. The primer diffs the character, gadget,
+ * attack target and item pointer arrays (SafeAccess::PointerArrayDiff) and reads every entity
+ * of a changed slot once, in full, while the capture records into the staging image: the decode
+ * of the same pass finds all of its pages. The first capture after the primer is cleared reads
+ * every entity of the lists, so the first decode is complete as well.
+ *
+ * Game Thread only; runs under a MemorySource::ScopedRecording on the staging image. The primed
+ * entities themselves are discarded: records and shape dimensions start cold on every call, so
+ * every page the decode may walk is recorded.
+ */
+class StagingPrimer {
+public:
+    StagingPrimer() = default;
+
+    /**
+     * @brief Read the entities of the list slots that changed since the last call
+     * @param categories Categories the coming decode reads; slots of the others are kept for later
+     * @param now Current time in milliseconds
+     * @return Number of entities read
+     */
+    uint32_t Prime(ExtractionCategoryMask categories, uint64_t now);
+
+    /**
+     * @brief Forget every list (map change, or background decode switched off)
+     */
+    void Clear();
+
+private:
+    SafeAccess::PointerArrayDiff m_characters;
+    SafeAccess::PointerArrayDiff m_gadgets;
+    SafeAccess::PointerArrayDiff m_attackTargets;
+    SafeAccess::PointerArrayDiff m_items;
+
+    // Tells players from NPCs; records their name pages on the way
+    PlayerRoster m_roster;
+    EntityRecordCache m_records;
+    ShapeDimensionCache m_shapes;
+
+    // Scratch entities the primed reads are written to
+    PlayerEntity m_player;
+    NpcEntity m_npc;
+    GadgetEntity m_gadget;
+    AttackTargetEntity m_attackTarget;
+    ItemEntity m_item;
+};
+
+} // namespace kx
@@ -0,0 +1,65 @@
+#include "StaticGadgetCache.h"
+
+namespace kx {
+
+bool StaticGadgetCache::IsStaticType(Game::GadgetType type) {
+    switch (type) {
+    case Game::GadgetType::Crafting:
+    case Game::GadgetType::BountyBoard:
+    case Game::GadgetType::MapPortal:
+    case Game::GadgetType::Waypoint:
+    case Game::GadgetType::ResourceNode:
+    case Game::GadgetType::Vista:
+        return true;
+    default:
+        return false; // Doors, siege, player-created and event gadgets can move or animate
+    }
+}
+
+StaticGadgetCache::Entry StaticGadgetCache::Capture(const GadgetEntity& gadget, const void* coKeyframed) {
+    Entry entry;
+    entry.agent = gadget.agent;
+    entry.coKeyframed = coKeyframed;
+    entry.agentId = gadget.agentId;
+    entry.agentType = gadget.agentType;
+    entry.type = gadget.type;
+    entry.position = gadget.position;
+    entry.physicsWidth = gadget.physicsWidth;
+    entry.physicsDepth = gadget.physicsDepth;
+    entry.physicsHeight = gadget.physicsHeight;
+    entry.hasPhysicsDimensions = gadget.hasPhysicsDimensions;
+    entry.shapeType = gadget.shapeType;
+    return entry;
+}
+
+void StaticGadgetCache::Entry::ApplyTo(GadgetEntity& gadget) const {
+    gadget.position = position;
+    gadget.physicsWidth = physicsWidth;
+    gadget.physicsDepth = physicsDepth;
+    gadget.physicsHeight = physicsHeight;
+    gadget.hasPhysicsDimensions = hasPhysicsDimensions;
+    gadget.shapeType = shapeType;
+}
+
+void StaticGadgetCache::BeginPass(uint32_t mapId) {
+    if (mapId != m_mapId) {
+        m_entries.clear();
+        m_mapId = mapId;
+    }
+}
+
+void StaticGadgetCache::Store(const void* gadget, const Entry& entry) {
+    if (!IsEnabled()) return;
+
+    if (m_entries.size() >= MAX_ENTRIES && !m_entries.contains(gadget)) {
+        m_entries.clear();
+    }
+    m_entries[gadget] = entry;
+}
+
+void StaticGadgetCache::Clear() {
+    m_entries.clear();
+    m_mapId = 0;
+}
+
+} // namespace kx
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <ankerl/unordered_dense.h>
+#include "../Data/EntityData.h"
+
+namespace kx {
+
+/**
+ * @brief Positions and shape dimensions of gadgets that never move within a map instance
+ *
+ * Waypoints, vistas, crafting stations, resource nodes and the like make up most of an
+ * open-world gadget list, yet each one's CoKeyFramed position and Havok shape were read
+ * on every pass. A gadget of a static type is stored on first sight, keyed by its address;
+ * later passes still read its wrapper and agent header (liveness, agentId, coordinate system
+ * pointer) and its state fields (health, depleted nodes), but take the position and shape
+ * from the entry as long as those match what was stored.
+ *
+ * Entries belong to one MumbleLink map ID and are dropped when it changes. Find() is safe
+ * during the fork; Store() runs on the forking thread after the join.
+ */
+class StaticGadgetCache {
+public:
+    // Past this many gadgets the cache starts over rather than growing for the whole session
+    static constexpr size_t MAX_ENTRIES = 8192;
+
+    struct Entry {
+        const void* agent = nullptr;        // AgKeyFramed* seen on first sight
+        const void* coKeyframed = nullptr;  // Its coordinate system
+        int32_t agentId = 0;
+        Game::AgentType agentType = static_cast<Game::AgentType>(0);
+        Game::GadgetType type = Game::GadgetType::None;
+        glm::vec3 position{ 0.0f };         // Mumble space
+        float physicsWidth = 0.0f;
+        float physicsDepth = 0.0f;
+        float physicsHeight = 0.0f;
+        bool hasPhysicsDimensions = false;
+        Havok::HkcdShapeType shapeType = Havok::HkcdShapeType::INVALID;
+
+        /**
+         * @brief Whether the gadget read this pass is still the one the entry was made from
+         */
+        [[nodiscard]] bool Matches(const void* agentRead, int32_t agentIdRead, Game::AgentType agentTypeRead,
+            const void* coKeyframedRead, Game::GadgetType typeRead) const {
+            return agent == agentRead && agentId == agentIdRead && agentType == agentTypeRead &&
+                coKeyframed == coKeyframedRead && type == typeRead;
+        }
+
+        void ApplyTo(GadgetEntity& gadget) const;
+    };
+
+    /**
+     * @brief Per-gadget exchange with EntityExtractor::ExtractGadget
+     */
+    struct Lookup {
+        const Entry* cached = nullptr;      // In: the gadget's entry, if any
+        bool hit = false;                   // Out: position and shape were taken from the entry
+        const void* coKeyframed = nullptr;  // Out: coordinate system pointer read this pass
+    };
+
+    StaticGadgetCache() = default;
+
+    /**
+     * @brief Whether gadgets of a type stay where they are for the lifetime of the map instance
+     */
+    [[nodiscard]] static bool IsStaticType(Game::GadgetType type);
+
+    /**
+     * @brief Build the entry of a gadget that was just read in full
+     */
+    [[nodiscard]] static Entry Capture(const GadgetEntity& gadget, const void* coKeyframed);
+
+    /**
+     * @brief Start a pass on a map; a different map ID than last pass drops every entry
+     * @param mapId MumbleLink map ID (0 = unknown: the cache is disabled)
+     */
+    void BeginPass(uint32_t mapId);
+
+    [[nodiscard]] bool IsEnabled() const { return m_mapId != 0; }
+
+    /**
+     * @brief Entry stored for a gadget wrapper address, or nullptr
+     */
+    [[nodiscard]] const Entry* Find(const void* gadget) const {
+        if (!IsEnabled()) {
+            return nullptr;
+        }
+        const auto it = m_entries.find(gadget);
+        return it != m_entries.end() ? &it->second : nullptr;
+    }
+
+    /**
+     * @brief Store or replace the entry of a gadget
+     */
+    void Store(const void* gadget, const Entry& entry);
+
+    [[nodiscard]] size_t Size() const { return m_entries.size(); }
+
+    /**
+     * @brief Drop all entries and forget the map
+     */
+    void Clear();
+
+private:
+    ankerl::unordered_dense::map<const void*, Entry> m_entries;
+    uint32_t m_mapId = 0;
+};
+
+} // namespace kx
@@ -29,11 +29,11 @@ namespace kx {
          */
         class CoCharSimpleCliWrapper : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t POSITION_ALT1 = 0xB8;    // glm::vec3 alternative position 1
-                static constexpr uintptr_t POSITION_ALT2 = 0x118;   // glm::vec3 alternative position 2 (may lag)
-                static constexpr uintptr_t PHYSICS_PHANTOM_PLAYER = 0x78;  // hkpSimpleShapePhantom* physics object (PLAYER ONLY) - see HavokOffsets.h
-                static constexpr uintptr_t BOX_SHAPE_NPC = 0xE8;        // hkpBoxShape* physics box shape (NPC ONLY - Players are nullptr) - see HavokOffsets.h
+            struct Schema {
+                static constexpr FieldSchema::Field<glm::vec3> POSITION_ALT1{ 0xB8, "positionAlt1" };  // glm::vec3 alternative position 1
+                static constexpr FieldSchema::Field<glm::vec3> POSITION_ALT2{ 0x118, "positionAlt2" };  // glm::vec3 alternative position 2 (may lag)
+                static constexpr FieldSchema::Field<void*> PHYSICS_PHANTOM_PLAYER{ 0x78, "physicsPhantomPlayer" };  // hkpSimpleShapePhantom* physics object (PLAYER ONLY) - see HavokOffsets.h
+                static constexpr FieldSchema::Field<void*> BOX_SHAPE_NPC{ 0xE8, "boxShapeNpc" };  // hkpBoxShape* physics box shape (NPC ONLY - Players are nullptr) - see HavokOffsets.h
             };
 
         public:
@@ -44,7 +44,7 @@ namespace kx {
                 if (!data()) {
                     return { 0.0f, 0.0f, 0.0f };
                 }
-                return ReadMemberFast<glm::vec3>(Offsets::POSITION_ALT1, { 0.0f, 0.0f, 0.0f });
+                return ReadFieldFast<Schema::POSITION_ALT1>({ 0.0f, 0.0f, 0.0f });
             }
 
             glm::vec3 GetPositionAlt2() const {
@@ -53,15 +53,15 @@ namespace kx {
                 if (!data()) {
                     return { 0.0f, 0.0f, 0.0f };
                 }
-                return ReadMemberFast<glm::vec3>(Offsets::POSITION_ALT2, { 0.0f, 0.0f, 0.0f });
+                return ReadFieldFast<Schema::POSITION_ALT2>({ 0.0f, 0.0f, 0.0f });
             }
 
             HkpSimpleShapePhantom GetPhysicsPhantom() const {
-                return ReadPointerFast<HkpSimpleShapePhantom>(Offsets::PHYSICS_PHANTOM_PLAYER);
+                return ReadPointerFast<HkpSimpleShapePhantom>(Schema::PHYSICS_PHANTOM_PLAYER.offset);
             }
 
             HkpBoxShape GetBoxShapeNpc() const {
-                return ReadPointerFast<HkpBoxShape>(Offsets::BOX_SHAPE_NPC);
+                return ReadPointerFast<HkpBoxShape>(Schema::BOX_SHAPE_NPC.offset);
             }
         };
 
@@ -71,10 +71,10 @@ namespace kx {
          */
         class CoChar : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t VISUAL_POSITION = 0x30;  // glm::vec3 position (primary)
-                static constexpr uintptr_t RIGID_BODY_PLAYER = 0x60;       // hkpRigidBody* physics rigid body (PLAYER ONLY - NPCs are nullptr) - see HavokOffsets.h
-                static constexpr uintptr_t SIMPLE_CLI_WRAPPER = 0x88;   // CoCharSimpleCliWrapper* - contains additional position data and physics info
+            struct Schema {
+                static constexpr FieldSchema::Field<glm::vec3> VISUAL_POSITION{ 0x30, "visualPosition" };  // glm::vec3 position (primary)
+                static constexpr FieldSchema::Field<void*> RIGID_BODY_PLAYER{ 0x60, "rigidBodyPlayer" };  // hkpRigidBody* physics rigid body (PLAYER ONLY - NPCs are nullptr) - see HavokOffsets.h
+                static constexpr FieldSchema::Field<void*> SIMPLE_CLI_WRAPPER{ 0x88, "simpleCliWrapper" };  // CoCharSimpleCliWrapper* - contains additional position data and physics info
             };
 
         public:
@@ -87,17 +87,17 @@ namespace kx {
                     return { 0.0f, 0.0f, 0.0f };
                 }
                 
-                glm::vec3 result = ReadMemberFast<glm::vec3>(Offsets::VISUAL_POSITION, { 0.0f, 0.0f, 0.0f });
+                glm::vec3 result = ReadFieldFast<Schema::VISUAL_POSITION>({ 0.0f, 0.0f, 0.0f });
                 
                 return result;
             }
 
             HkpRigidBody GetRigidBodyPlayer() const {
-                return ReadPointerFast<HkpRigidBody>(Offsets::RIGID_BODY_PLAYER);
+                return ReadPointerFast<HkpRigidBody>(Schema::RIGID_BODY_PLAYER.offset);
             }
 
             CoCharSimpleCliWrapper GetSimpleCliWrapper() const {
-                return ReadPointerFast<CoCharSimpleCliWrapper>(Offsets::SIMPLE_CLI_WRAPPER);
+                return ReadPointerFast<CoCharSimpleCliWrapper>(Schema::SIMPLE_CLI_WRAPPER.offset);
             }
         };
 
@@ -106,38 +106,62 @@ namespace kx {
          */
         class AgChar : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t CO_CHAR = 0x50;  // CoChar* coordinate system
-                static constexpr uintptr_t TYPE = 0x08;     // int32_t agent type identifier
-                static constexpr uintptr_t ID = 0x0C;       // int32_t agent ID
-                static constexpr uintptr_t GROUNDED_POSITION32 = 0x120;  // glm::vec3 last grounded/navmesh position (scaled by 32)
+            struct Schema {
+                static constexpr FieldSchema::Field<void*> CO_CHAR{ 0x50, "coChar" };  // CoChar* coordinate system
+                static constexpr FieldSchema::Field<uint32_t> TYPE{ 0x08, "type" };  // uint32_t agent type identifier
+                static constexpr FieldSchema::Field<int32_t> ID{ 0x0C, "id" };  // int32_t agent ID
+                static constexpr FieldSchema::Field<glm::vec3> GROUNDED_POSITION32{ 0x120, "groundedPosition32" };  // glm::vec3 last grounded/navmesh position (scaled by 32)
+
+                static constexpr FieldSchema::Span HEADER = FieldSchema::CoveringSpan(TYPE, ID, CO_CHAR);
             };
 
         public:
+            struct Header {
+                bool loaded = false;
+                Game::AgentType type = static_cast<Game::AgentType>(0);
+                int32_t id = 0;
+                void* coChar = nullptr; // Raw CoChar*, not yet validated
+            };
+
             AgChar(void* ptr) : ForeignClass(ptr) {}
 
+            /**
+             * @brief Type, ID and coordinate system pointer from one bulk copy
+             */
+            Header ReadHeader() const {
+                const auto block = ReadBlock<Schema::HEADER>();
+                return { block.IsLoaded(), static_cast<Game::AgentType>(block.Get<Schema::TYPE>()), block.Get<Schema::ID>(), block.Get<Schema::CO_CHAR>() };
+            }
+
+            /**
+             * @brief Pipelined traversal: request the lines ReadHeader() copies
+             */
+            static void PrefetchHeader(const void* agent) {
+                FieldSchema::PrefetchSpan<Schema::HEADER>(agent);
+            }
+
             CoChar GetCoChar() const {
-                LOG_MEMORY("AgChar", "GetCoChar", data(), Offsets::CO_CHAR);
+                LOG_MEMORY("AgChar", "GetCoChar", data(), Schema::CO_CHAR.offset);
                 
-                CoChar result = ReadPointerFast<CoChar>(Offsets::CO_CHAR);
+                CoChar result = ReadPointerFast<CoChar>(Schema::CO_CHAR.offset);
                 
                 LOG_PTR("CoChar", result.data());
                 return result;
             }
 
             Game::AgentType GetType() const {
-                LOG_MEMORY("AgChar", "GetType", data(), Offsets::TYPE);
+                LOG_MEMORY("AgChar", "GetType", data(), Schema::TYPE.offset);
                 
-                uint32_t type = ReadMemberFast<uint32_t>(Offsets::TYPE, 0);
+                uint32_t type = ReadFieldFast<Schema::TYPE>(0);
                 
                 LOG_DEBUG("AgChar::GetType - Type: %u", type);
                 return static_cast<Game::AgentType>(type);
             }
 
             int32_t GetId() const {
-                LOG_MEMORY("AgChar", "GetId", data(), Offsets::ID);
+                LOG_MEMORY("AgChar", "GetId", data(), Schema::ID.offset);
                 
-                int32_t id = ReadMemberFast<int32_t>(Offsets::ID, 0);
+                int32_t id = ReadFieldFast<Schema::ID>(0);
                 
                 LOG_DEBUG("AgChar::GetId - ID: %d", id);
                 return id;
@@ -156,7 +180,7 @@ namespace kx {
                 }
                 
                 // Read the 32-bit scaled grounded position (last known ground/navmesh contact)
-                glm::vec3 rawPos = ReadMemberFast<glm::vec3>(Offsets::GROUNDED_POSITION32, { 0.0f, 0.0f, 0.0f });
+                glm::vec3 rawPos = ReadFieldFast<Schema::GROUNDED_POSITION32>({ 0.0f, 0.0f, 0.0f });
                 
                 // Convert from scaled coordinates to world coordinates
                 // x and y are divided by 32, z is divided by -32 (inverted)
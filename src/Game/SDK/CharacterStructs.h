@@ -14,47 +14,63 @@ namespace kx {
          */
         class ChCliHealth : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t CURRENT = 0x0C;  // float current health
-                static constexpr uintptr_t MAX = 0x10;      // float maximum health
-                static constexpr uintptr_t HEALTH_REGEN_RATE = 0x14; // float health regeneration rate (0 in combat, often 10% of max HP otherwise)
-                static constexpr uintptr_t BARRIER = 0x28;  // float current barrier
+            struct Schema {
+                static constexpr FieldSchema::Field<float> CURRENT{ 0x0C, "current" };  // float current health
+                static constexpr FieldSchema::Field<float> MAX{ 0x10, "max" };          // float maximum health
+                static constexpr FieldSchema::Field<float> HEALTH_REGEN_RATE{ 0x14, "healthRegenRate" }; // float health regeneration rate (0 in combat, often 10% of max HP otherwise)
+                static constexpr FieldSchema::Field<float> BARRIER{ 0x28, "barrier" };  // float current barrier
+
+                static constexpr FieldSchema::Span VALUES = FieldSchema::CoveringSpan(CURRENT, MAX, BARRIER);
             };
 
         public:
+            struct Values {
+                float current = 0.0f;
+                float max = 0.0f;
+                float barrier = 0.0f;
+            };
+
             ChCliHealth(void* ptr) : ForeignClass(ptr) {}
+
+            /**
+             * @brief Current, max and barrier from one bulk copy
+             */
+            Values ReadValues() const {
+                const auto block = ReadBlock<Schema::VALUES>();
+                return { block.Get<Schema::CURRENT>(), block.Get<Schema::MAX>(), block.Get<Schema::BARRIER>() };
+            }
             
             float GetCurrent() const { 
-                LOG_MEMORY("ChCliHealth", "GetCurrent", data(), Offsets::CURRENT);
+                LOG_MEMORY("ChCliHealth", "GetCurrent", data(), Schema::CURRENT.offset);
                 
-                float current = ReadMemberFast<float>(Offsets::CURRENT, 0.0f);
+                float current = ReadFieldFast<Schema::CURRENT>(0.0f);
                 
                 LOG_DEBUG("ChCliHealth::GetCurrent - Current: %.2f", current);
                 return current;
             }
             
             float GetMax() const { 
-                LOG_MEMORY("ChCliHealth", "GetMax", data(), Offsets::MAX);
+                LOG_MEMORY("ChCliHealth", "GetMax", data(), Schema::MAX.offset);
                 
-                float max = ReadMemberFast<float>(Offsets::MAX, 0.0f);
+                float max = ReadFieldFast<Schema::MAX>(0.0f);
                 
                 LOG_DEBUG("ChCliHealth::GetMax - Max: %.2f", max);
                 return max;
             }
 
             float GetHealthRegenRate() const { 
-                LOG_MEMORY("ChCliHealth", "GetHealthRegenRate", data(), Offsets::HEALTH_REGEN_RATE);
+                LOG_MEMORY("ChCliHealth", "GetHealthRegenRate", data(), Schema::HEALTH_REGEN_RATE.offset);
                 
-                float regenRate = ReadMemberFast<float>(Offsets::HEALTH_REGEN_RATE, 0.0f);
+                float regenRate = ReadFieldFast<Schema::HEALTH_REGEN_RATE>(0.0f);
                 
                 LOG_DEBUG("ChCliHealth::GetHealthRegenRate - Regen Rate: %.2f", regenRate);
                 return regenRate;
             }
 
             float GetBarrier() const {
-                LOG_MEMORY("ChCliHealth", "GetBarrier", data(), Offsets::BARRIER);
+                LOG_MEMORY("ChCliHealth", "GetBarrier", data(), Schema::BARRIER.offset);
 
-                float barrier = ReadMemberFast<float>(Offsets::BARRIER, 0.0f);
+                float barrier = ReadFieldFast<Schema::BARRIER>(0.0f);
 
                 LOG_DEBUG("ChCliHealth::GetBarrier - Barrier: %.2f", barrier);
                 return barrier;
@@ -66,27 +82,42 @@ namespace kx {
          */
         class ChCliEnergies : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t CURRENT = 0x0C;  // float current energy
-                static constexpr uintptr_t MAX = 0x10;      // float maximum energy
+            struct Schema {
+                static constexpr FieldSchema::Field<float> CURRENT{ 0x0C, "current" };  // float current energy
+                static constexpr FieldSchema::Field<float> MAX{ 0x10, "max" };          // float maximum energy
+
+                static constexpr FieldSchema::Span VALUES = FieldSchema::CoveringSpan(CURRENT, MAX);
             };
 
         public:
+            struct Values {
+                float current = 0.0f;
+                float max = 0.0f;
+            };
+
             ChCliEnergies(void* ptr) : ForeignClass(ptr) {}
+
+            /**
+             * @brief Current and max from one bulk copy
+             */
+            Values ReadValues() const {
+                const auto block = ReadBlock<Schema::VALUES>();
+                return { block.Get<Schema::CURRENT>(), block.Get<Schema::MAX>() };
+            }
             
             float GetCurrent() const { 
-                LOG_MEMORY("ChCliEnergies", "GetCurrent", data(), Offsets::CURRENT);
+                LOG_MEMORY("ChCliEnergies", "GetCurrent", data(), Schema::CURRENT.offset);
                 
-                float current = ReadMemberFast<float>(Offsets::CURRENT, 0.0f);
+                float current = ReadFieldFast<Schema::CURRENT>(0.0f);
                 
                 LOG_DEBUG("ChCliEnergies::GetCurrent - Current: %.2f", current);
                 return current;
             }
             
             float GetMax() const { 
-                LOG_MEMORY("ChCliEnergies", "GetMax", data(), Offsets::MAX);
+                LOG_MEMORY("ChCliEnergies", "GetMax", data(), Schema::MAX.offset);
                 
-                float max = ReadMemberFast<float>(Offsets::MAX, 0.0f);
+                float max = ReadFieldFast<Schema::MAX>(0.0f);
                 
                 LOG_DEBUG("ChCliEnergies::GetMax - Max: %.2f", max);
                 return max;
@@ -100,27 +131,42 @@ namespace kx {
          */
         class ChCliEndurance : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t CURRENT = 0x10;  // float current endurance
-                static constexpr uintptr_t MAX = 0x14;      // float maximum endurance
+            struct Schema {
+                static constexpr FieldSchema::Field<float> CURRENT{ 0x10, "current" };  // float current endurance
+                static constexpr FieldSchema::Field<float> MAX{ 0x14, "max" };          // float maximum endurance
+
+                static constexpr FieldSchema::Span VALUES = FieldSchema::CoveringSpan(CURRENT, MAX);
             };
 
         public:
+            struct Values {
+                float current = 0.0f;
+                float max = 0.0f;
+            };
+
             ChCliEndurance(void* ptr) : ForeignClass(ptr) {}
+
+            /**
+             * @brief Current and max from one bulk copy
+             */
+            Values ReadValues() const {
+                const auto block = ReadBlock<Schema::VALUES>();
+                return { block.Get<Schema::CURRENT>(), block.Get<Schema::MAX>() };
+            }
             
             float GetCurrent() const { 
-                LOG_MEMORY("ChCliEndurance", "GetCurrent", data(), Offsets::CURRENT);
+                LOG_MEMORY("ChCliEndurance", "GetCurrent", data(), Schema::CURRENT.offset);
                 
-                float current = ReadMemberFast<float>(Offsets::CURRENT, 0.0f);
+                float current = ReadFieldFast<Schema::CURRENT>(0.0f);
                 
                 LOG_DEBUG("ChCliEndurance::GetCurrent - Current: %.2f", current);
                 return current;
             }
             
             float GetMax() const { 
-                LOG_MEMORY("ChCliEndurance", "GetMax", data(), Offsets::MAX);
+                LOG_MEMORY("ChCliEndurance", "GetMax", data(), Schema::MAX.offset);
                 
-                float max = ReadMemberFast<float>(Offsets::MAX, 0.0f);
+                float max = ReadFieldFast<Schema::MAX>(0.0f);
                 
                 LOG_DEBUG("ChCliEndurance::GetMax - Max: %.2f", max);
                 return max;
@@ -132,52 +178,74 @@ namespace kx {
          */
         class ChCliCoreStats : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t RACE = 0x33;          // uint8_t race ID
-                static constexpr uintptr_t LEVEL = 0xAC;         // uint32_t actual level
-                static constexpr uintptr_t PROFESSION = 0x12C;   // uint32_t profession ID
-                static constexpr uintptr_t SCALED_LEVEL = 0x234; // uint32_t scaled/effective level
+            struct Schema {
+                static constexpr FieldSchema::Field<uint8_t> RACE{ 0x33, "race" };                 // uint8_t race ID
+                static constexpr FieldSchema::Field<uint32_t> LEVEL{ 0xAC, "level" };              // uint32_t actual level
+                static constexpr FieldSchema::Field<uint32_t> PROFESSION{ 0x12C, "profession" };   // uint32_t profession ID
+                static constexpr FieldSchema::Field<uint32_t> SCALED_LEVEL{ 0x234, "scaledLevel" }; // uint32_t scaled/effective level
+
+                static constexpr FieldSchema::Span VALUES = FieldSchema::CoveringSpan(RACE, LEVEL, PROFESSION, SCALED_LEVEL);
             };
 
         public:
+            struct Values {
+                Game::Race race = Game::Race::None;
+                uint32_t level = 0;
+                uint32_t scaledLevel = 0;
+                Game::Profession profession = Game::Profession::None;
+            };
+
             ChCliCoreStats(void* ptr) : ForeignClass(ptr) {}
+
+            /**
+             * @brief All core stats from one bulk copy
+             */
+            Values ReadValues() const {
+                const auto block = ReadBlock<Schema::VALUES>();
+                return {
+                    static_cast<Game::Race>(block.Get<Schema::RACE>()),
+                    block.Get<Schema::LEVEL>(),
+                    block.Get<Schema::SCALED_LEVEL>(),
+                    static_cast<Game::Profession>(block.Get<Schema::PROFESSION>())
+                };
+            }
             
             Game::Race GetRace() const { 
-                LOG_MEMORY("ChCliCoreStats", "GetRace", data(), Offsets::RACE);
+                LOG_MEMORY("ChCliCoreStats", "GetRace", data(), Schema::RACE.offset);
                 
                 if (!data()) {
                     LOG_ERROR("ChCliCoreStats::GetRace - ChCliCoreStats data is null");
                     return Game::Race::None;
                 }
 
-                uint8_t raceValue = ReadMemberFast<uint8_t>(Offsets::RACE, 0);
+                uint8_t raceValue = ReadFieldFast<Schema::RACE>(0);
                 Game::Race race = static_cast<Game::Race>(raceValue);
                 LOG_DEBUG("ChCliCoreStats::GetRace - Race: %u", static_cast<uint8_t>(race));
                 return race;
             }
             
             uint32_t GetLevel() const { 
-                LOG_MEMORY("ChCliCoreStats", "GetLevel", data(), Offsets::LEVEL);
+                LOG_MEMORY("ChCliCoreStats", "GetLevel", data(), Schema::LEVEL.offset);
                 
-                uint32_t level = ReadMemberFast<uint32_t>(Offsets::LEVEL, 0);
+                uint32_t level = ReadFieldFast<Schema::LEVEL>(0);
                 
                 LOG_DEBUG("ChCliCoreStats::GetLevel - Level: %u", level);
                 return level;
             }
 
             uint32_t GetScaledLevel() const {
-                LOG_MEMORY("ChCliCoreStats", "GetScaledLevel", data(), Offsets::SCALED_LEVEL);
+                LOG_MEMORY("ChCliCoreStats", "GetScaledLevel", data(), Schema::SCALED_LEVEL.offset);
 
-                uint32_t scaledLevel = ReadMemberFast<uint32_t>(Offsets::SCALED_LEVEL, 0);
+                uint32_t scaledLevel = ReadFieldFast<Schema::SCALED_LEVEL>(0);
 
                 LOG_DEBUG("ChCliCoreStats::GetScaledLevel - Level: %u", scaledLevel);
                 return scaledLevel;
             }
 
             Game::Profession GetProfession() const { 
-                LOG_MEMORY("ChCliCoreStats", "GetProfession", data(), Offsets::PROFESSION);
+                LOG_MEMORY("ChCliCoreStats", "GetProfession", data(), Schema::PROFESSION.offset);
                 
-                uint32_t profValue = ReadMemberFast<uint32_t>(Offsets::PROFESSION, 0);
+                uint32_t profValue = ReadFieldFast<Schema::PROFESSION>(0);
                 Game::Profession profession = static_cast<Game::Profession>(profValue);
                 
                 LOG_DEBUG("ChCliCoreStats::GetProfession - Profession: %u", static_cast<uint32_t>(profession));
@@ -190,67 +258,134 @@ namespace kx {
          */
         class ChCliCharacter : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t AGENT = 0x98;            // AgChar* character's agent
-                static constexpr uintptr_t ATTITUDE = 0x00C0;       // uint32_t attitude flags
-                static constexpr uintptr_t BREAKBAR = 0x00C8;       // CmbtCliBreakBar* breakbar subsystem
-                static constexpr uintptr_t RANK_FLAGS = 0x0264;     // uint32_t rank flags (veteran, elite, etc.)
-                static constexpr uintptr_t CORE_STATS = 0x0388;     // ChCliCoreStats* stats subsystem
-                static constexpr uintptr_t ENDURANCE = 0x03D0;      // ChCliEndurance* dodge/endurance subsystem
-                static constexpr uintptr_t ENERGIES = 0x03D8;       // ChCliEnergies* mount/special energy subsystem
-                static constexpr uintptr_t FORCE = 0x03E0;          // ChCliForce* force subsystem
-                static constexpr uintptr_t HEALTH = 0x03E8;         // ChCliHealth* health subsystem
-                static constexpr uintptr_t INVENTORY = 0x3F0;       // ChCliInventory* inventory subsystem
-                static constexpr uintptr_t SKILLBAR = 0x0520;       // ChCliSkillbar* skillbar subsystem
+            struct Schema {
+                static constexpr FieldSchema::Field<void*> AGENT{ 0x98, "agent" };              // AgChar* character's agent
+                static constexpr FieldSchema::Field<uint32_t> ATTITUDE{ 0x00C0, "attitude" };   // uint32_t attitude flags
+                static constexpr FieldSchema::Field<void*> BREAKBAR{ 0x00C8, "breakbar" };      // CmbtCliBreakBar* breakbar subsystem
+                static constexpr FieldSchema::Field<uint32_t> RANK_FLAGS{ 0x0264, "rankFlags" }; // uint32_t rank flags (veteran, elite, etc.)
+                static constexpr FieldSchema::Field<void*> CORE_STATS{ 0x0388, "coreStats" };   // ChCliCoreStats* stats subsystem
+                static constexpr FieldSchema::Field<void*> ENDURANCE{ 0x03D0, "endurance" };    // ChCliEndurance* dodge/endurance subsystem
+                static constexpr FieldSchema::Field<void*> ENERGIES{ 0x03D8, "energies" };      // ChCliEnergies* mount/special energy subsystem
+                static constexpr FieldSchema::Field<void*> FORCE{ 0x03E0, "force" };            // ChCliForce* force subsystem
+                static constexpr FieldSchema::Field<void*> HEALTH{ 0x03E8, "health" };          // ChCliHealth* health subsystem
+                static constexpr FieldSchema::Field<void*> INVENTORY{ 0x3F0, "inventory" };     // ChCliInventory* inventory subsystem
+                static constexpr FieldSchema::Field<void*> SKILLBAR{ 0x0520, "skillbar" };      // ChCliSkillbar* skillbar subsystem
+
+                // What the per-frame extraction reads, as two small spans rather than one that
+                // would drag in the ~0x300 bytes in between (rank and core stats are stable-tier reads)
+                static constexpr FieldSchema::Span HEAD = FieldSchema::CoveringSpan(AGENT, ATTITUDE);
+                static constexpr FieldSchema::Span SUBSYSTEMS = FieldSchema::CoveringSpan(ENDURANCE, ENERGIES, HEALTH, INVENTORY);
             };
 
         public:
+            /**
+             * @brief The character's per-frame members, decoded from two bulk copies
+             * Subsystem pointers are raw: wrap them (which validates them) only when needed.
+             */
+            struct Fields {
+                bool loaded = false;
+                void* agent = nullptr;
+                Game::Attitude attitude = static_cast<Game::Attitude>(1);
+                void* endurance = nullptr;
+                void* energies = nullptr;
+                void* health = nullptr;
+                void* inventory = nullptr;
+            };
+
             ChCliCharacter(void* ptr) : ForeignClass(ptr) {}
 
+            Fields ReadFields() const {
+                const auto head = ReadBlock<Schema::HEAD>();
+                const auto subsystems = ReadBlock<Schema::SUBSYSTEMS>();
+                Fields fields;
+                fields.loaded = head.IsLoaded();
+                fields.agent = head.Get<Schema::AGENT>();
+                fields.attitude = static_cast<Game::Attitude>(head.Get<Schema::ATTITUDE>(1));
+                fields.endurance = subsystems.Get<Schema::ENDURANCE>();
+                fields.energies = subsystems.Get<Schema::ENERGIES>();
+                fields.health = subsystems.Get<Schema::HEALTH>();
+                fields.inventory = subsystems.Get<Schema::INVENTORY>();
+                return fields;
+            }
+
+            /**
+             * @brief Pipelined traversal (see PrefetchPipeline): request the lines ReadFields() copies
+             */
+            static void PrefetchHot(const void* character) {
+                FieldSchema::PrefetchSpan<Schema::HEAD>(character);
+                FieldSchema::PrefetchSpan<Schema::SUBSYSTEMS>(character);
+            }
+
+            /**
+             * @brief Pipelined traversal: guarded read of the agent pointer ahead of the decode
+             */
+            static const void* PeekAgent(const void* character) {
+                return FieldSchema::Peek<Schema::AGENT>(character);
+            }
+
+            /**
+             * @brief Highest rank set in the rank flags
+             */
+            static Game::CharacterRank DecodeRank(uint32_t flags) {
+                // Check from highest rank to lowest
+                if ((flags & static_cast<uint32_t>(Game::CharacterRankFlags::Legendary)) != 0)
+                    return Game::CharacterRank::Legendary;
+                if ((flags & static_cast<uint32_t>(Game::CharacterRankFlags::Champion)) != 0)
+                    return Game::CharacterRank::Champion;
+                if ((flags & static_cast<uint32_t>(Game::CharacterRankFlags::Elite)) != 0)
+                    return Game::CharacterRank::Elite;
+                if ((flags & static_cast<uint32_t>(Game::CharacterRankFlags::Veteran)) != 0)
+                    return Game::CharacterRank::Veteran;
+                if ((flags & static_cast<uint32_t>(Game::CharacterRankFlags::Ambient)) != 0)
+                    return Game::CharacterRank::Ambient;
+
+                return Game::CharacterRank::Normal;
+            }
+
             AgChar GetAgent() const {
-                return ReadPointerFast<AgChar>(Offsets::AGENT);
+                return ReadPointerFast<AgChar>(Schema::AGENT.offset);
             }
 
             ChCliHealth GetHealth() const { 
-                LOG_MEMORY("ChCliCharacter", "GetHealth", data(), Offsets::HEALTH);
+                LOG_MEMORY("ChCliCharacter", "GetHealth", data(), Schema::HEALTH.offset);
                 
-                ChCliHealth result = ReadPointerFast<ChCliHealth>(Offsets::HEALTH);
+                ChCliHealth result = ReadPointerFast<ChCliHealth>(Schema::HEALTH.offset);
                 
                 LOG_PTR("Health", result.data());
                 return result;
             }
 
             ChCliEndurance GetEndurance() const { 
-                LOG_MEMORY("ChCliCharacter", "GetEndurance", data(), Offsets::ENDURANCE);
+                LOG_MEMORY("ChCliCharacter", "GetEndurance", data(), Schema::ENDURANCE.offset);
                 
-                ChCliEndurance result = ReadPointerFast<ChCliEndurance>(Offsets::ENDURANCE);
+                ChCliEndurance result = ReadPointerFast<ChCliEndurance>(Schema::ENDURANCE.offset);
                 
                 LOG_PTR("Endurance", result.data());
                 return result;
             }
 
             ChCliEnergies GetEnergies() const { 
-                LOG_MEMORY("ChCliCharacter", "GetEnergies", data(), Offsets::ENERGIES);
+                LOG_MEMORY("ChCliCharacter", "GetEnergies", data(), Schema::ENERGIES.offset);
                 
-                ChCliEnergies result = ReadPointerFast<ChCliEnergies>(Offsets::ENERGIES);
+                ChCliEnergies result = ReadPointerFast<ChCliEnergies>(Schema::ENERGIES.offset);
                 
                 LOG_PTR("Energies", result.data());
                 return result;
             }
 
             ChCliCoreStats GetCoreStats() const { 
-                LOG_MEMORY("ChCliCharacter", "GetCoreStats", data(), Offsets::CORE_STATS);
+                LOG_MEMORY("ChCliCharacter", "GetCoreStats", data(), Schema::CORE_STATS.offset);
                 
-                ChCliCoreStats result = ReadPointerFast<ChCliCoreStats>(Offsets::CORE_STATS);
+                ChCliCoreStats result = ReadPointerFast<ChCliCoreStats>(Schema::CORE_STATS.offset);
                 
                 LOG_PTR("CoreStats", result.data());
                 return result;
             }
 
             Game::Attitude GetAttitude() const {
-                LOG_MEMORY("ChCliCharacter", "GetAttitude", data(), Offsets::ATTITUDE);
+                LOG_MEMORY("ChCliCharacter", "GetAttitude", data(), Schema::ATTITUDE.offset);
 
-                uint32_t attitudeValue = ReadMemberFast<uint32_t>(Offsets::ATTITUDE, 1);
+                uint32_t attitudeValue = ReadFieldFast<Schema::ATTITUDE>(1);
                 Game::Attitude attitude = static_cast<Game::Attitude>(attitudeValue);
                 
                 LOG_DEBUG("ChCliCharacter::GetAttitude - Attitude: %u", static_cast<uint32_t>(attitude));
@@ -258,27 +393,13 @@ namespace kx {
             }
 
             Game::CharacterRank GetRank() const {
-                LOG_MEMORY("ChCliCharacter", "GetRank", data(), Offsets::RANK_FLAGS);
+                LOG_MEMORY("ChCliCharacter", "GetRank", data(), Schema::RANK_FLAGS.offset);
 
-                uint32_t flags = ReadMemberFast<uint32_t>(Offsets::RANK_FLAGS, 0);
-
-                // Check from highest rank to lowest
-                if ((flags & static_cast<uint32_t>(Game::CharacterRankFlags::Legendary)) != 0)
-                    return Game::CharacterRank::Legendary;
-                if ((flags & static_cast<uint32_t>(Game::CharacterRankFlags::Champion)) != 0)
-                    return Game::CharacterRank::Champion;
-                if ((flags & static_cast<uint32_t>(Game::CharacterRankFlags::Elite)) != 0)
-                    return Game::CharacterRank::Elite;
-                if ((flags & static_cast<uint32_t>(Game::CharacterRankFlags::Veteran)) != 0)
-                    return Game::CharacterRank::Veteran;
-                if ((flags & static_cast<uint32_t>(Game::CharacterRankFlags::Ambient)) != 0)
-                    return Game::CharacterRank::Ambient;
-
-                return Game::CharacterRank::Normal;
+                return DecodeRank(ReadFieldFast<Schema::RANK_FLAGS>(0));
             }
 
             ChCliInventory GetInventory() const {
-                return ReadPointerFast<ChCliInventory>(Offsets::INVENTORY);
+                return ReadPointerFast<ChCliInventory>(Schema::INVENTORY.offset);
             }
         };
 
@@ -287,20 +408,36 @@ namespace kx {
          */
         class ChCliPlayer : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t CHARACTER_PTR = 0x18;  // ChCliCharacter* player's character
-                static constexpr uintptr_t NAME_PTR = 0x68;       // wchar_t* player name string
+            struct Schema {
+                static constexpr FieldSchema::Field<void*> CHARACTER_PTR{ 0x18, "character" };   // ChCliCharacter* player's character
+                static constexpr FieldSchema::Field<const wchar_t*> NAME_PTR{ 0x68, "name" };    // wchar_t* player name string
+
+                static constexpr FieldSchema::Span ENTRY = FieldSchema::CoveringSpan(CHARACTER_PTR, NAME_PTR);
             };
 
         public:
+            struct Fields {
+                void* character = nullptr;
+                const wchar_t* name = nullptr;
+            };
+
             ChCliPlayer(void* ptr) : ForeignClass(ptr) {}
+
+            /**
+             * @brief Character pointer and name from one bulk copy
+             * @note The character pointer is raw: it is only a key into the validated character list.
+             */
+            Fields ReadFields() const {
+                const auto block = ReadBlock<Schema::ENTRY>();
+                return { block.Get<Schema::CHARACTER_PTR>(), block.Get<Schema::NAME_PTR>() };
+            }
             
             ChCliCharacter GetCharacter() const { 
-                return ReadPointerFast<ChCliCharacter>(Offsets::CHARACTER_PTR);
+                return ReadPointerFast<ChCliCharacter>(Schema::CHARACTER_PTR.offset);
             }
             
             const wchar_t* GetName() const { 
-                return ReadMemberFast<const wchar_t*>(Offsets::NAME_PTR, nullptr);
+                return ReadFieldFast<Schema::NAME_PTR>(nullptr);
             }
         };
 
@@ -96,14 +96,16 @@ namespace kx {
             SafeAccess::SafeGameArray<ChCliCharacter> GetCharacters() const {
                 return SafeAccess::SafeGameArray<ChCliCharacter>(
                     ReadMemberFast<void*>(Offsets::CHARACTER_LIST, nullptr),
-                    ReadMemberFast<uint32_t>(Offsets::CHARACTER_LIST_CAPACITY, 0)
+                    ReadMemberFast<uint32_t>(Offsets::CHARACTER_LIST_CAPACITY, 0),
+                    ReadMemberFast<uint32_t>(Offsets::CHARACTER_LIST_COUNT, 0)
                 );
             }
 
             SafeAccess::SafeGameArray<ChCliPlayer> GetPlayers() const {
                 return SafeAccess::SafeGameArray<ChCliPlayer>(
                     ReadMemberFast<void*>(Offsets::PLAYER_LIST, nullptr),
-                    ReadMemberFast<uint32_t>(Offsets::PLAYER_LIST_CAPACITY, 0)
+                    ReadMemberFast<uint32_t>(Offsets::PLAYER_LIST_CAPACITY, 0),
+                    ReadMemberFast<uint32_t>(Offsets::PLAYER_LIST_COUNT, 0)
                 );
             }
         };
@@ -190,14 +192,16 @@ namespace kx {
             SafeAccess::SafeGameArray<GdCliGadget> GetGadgets() const {
                 return SafeAccess::SafeGameArray<GdCliGadget>(
                     ReadMemberFast<void*>(Offsets::GADGET_LIST, nullptr),
-                    ReadMemberFast<uint32_t>(Offsets::GADGET_LIST_CAPACITY, 0)
+                    ReadMemberFast<uint32_t>(Offsets::GADGET_LIST_CAPACITY, 0),
+                    ReadMemberFast<uint32_t>(Offsets::GADGET_LIST_COUNT, 0)
                 );
             }
 
             SafeAccess::SafeGameArray<AgentInl> GetAttackTargets() const {
                 return SafeAccess::SafeGameArray<AgentInl>(
                     ReadMemberFast<void*>(Offsets::ATTACK_TARGET_LIST, nullptr),
-                    ReadMemberFast<uint32_t>(Offsets::ATTACK_TARGET_LIST_CAPACITY, 0)
+                    ReadMemberFast<uint32_t>(Offsets::ATTACK_TARGET_LIST_CAPACITY, 0),
+                    ReadMemberFast<uint32_t>(Offsets::ATTACK_TARGET_LIST_COUNT, 0)
                 );
             }
         };
@@ -249,7 +253,8 @@ namespace kx {
             SafeAccess::SafeGameArray<ItCliItem> GetItems() const {
                 return SafeAccess::SafeGameArray<ItCliItem>(
                     ReadMemberFast<void*>(Offsets::ITEM_LIST, nullptr),
-                    ReadMemberFast<uint32_t>(Offsets::ITEM_LIST_CAPACITY, 0)
+                    ReadMemberFast<uint32_t>(Offsets::ITEM_LIST_CAPACITY, 0),
+                    ReadMemberFast<uint32_t>(Offsets::ITEM_LIST_COUNT, 0)
                 );
             }
         };
@@ -259,13 +264,24 @@ namespace kx {
          */
         class ContextCollection : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t CH_CLI_CONTEXT = 0x98;   // ChCliContext* character context
-                static constexpr uintptr_t GD_CLI_CONTEXT = 0x0138; // GdCliContext* gadget context
-                static constexpr uintptr_t IT_CLI_CONTEXT = 0x0178; // ItCliContext* item context
+            struct Schema {
+                static constexpr FieldSchema::Field<void*> CH_CLI_CONTEXT{ 0x98, "chCliContext" };   // ChCliContext* character context
+                static constexpr FieldSchema::Field<void*> GD_CLI_CONTEXT{ 0x0138, "gdCliContext" }; // GdCliContext* gadget context
+                static constexpr FieldSchema::Field<void*> IT_CLI_CONTEXT{ 0x0178, "itCliContext" }; // ItCliContext* item context
+
+                static constexpr FieldSchema::Span CONTEXTS = FieldSchema::CoveringSpan(CH_CLI_CONTEXT, GD_CLI_CONTEXT, IT_CLI_CONTEXT);
             };
 
         public:
+            /**
+             * @brief Raw context pointers, not validated yet
+             */
+            struct Contexts {
+                void* character = nullptr;
+                void* gadget = nullptr;
+                void* item = nullptr;
+            };
+
             ContextCollection(void* ptr) : ForeignClass(ptr) {
                 // Debug: Log the ContextCollection base address using proper logging system
                 if (ptr) {
@@ -273,28 +289,36 @@ namespace kx {
                 }
             }
 
+            /**
+             * @brief All three context pointers from one bulk copy
+             */
+            Contexts ReadContexts() const {
+                const auto block = ReadBlock<Schema::CONTEXTS>();
+                return { block.Get<Schema::CH_CLI_CONTEXT>(), block.Get<Schema::GD_CLI_CONTEXT>(), block.Get<Schema::IT_CLI_CONTEXT>() };
+            }
+
             ChCliContext GetChCliContext() const {
-                LOG_MEMORY("ContextCollection", "GetChCliContext", data(), Offsets::CH_CLI_CONTEXT);
+                LOG_MEMORY("ContextCollection", "GetChCliContext", data(), Schema::CH_CLI_CONTEXT.offset);
                 
-                ChCliContext result = ReadPointerFast<ChCliContext>(Offsets::CH_CLI_CONTEXT);
+                ChCliContext result = ReadPointerFast<ChCliContext>(Schema::CH_CLI_CONTEXT.offset);
                 
                 LOG_PTR("ChCliContext", result.data());
                 return result;
             }
 
             GdCliContext GetGdCliContext() const {
-                LOG_MEMORY("ContextCollection", "GetGdCliContext", data(), Offsets::GD_CLI_CONTEXT);
+                LOG_MEMORY("ContextCollection", "GetGdCliContext", data(), Schema::GD_CLI_CONTEXT.offset);
                 
-                GdCliContext result = ReadPointerFast<GdCliContext>(Offsets::GD_CLI_CONTEXT);
+                GdCliContext result = ReadPointerFast<GdCliContext>(Schema::GD_CLI_CONTEXT.offset);
                 
                 LOG_PTR("GdCliContext", result.data());
                 return result;
             }
 
             ItCliContext GetItCliContext() const {
-                LOG_MEMORY("ContextCollection", "GetItCliContext", data(), Offsets::IT_CLI_CONTEXT);
+                LOG_MEMORY("ContextCollection", "GetItCliContext", data(), Schema::IT_CLI_CONTEXT.offset);
                 
-                ItCliContext result = ReadPointerFast<ItCliContext>(Offsets::IT_CLI_CONTEXT);
+                ItCliContext result = ReadPointerFast<ItCliContext>(Schema::IT_CLI_CONTEXT.offset);
                 
                 LOG_PTR("ItCliContext", result.data());
                 return result;
@@ -86,9 +86,16 @@ namespace kx {
          * Contains the array of equipped items.
          */
         class ChCliInventory : public ForeignClass {
+        public:
+            // Slots [0, GEAR_SLOT_RANGE) cover every armor, trinket and weapon slot shown as gear
+            static constexpr int GEAR_SLOT_RANGE = static_cast<int>(Game::EquipmentSlot::OffhandWeapon2) + 1;
+            using GearSlots = std::array<void*, GEAR_SLOT_RANGE>;
+
         private:
-            struct Offsets {
-                static constexpr uintptr_t EQUIPMENT_ARRAY = 0x160;  // ItCliItem** array of equipment slots
+            struct Schema {
+                static constexpr FieldSchema::Field<GearSlots> GEAR_SLOTS{ 0x160, "gearSlots" }; // ItCliItem* array of equipment slots, head
+
+                static constexpr FieldSchema::Span GEAR = FieldSchema::CoveringSpan(GEAR_SLOTS);
             };
 
         public:
@@ -99,9 +106,15 @@ namespace kx {
                     return ItCliItem(nullptr);
                 }
 
-                uintptr_t arrayBaseAddress = reinterpret_cast<uintptr_t>(data()) + Offsets::EQUIPMENT_ARRAY;
-                auto slotArray = reinterpret_cast<void**>(arrayBaseAddress);
-                return ItCliItem(slotArray[slotIndex]);
+                uintptr_t arrayBaseAddress = reinterpret_cast<uintptr_t>(data()) + Schema::GEAR_SLOTS.offset;
+                return ItCliItem(MemorySource::Read<void*>(arrayBaseAddress + slotIndex * sizeof(void*), nullptr));
+            }
+
+            /**
+             * @brief Item pointers of the gear slots from one bulk copy; all null if unreadable
+             */
+            GearSlots ReadGearSlots() const {
+                return ReadBlock<Schema::GEAR>().Get<Schema::GEAR_SLOTS>(GearSlots{});
             }
         };
 
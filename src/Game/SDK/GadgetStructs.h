@@ -20,26 +20,26 @@ namespace kx {
          */
         class CoKeyFramed : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t POSITION = 0x0030;  // glm::vec3 position
-                static constexpr uintptr_t RIGID_BODY = 0x0060; // hkpRigidBody* physics rigid body (gadgets only) - see HavokOffsets.h
-                static constexpr uintptr_t ROTATION = 0x00F8; // glm::vec2 rotation (gadget rotation)
+            struct Schema {
+                static constexpr FieldSchema::Field<glm::vec3> POSITION{ 0x0030, "position" };  // glm::vec3 position
+                static constexpr FieldSchema::Field<void*> RIGID_BODY{ 0x0060, "rigidBody" };  // hkpRigidBody* physics rigid body (gadgets only) - see HavokOffsets.h
+                static constexpr FieldSchema::Field<glm::vec2> ROTATION{ 0x00F8, "rotation" };  // glm::vec2 rotation (gadget rotation)
             };
 
         public:
             CoKeyFramed(void* ptr) : ForeignClass(ptr) {}
 
             glm::vec3 GetPosition() const {
-                LOG_MEMORY("CoKeyFramed", "GetPosition", data(), Offsets::POSITION);
+                LOG_MEMORY("CoKeyFramed", "GetPosition", data(), Schema::POSITION.offset);
                 
-                glm::vec3 position = ReadMemberFast<glm::vec3>(Offsets::POSITION, glm::vec3{0.0f, 0.0f, 0.0f});
+                glm::vec3 position = ReadFieldFast<Schema::POSITION>(glm::vec3{0.0f, 0.0f, 0.0f});
                 
                 LOG_DEBUG("CoKeyFramed::GetPosition - Position: (%.2f, %.2f, %.2f)", position.x, position.y, position.z);
                 return position;
             }
 
             HkpRigidBody GetRigidBody() const {
-                return ReadPointerFast<HkpRigidBody>(Offsets::RIGID_BODY);
+                return ReadPointerFast<HkpRigidBody>(Schema::RIGID_BODY.offset);
             }
         };
 
@@ -52,38 +52,62 @@ namespace kx {
          */
         class AgKeyFramed : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t TYPE = 0x08;            // int32_t agent type identifier
-                static constexpr uintptr_t ID = 0x0C;              // int32_t agent ID
-                static constexpr uintptr_t GADGET_TYPE = 0x40;     // uint32_t gadget type
-                static constexpr uintptr_t CO_KEYFRAMED = 0x0050;  // CoKeyframed* coordinate system
+            struct Schema {
+                static constexpr FieldSchema::Field<uint32_t> TYPE{ 0x08, "type" };  // uint32_t agent type identifier
+                static constexpr FieldSchema::Field<int32_t> ID{ 0x0C, "id" };  // int32_t agent ID
+                static constexpr FieldSchema::Field<uint32_t> GADGET_TYPE{ 0x40, "gadgetType" };  // uint32_t gadget type
+                static constexpr FieldSchema::Field<void*> CO_KEYFRAMED{ 0x0050, "coKeyframed" };  // CoKeyframed* coordinate system
+
+                static constexpr FieldSchema::Span HEADER = FieldSchema::CoveringSpan(TYPE, ID, CO_KEYFRAMED);
             };
 
         public:
+            struct Header {
+                bool loaded = false;
+                Game::AgentType type = static_cast<Game::AgentType>(0);
+                int32_t id = 0;
+                void* coKeyframed = nullptr; // Raw CoKeyFramed*, not yet validated
+            };
+
             AgKeyFramed(void* ptr) : ForeignClass(ptr) {}
 
+            /**
+             * @brief Type, ID and coordinate system pointer from one bulk copy
+             */
+            Header ReadHeader() const {
+                const auto block = ReadBlock<Schema::HEADER>();
+                return { block.IsLoaded(), static_cast<Game::AgentType>(block.Get<Schema::TYPE>()), block.Get<Schema::ID>(), block.Get<Schema::CO_KEYFRAMED>() };
+            }
+
+            /**
+             * @brief Pipelined traversal: request the lines ReadHeader() copies
+             */
+            static void PrefetchHeader(const void* agent) {
+                FieldSchema::PrefetchSpan<Schema::HEADER>(agent);
+            }
+
             CoKeyFramed GetCoKeyFramed() const {
-                LOG_MEMORY("AgKeyFramed", "GetCoKeyFramed", data(), Offsets::CO_KEYFRAMED);
+                LOG_MEMORY("AgKeyFramed", "GetCoKeyFramed", data(), Schema::CO_KEYFRAMED.offset);
                 
-                CoKeyFramed result = ReadPointerFast<CoKeyFramed>(Offsets::CO_KEYFRAMED);
+                CoKeyFramed result = ReadPointerFast<CoKeyFramed>(Schema::CO_KEYFRAMED.offset);
                 
                 LOG_PTR("CoKeyFramed", result.data());
                 return result;
             }
 
             Game::AgentType GetType() const {
-                LOG_MEMORY("AgKeyFramed", "GetType", data(), Offsets::TYPE);
+                LOG_MEMORY("AgKeyFramed", "GetType", data(), Schema::TYPE.offset);
                 
-                uint32_t type = ReadMemberFast<uint32_t>(Offsets::TYPE, 0);
+                uint32_t type = ReadFieldFast<Schema::TYPE>(0);
                 
                 LOG_DEBUG("AgKeyFramed::GetType - Type: %u", type);
                 return static_cast<Game::AgentType>(type);
             }
 
             int32_t GetId() const {
-                LOG_MEMORY("AgKeyFramed", "GetId", data(), Offsets::ID);
+                LOG_MEMORY("AgKeyFramed", "GetId", data(), Schema::ID.offset);
                 
-                int32_t id = ReadMemberFast<int32_t>(Offsets::ID, 0);
+                int32_t id = ReadFieldFast<Schema::ID>(0);
                 
                 LOG_DEBUG("AgKeyFramed::GetId - ID: %d", id);
                 return id;
@@ -95,27 +119,42 @@ namespace kx {
          */
         class GdCliHealth : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t CURRENT = 0x0C;  // float current health
-                static constexpr uintptr_t MAX = 0x10;      // float maximum health
+            struct Schema {
+                static constexpr FieldSchema::Field<float> CURRENT{ 0x0C, "current" };  // float current health
+                static constexpr FieldSchema::Field<float> MAX{ 0x10, "max" };  // float maximum health
+
+                static constexpr FieldSchema::Span VALUES = FieldSchema::CoveringSpan(CURRENT, MAX);
             };
 
         public:
+            struct Values {
+                float current = 0.0f;
+                float max = 0.0f;
+            };
+
             GdCliHealth(void* ptr) : ForeignClass(ptr) {}
+
+            /**
+             * @brief Current and max from one bulk copy
+             */
+            Values ReadValues() const {
+                const auto block = ReadBlock<Schema::VALUES>();
+                return { block.Get<Schema::CURRENT>(), block.Get<Schema::MAX>() };
+            }
             
             float GetCurrent() const { 
-                LOG_MEMORY("GdCliHealth", "GetCurrent", data(), Offsets::CURRENT);
+                LOG_MEMORY("GdCliHealth", "GetCurrent", data(), Schema::CURRENT.offset);
                 
-                float current = ReadMemberFast<float>(Offsets::CURRENT, 0.0f);
+                float current = ReadFieldFast<Schema::CURRENT>(0.0f);
                 
                 LOG_DEBUG("GdCliHealth::GetCurrent - Current: %.2f", current);
                 return current;
             }
             
             float GetMax() const { 
-                LOG_MEMORY("GdCliHealth", "GetMax", data(), Offsets::MAX);
+                LOG_MEMORY("GdCliHealth", "GetMax", data(), Schema::MAX.offset);
                 
-                float max = ReadMemberFast<float>(Offsets::MAX, 0.0f);
+                float max = ReadFieldFast<Schema::MAX>(0.0f);
                 
                 LOG_DEBUG("GdCliHealth::GetMax - Max: %.2f", max);
                 return max;
@@ -127,22 +166,69 @@ namespace kx {
          */
         class GdCliGadget : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t AG_KEYFRAMED = 0x0038;         // AgKeyframed* agent wrapper
-                static constexpr uintptr_t TYPE = 0x0208;                 // uint32_t gadget type
-                static constexpr uintptr_t HEALTH = 0x0220;               // GdCliHealth* health subsystem
-                static constexpr uintptr_t RESOURCE_NODE_TYPE = 0x04EC;   // uint32_t resource node type
-                static constexpr uintptr_t FLAGS = 0x04F0;                // uint32_t gadget flags
+            struct Schema {
+                static constexpr FieldSchema::Field<void*> AG_KEYFRAMED{ 0x0038, "agKeyframed" };  // AgKeyframed* agent wrapper
+                static constexpr FieldSchema::Field<uint32_t> TYPE{ 0x0208, "type" };  // uint32_t gadget type
+                static constexpr FieldSchema::Field<void*> HEALTH{ 0x0220, "health" };  // GdCliHealth* health subsystem
+                static constexpr FieldSchema::Field<Game::ResourceNodeType> RESOURCE_NODE_TYPE{ 0x04EC, "resourceNodeType" };  // uint32_t resource node type
+                static constexpr FieldSchema::Field<uint32_t> FLAGS{ 0x04F0, "flags" };  // uint32_t gadget flags
+
+                // One small span per cluster; a single covering span would copy ~0x4C0 bytes
+                static constexpr FieldSchema::Span AGENT = FieldSchema::CoveringSpan(AG_KEYFRAMED);
+                static constexpr FieldSchema::Span STATE = FieldSchema::CoveringSpan(TYPE, HEALTH);
+                static constexpr FieldSchema::Span NODE = FieldSchema::CoveringSpan(RESOURCE_NODE_TYPE, FLAGS);
             };
             static constexpr uint32_t FlagGatherable = 0x2;  // Indicates gatherable resource
 
         public:
+            /**
+             * @brief Every gadget member the extraction reads, decoded from three bulk copies
+             */
+            struct Fields {
+                bool loaded = false;
+                void* agKeyframed = nullptr; // Raw AgKeyFramed*, not yet validated
+                Game::GadgetType type = static_cast<Game::GadgetType>(0);
+                void* health = nullptr;      // Raw GdCliHealth*, not yet validated
+                Game::ResourceNodeType resourceType = Game::ResourceNodeType::None;
+                bool isGatherable = false;
+            };
+
             GdCliGadget(void* ptr) : ForeignClass(ptr) {}
 
+            Fields ReadFields() const {
+                const auto agent = ReadBlock<Schema::AGENT>();
+                const auto state = ReadBlock<Schema::STATE>();
+                const auto node = ReadBlock<Schema::NODE>();
+                Fields fields;
+                fields.loaded = agent.IsLoaded();
+                fields.agKeyframed = agent.Get<Schema::AG_KEYFRAMED>();
+                fields.type = static_cast<Game::GadgetType>(state.Get<Schema::TYPE>());
+                fields.health = state.Get<Schema::HEALTH>();
+                fields.resourceType = node.Get<Schema::RESOURCE_NODE_TYPE>(Game::ResourceNodeType::None);
+                fields.isGatherable = (node.Get<Schema::FLAGS>() & FlagGatherable) != 0;
+                return fields;
+            }
+
+            /**
+             * @brief Pipelined traversal (see PrefetchPipeline): request the lines ReadFields() copies
+             */
+            static void PrefetchHot(const void* gadget) {
+                FieldSchema::PrefetchSpan<Schema::AGENT>(gadget);
+                FieldSchema::PrefetchSpan<Schema::STATE>(gadget);
+                FieldSchema::PrefetchSpan<Schema::NODE>(gadget);
+            }
+
+            /**
+             * @brief Pipelined traversal: guarded read of the agent pointer ahead of the decode
+             */
+            static const void* PeekAgent(const void* gadget) {
+                return FieldSchema::Peek<Schema::AG_KEYFRAMED>(gadget);
+            }
+
             Game::GadgetType GetGadgetType() const {
-                LOG_MEMORY("GdCliGadget", "GetGadgetType", data(), Offsets::TYPE);
+                LOG_MEMORY("GdCliGadget", "GetGadgetType", data(), Schema::TYPE.offset);
                 
-                uint32_t typeValue = ReadMemberFast<uint32_t>(Offsets::TYPE, 0);
+                uint32_t typeValue = ReadFieldFast<Schema::TYPE>(0);
                 Game::GadgetType gadgetType = static_cast<Game::GadgetType>(typeValue);
                 
                 LOG_DEBUG("GdCliGadget::GetGadgetType - Type: %u", static_cast<uint32_t>(gadgetType));
@@ -150,24 +236,24 @@ namespace kx {
             }
 
             GdCliHealth GetHealth() const {
-                LOG_MEMORY("GdCliGadget", "GetHealth", data(), Offsets::HEALTH);
+                LOG_MEMORY("GdCliGadget", "GetHealth", data(), Schema::HEALTH.offset);
 
-                GdCliHealth result = ReadPointerFast<GdCliHealth>(Offsets::HEALTH);
+                GdCliHealth result = ReadPointerFast<GdCliHealth>(Schema::HEALTH.offset);
 
                 LOG_PTR("Health", result.data());
                 return result;
             }
 
             Game::ResourceNodeType GetResourceNodeType() const {
-                LOG_MEMORY("GdCliGadget", "GetResourceNodeType", data(), Offsets::RESOURCE_NODE_TYPE);
+                LOG_MEMORY("GdCliGadget", "GetResourceNodeType", data(), Schema::RESOURCE_NODE_TYPE.offset);
 
-                return ReadMemberFast<Game::ResourceNodeType>(Offsets::RESOURCE_NODE_TYPE, Game::ResourceNodeType::None);
+                return ReadFieldFast<Schema::RESOURCE_NODE_TYPE>(Game::ResourceNodeType::None);
             }
 
             bool IsGatherable() const {
-                LOG_MEMORY("GdCliGadget", "IsGatherable", data(), Offsets::FLAGS);
+                LOG_MEMORY("GdCliGadget", "IsGatherable", data(), Schema::FLAGS.offset);
                 
-                uint32_t flags = ReadMemberFast<uint32_t>(Offsets::FLAGS, 0);
+                uint32_t flags = ReadFieldFast<Schema::FLAGS>(0);
                 bool gatherable = (flags & FlagGatherable) != 0;
                 
                 LOG_DEBUG("GdCliGadget::IsGatherable - Flags: 0x%X, Gatherable: %s", flags, gatherable ? "true" : "false");
@@ -175,9 +261,9 @@ namespace kx {
             }
 
             AgKeyFramed GetAgKeyFramed() const {
-                LOG_MEMORY("GdCliGadget", "GetAgKeyFramed", data(), Offsets::AG_KEYFRAMED);
+                LOG_MEMORY("GdCliGadget", "GetAgKeyFramed", data(), Schema::AG_KEYFRAMED.offset);
                 
-                AgKeyFramed result = ReadPointerFast<AgKeyFramed>(Offsets::AG_KEYFRAMED);
+                AgKeyFramed result = ReadPointerFast<AgKeyFramed>(Schema::AG_KEYFRAMED.offset);
                 
                 LOG_PTR("AgKeyFramed", result.data());
                 return result;
@@ -194,27 +280,42 @@ namespace kx {
          */
         class AgentInl : public ForeignClass {
         private:
-            struct Offsets {
-                static constexpr uintptr_t AG_KEYFRAMED = 0x18;    // AgKeyframed* agent wrapper
-                static constexpr uintptr_t COMBAT_STATE = 0x0034;  // int32_t combat state flag (2=Idle, 3=In Combat) [CONFIRMED]
+            struct Schema {
+                static constexpr FieldSchema::Field<void*> AG_KEYFRAMED{ 0x18, "agKeyframed" };  // AgKeyframed* agent wrapper
+                static constexpr FieldSchema::Field<int32_t> COMBAT_STATE{ 0x0034, "combatState" };  // int32_t combat state flag (2=Idle, 3=In Combat) [CONFIRMED]
+
+                static constexpr FieldSchema::Span ALL = FieldSchema::CoveringSpan(AG_KEYFRAMED, COMBAT_STATE);
             };
 
         public:
+            struct Fields {
+                void* agKeyframed = nullptr; // Raw AgKeyFramed*, not yet validated
+                Game::AttackTargetCombatState combatState = static_cast<Game::AttackTargetCombatState>(0);
+            };
+
             AgentInl(void* ptr) : ForeignClass(ptr) {}
 
+            /**
+             * @brief Agent pointer and combat state from one bulk copy
+             */
+            Fields ReadFields() const {
+                const auto block = ReadBlock<Schema::ALL>();
+                return { block.Get<Schema::AG_KEYFRAMED>(), static_cast<Game::AttackTargetCombatState>(block.Get<Schema::COMBAT_STATE>()) };
+            }
+
             AgKeyFramed GetAgKeyFramed() const {
-                LOG_MEMORY("AgentInl", "GetAgKeyFramed", data(), Offsets::AG_KEYFRAMED);
+                LOG_MEMORY("AgentInl", "GetAgKeyFramed", data(), Schema::AG_KEYFRAMED.offset);
                 
-                AgKeyFramed result = ReadPointerFast<AgKeyFramed>(Offsets::AG_KEYFRAMED);
+                AgKeyFramed result = ReadPointerFast<AgKeyFramed>(Schema::AG_KEYFRAMED.offset);
                 
                 LOG_PTR("AgKeyFramed", result.data());
                 return result;
             }
 
             Game::AttackTargetCombatState GetCombatState() const {
-                LOG_MEMORY("AgentInl", "GetCombatState", data(), Offsets::COMBAT_STATE);
+                LOG_MEMORY("AgentInl", "GetCombatState", data(), Schema::COMBAT_STATE.offset);
                 
-                int32_t state = ReadMemberFast<int32_t>(Offsets::COMBAT_STATE, 0);
+                int32_t state = ReadFieldFast<Schema::COMBAT_STATE>(0);
                 
                 LOG_DEBUG("AgentInl::GetCombatState - State: %d", state);
                 return static_cast<Game::AttackTargetCombatState>(state);
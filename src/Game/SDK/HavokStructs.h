@@ -177,6 +177,16 @@ namespace kx {
         public:
             HkpRigidBody(void* ptr) : ForeignClass(ptr) {}
 
+            /**
+             * @brief Get the collision shape pointer at +0x20 (unvalidated; read through MemorySource)
+             */
+            void* GetShapePtr() const {
+                if (!data()) {
+                    return nullptr;
+                }
+                return ReadMemberFast<void*>(HavokOffsets::HkpRigidBody::SHAPE, nullptr);
+            }
+
             /**
              * @brief Get the wrapper shape type from the rigid body (for future filtering/early-out)
              * @return Wrapper type enum value, or INVALID if read fails
@@ -207,7 +217,7 @@ namespace kx {
                 }
 
                 // Read primitive shape type from shape + 0x10 (single byte) - direct pointer arithmetic
-                uint8_t typeValue = *reinterpret_cast<uint8_t*>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpShapeBase::SHAPE_TYPE_PRIMITIVE);
+                uint8_t typeValue = MemorySource::Read<uint8_t>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpShapeBase::SHAPE_TYPE_PRIMITIVE, static_cast<uint8_t>(Havok::HkcdShapeType::INVALID));
                 return static_cast<Havok::HkcdShapeType>(typeValue);
             }
 
@@ -218,7 +228,7 @@ namespace kx {
                     return -1.0f;
                 }
                 
-                int32_t heightCm = *reinterpret_cast<int32_t*>(reinterpret_cast<uintptr_t>(shapePtr) + offset);
+                int32_t heightCm = MemorySource::Read<int32_t>(reinterpret_cast<uintptr_t>(shapePtr) + offset, 0);
                 
                 if (heightCm < minCm || heightCm > maxCm) {
                     return -1.0f;
@@ -233,7 +243,7 @@ namespace kx {
                     return -1.0f;
                 }
                 
-                float heightHalf = *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(shapePtr) + offset);
+                float heightHalf = MemorySource::Read<float>(reinterpret_cast<uintptr_t>(shapePtr) + offset, 0.0f);
                 
                 if (!std::isfinite(heightHalf) || heightHalf <= 0.0f || heightHalf > HavokValidation::MAX_HALF_EXTENT_GAME_UNITS) {
                     return -1.0f;
@@ -254,7 +264,7 @@ namespace kx {
                     return -1.0f;
                 }
                 
-                float heightHalf = *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(shapePtr) + offset);
+                float heightHalf = MemorySource::Read<float>(reinterpret_cast<uintptr_t>(shapePtr) + offset, 0.0f);
                 
                 if (!std::isfinite(heightHalf) || heightHalf <= 0.0f || heightHalf > HavokValidation::MAX_DIMENSION_METERS / 2.0f) {
                     return -1.0f;
@@ -275,7 +285,7 @@ namespace kx {
                     return -1.0f;
                 }
                 
-                int32_t height = *reinterpret_cast<int32_t*>(reinterpret_cast<uintptr_t>(shapePtr) + offset);
+                int32_t height = MemorySource::Read<int32_t>(reinterpret_cast<uintptr_t>(shapePtr) + offset, 0);
                 
                 if (height < min || height > max) {
                     return -1.0f;
@@ -290,7 +300,7 @@ namespace kx {
                     return glm::vec3(0.0f);
                 }
                 
-                glm::vec3 halfExtents = *reinterpret_cast<glm::vec3*>(reinterpret_cast<uintptr_t>(shapePtr) + offset);
+                glm::vec3 halfExtents = MemorySource::Read<glm::vec3>(reinterpret_cast<uintptr_t>(shapePtr) + offset, glm::vec3(0.0f));
                 
                 if (!std::isfinite(halfExtents.x) || !std::isfinite(halfExtents.y) || !std::isfinite(halfExtents.z)) {
                     return glm::vec3(0.0f);
@@ -326,7 +336,7 @@ namespace kx {
                     return glm::vec3(0.0f);
                 }
                 
-                float halfHeight = *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(shapePtr) + heightOffset);
+                float halfHeight = MemorySource::Read<float>(reinterpret_cast<uintptr_t>(shapePtr) + heightOffset, 0.0f);
                 
                 if (!std::isfinite(halfHeight) || halfHeight <= 0.0f || halfHeight > HavokValidation::MAX_DIMENSION_METERS / 2.0f) {
                     return glm::vec3(0.0f);
@@ -400,15 +410,15 @@ namespace kx {
                 }
                 
                 // Read width and depth from vec3 at 0x50 - direct pointer arithmetic
-                float widthHalf = *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpListShape::WIDTH_HALF);
-                float depthHalf = *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpListShape::DEPTH_HALF);
+                float widthHalf = MemorySource::Read<float>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpListShape::WIDTH_HALF, 0.0f);
+                float depthHalf = MemorySource::Read<float>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpListShape::DEPTH_HALF, 0.0f);
                 
                 // Read primary height from 0x58
-                float heightHalf = *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpListShape::HEIGHT_HALF);
+                float heightHalf = MemorySource::Read<float>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpListShape::HEIGHT_HALF, 0.0f);
                 
                 // If primary height is invalid, try backup height from 0x68
                 if (!std::isfinite(heightHalf) || heightHalf <= 0.0f || heightHalf > 10000.0f) {
-                    heightHalf = *reinterpret_cast<float*>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpListShape::HEIGHT_HALF_BACKUP);
+                    heightHalf = MemorySource::Read<float>(reinterpret_cast<uintptr_t>(shapePtr) + HavokOffsets::HkpListShape::HEIGHT_HALF_BACKUP, 0.0f);
                 }
                 
                 // Validate all components
@@ -47,11 +47,26 @@ namespace kx {
         // Rationale: Players and NPCs are limited to ~200m by game mechanics,
         // but objects (waypoints, vistas, resource nodes) can be 1000m+ away.
         // Using only object distances gives us the true scene depth for intelligent scaling.
+        // Distances are measured here from the local player: the render-side filter only
+        // keeps them in its own columns, and runs on a different frame.
+        const PlayerEntity* localPlayer = nullptr;
+        for (const auto* p : frameData.players) {
+            if (p && p->isLocalPlayer) {
+                localPlayer = p;
+                break;
+            }
+        }
+        if (!localPlayer) {
+            return {};
+        }
+
+        const EntityColumns& columns = frameData.columns;
+        const EntityColumns::SlotRange range = columns.GetRange(EntityTypes::Gadget);
         std::vector<float> distances;
-        distances.reserve(frameData.gadgets.size());
+        distances.reserve(range.end - range.begin);
         
-        for (const auto* g : frameData.gadgets) {
-            if (g) distances.push_back(g->gameplayDistance);
+        for (uint32_t slot = range.begin; slot < range.end; ++slot) {
+            distances.push_back(glm::length(columns.position[slot] - localPlayer->position));
         }
         
         return distances;
@@ -36,14 +36,12 @@ namespace kx
 		return (it != m_entityStates.end()) ? &it->second : nullptr;
 	}
 
-	void CombatStateManager::Prune(const ankerl::unordered_dense::set<CombatStateKey, CombatStateKeyHash>& activeKeys)
+	void CombatStateManager::Prune(std::span<const EntityEvent> events)
 	{
-		for (auto it = m_entityStates.begin(); it != m_entityStates.end();)
+		for (const EntityEvent& event : events)
 		{
-			if (activeKeys.find(it->first) == activeKeys.end()) {
-				it = m_entityStates.erase(it);
-			} else {
-				++it;
+			if (event.kind == EntityEventKind::Despawned) {
+				m_entityStates.erase(CombatStateKey(event.agentId, event.address));
 			}
 		}
 	}
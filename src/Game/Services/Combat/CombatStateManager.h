@@ -1,10 +1,12 @@
 #pragma once
 
 #include <ankerl/unordered_dense.h>
+#include <span>
 #include <vector>
 #include "CombatState.h"
 #include "CombatStateKey.h"
 #include "../../../Game/Data/EntityData.h"
+#include "../../../Game/Data/EntityEvent.h"
 
 namespace kx
 {
@@ -31,9 +33,9 @@ namespace kx
 
 		/**
 		 * @brief Remove combat state for entities that are no longer present in the game.
-		 * @param activeKeys Set of entity keys that are currently active in the game.
+		 * @param events Entity events of the new frame; only despawns are acted on.
 		 */
-		void Prune(const ankerl::unordered_dense::set<CombatStateKey, CombatStateKeyHash>& activeKeys);
+		void Prune(std::span<const EntityEvent> events);
 
 		/**
 		 * @brief Get immutable pointer to stored entity combat state (nullptr if missing).
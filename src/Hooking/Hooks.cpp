@@ -70,7 +70,8 @@ namespace kx {
             }
 
             // 4. Update Features using Synced Game Time
-            kx::g_App.GetEntityManager().Update(s_gameTimeMs);
+            kx::g_App.GetEntityManager().Update(s_gameTimeMs, static_cast<uint32_t>(frame_time),
+                kx::g_App.GetFeatureManager().GetConsumedCategories());
             kx::g_App.GetFeatureManager().RunGameThreadUpdates();
 
             // 5. Pass execution back to the engine
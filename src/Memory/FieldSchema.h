@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <xmmintrin.h>
+#include "MemorySource.h"
+
+namespace kx {
+
+/**
+ * @brief Compile-time field layouts for the ReClass wrappers
+ *
+ * Each wrapper lists its members once as constexpr Fields (offset, type, name). The single
+ * getters read one field at a time; a Block copies the smallest byte range covering a set
+ * of fields with one guarded read, and the fields are then decoded from that local copy.
+ */
+namespace FieldSchema {
+
+    // Largest span a Block may cover; keeps the copies on the stack cheap
+    inline constexpr size_t MAX_BLOCK_SIZE = 0x800;
+    inline constexpr uintptr_t CACHE_LINE_SIZE = 64;
+
+    template<typename T>
+    struct Field {
+        static_assert(std::is_trivially_copyable_v<T>, "Schema fields are copied as raw bytes");
+        using Type = T;
+
+        uintptr_t offset;
+        const char* name;
+
+        [[nodiscard]] constexpr uintptr_t End() const { return offset + sizeof(T); }
+    };
+
+    /**
+     * @brief Byte range [begin, end) relative to the object base
+     */
+    struct Span {
+        uintptr_t begin = 0;
+        uintptr_t end = 0;
+
+        [[nodiscard]] constexpr size_t Size() const { return end - begin; }
+    };
+
+    /**
+     * @brief Smallest span containing every given field
+     */
+    template<typename... Ts>
+    [[nodiscard]] constexpr Span CoveringSpan(const Field<Ts>&... fields) {
+        static_assert(sizeof...(Ts) > 0, "A span needs at least one field");
+        Span span{ UINTPTR_MAX, 0 };
+        ((span.begin = fields.offset < span.begin ? fields.offset : span.begin,
+          span.end = fields.End() > span.end ? fields.End() : span.end), ...);
+        return span;
+    }
+
+    /**
+     * @brief Local copy of one span of a foreign object
+     *
+     * Load() makes a single MemorySource::ReadBytes call (a guarded copy in Live mode, one
+     * page lookup in Replay/Staged). Get() decodes a field from the copy and returns the
+     * fallback if the load failed.
+     */
+    template<Span S>
+    class Block {
+    public:
+        static_assert(S.Size() > 0 && S.Size() <= MAX_BLOCK_SIZE, "Span too large for one block");
+
+        bool Load(const void* base) noexcept {
+            m_loaded = base && MemorySource::ReadBytes(reinterpret_cast<uintptr_t>(base) + S.begin, m_bytes.data(), m_bytes.size());
+            return m_loaded;
+        }
+
+        [[nodiscard]] bool IsLoaded() const { return m_loaded; }
+
+        template<const auto& F, typename T = typename std::remove_cvref_t<decltype(F)>::Type>
+        [[nodiscard]] T Get(const T& fallback = T{}) const {
+            static_assert(F.offset >= S.begin && F.End() <= S.end, "Field lies outside the block");
+            if (!m_loaded) {
+                return fallback;
+            }
+            T value;
+            std::memcpy(&value, m_bytes.data() + (F.offset - S.begin), sizeof(T));
+            return value;
+        }
+
+    private:
+        std::array<std::byte, S.Size()> m_bytes;
+        bool m_loaded = false;
+    };
+
+    /**
+     * @brief Request every cache line of a span. A hint only: it never faults, whatever the address.
+     */
+    template<Span S>
+    void PrefetchSpan(const void* base) noexcept {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(base);
+        const uintptr_t first = (address + S.begin) & ~(CACHE_LINE_SIZE - 1);
+        const uintptr_t last = address + S.end - 1;
+        for (uintptr_t line = first; line <= last; line += CACHE_LINE_SIZE) {
+            _mm_prefetch(reinterpret_cast<const char*>(line), _MM_HINT_T0);
+        }
+    }
+
+    /**
+     * @brief Guarded read of a single field, for looking ahead of the decode
+     * @return The field, or the fallback if it is unreadable
+     */
+    template<const auto& F, typename T = typename std::remove_cvref_t<decltype(F)>::Type>
+    [[nodiscard]] T Peek(const void* base, const T& fallback = T{}) noexcept {
+        T value;
+        return base && MemorySource::ReadBytes(reinterpret_cast<uintptr_t>(base) + F.offset, &value, sizeof(T)) ? value : fallback;
+    }
+
+} // namespace FieldSchema
+} // namespace kx
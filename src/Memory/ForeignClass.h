@@ -1,10 +1,15 @@
 #pragma once
 
-#include <windows.h> // Required for VirtualProtect
 #include <cstdint>   // Required for UINTPTR_MAX
 #include "../Memory/Safety.h"
+#include "../Memory/MemorySource.h"
+#include "../Memory/FieldSchema.h"
 #include "DebugLogger.h"
 
+#ifdef _WIN32
+#include <excpt.h> // For EXCEPTION_EXECUTE_HANDLER in call()
+#endif
+
 namespace kx {
 
     namespace SafeForeignClassLimits {
@@ -40,16 +45,14 @@ namespace kx {
     public:
         ForeignClass(void* ptr) : m_ptr(ptr) {
             // Critical validation on construction - nullify unsafe pointers immediately
-            if (ptr && !SafeAccess::IsMemorySafe(ptr)) {
-                m_ptr = nullptr; // Nullify unsafe pointers to prevent future crashes
-            }
+            Validate();
         }
 
-        // Copy constructor with validation
-        ForeignClass(const ForeignClass& other) : m_ptr(other.m_ptr) {
-            // Re-validate on copy to ensure safety
-            if (m_ptr && !SafeAccess::IsMemorySafe(m_ptr)) {
-                m_ptr = nullptr;
+        // Copy constructor: the proof of validation travels with the pointer within one extraction pass
+        ForeignClass(const ForeignClass& other) : m_ptr(other.m_ptr), m_validatedEpoch(other.m_validatedEpoch) {
+            // Re-validate on copy unless already proven readable in the current pass
+            if (!IsProvenValid()) {
+                Validate();
             }
         }
 
@@ -57,28 +60,51 @@ namespace kx {
         ForeignClass& operator=(const ForeignClass& other) {
             if (this != &other) {
                 m_ptr = other.m_ptr;
-                // Re-validate on assignment
-                if (m_ptr && !SafeAccess::IsMemorySafe(m_ptr)) {
-                    m_ptr = nullptr;
+                m_validatedEpoch = other.m_validatedEpoch;
+                // Re-validate on assignment unless already proven readable in the current pass
+                if (!IsProvenValid()) {
+                    Validate();
                 }
             }
             return *this;
         }
 
         // Move constructor (safe since we validate on access)
-        ForeignClass(ForeignClass&& other) noexcept : m_ptr(other.m_ptr) {
+        ForeignClass(ForeignClass&& other) noexcept : m_ptr(other.m_ptr), m_validatedEpoch(other.m_validatedEpoch) {
             other.m_ptr = nullptr;
+            other.m_validatedEpoch = 0;
         }
 
         // Move assignment
         ForeignClass& operator=(ForeignClass&& other) noexcept {
             if (this != &other) {
                 m_ptr = other.m_ptr;
+                m_validatedEpoch = other.m_validatedEpoch;
                 other.m_ptr = nullptr;
+                other.m_validatedEpoch = 0;
             }
             return *this;
         }
 
+        /**
+         * @brief Promote a pointer that the caller has already proven readable, without probing it again
+         *
+         * For pointers that just passed a guarded read (e.g. the VTable read of the SafeGameArray
+         * batch validator). The proof lasts for the current extraction pass only.
+         * @param ptr Pointer known to be readable
+         */
+        void AdoptValidated(void* ptr) {
+            m_ptr = ptr;
+            m_validatedEpoch = ptr ? SafeAccess::CurrentValidationEpoch() : 0;
+        }
+
+        /**
+         * @brief Check whether the pointer was proven readable in the extraction pass running on this thread
+         */
+        [[nodiscard]] bool IsProvenValid() const {
+            return m_ptr && m_validatedEpoch != 0 && m_validatedEpoch == SafeAccess::CurrentValidationEpoch();
+        }
+
         /**
          * @brief Read a member variable from foreign memory with comprehensive validation
          * @tparam T Type to read
@@ -109,8 +135,26 @@ namespace kx {
                 return defaultValue;
             }
 
-            auto* address = reinterpret_cast<const T*>(reinterpret_cast<uintptr_t>(m_ptr) + offset);
-            return *address;
+            return MemorySource::Read<T>(reinterpret_cast<uintptr_t>(m_ptr) + offset, defaultValue);
+        }
+
+        /**
+         * @brief FAST read of one schema field. Same rules as ReadMemberFast.
+         */
+        template<const auto& F, typename T = typename std::remove_cvref_t<decltype(F)>::Type>
+        [[nodiscard]] T ReadFieldFast(const T& defaultValue = T{}) const {
+            return ReadMemberFast<T>(F.offset, defaultValue);
+        }
+
+        /**
+         * @brief Copy a schema span with one guarded read
+         * @return The block; not loaded if the pointer is null or the range is unreadable
+         */
+        template<FieldSchema::Span S>
+        [[nodiscard]] FieldSchema::Block<S> ReadBlock() const {
+            FieldSchema::Block<S> block;
+            block.Load(m_ptr);
+            return block;
         }
 
         /**
@@ -142,7 +186,7 @@ namespace kx {
                 return WrapperType(nullptr);
             }
 
-            void* ptr = *reinterpret_cast<void**>(reinterpret_cast<uintptr_t>(m_ptr) + offset);
+            void* ptr = MemorySource::Read<void*>(reinterpret_cast<uintptr_t>(m_ptr) + offset, nullptr);
             return WrapperType(ptr);
         }
 
@@ -209,8 +253,9 @@ namespace kx {
             }
         }
 
+#ifdef _WIN32
         /**
-         * @brief Safely call a virtual function with memory validation
+         * @brief Safely call a virtual function with memory validation (Windows only)
          * @tparam T Return type
          * @tparam Ts Argument types
          * @param offset The offset from the virtual table base to the function to call
@@ -260,13 +305,14 @@ namespace kx {
                 return T(); // Return default value on any exception
             }
         }
+#endif // _WIN32: calls into game code, SEH-guarded; never made on a recorded scene
 
         /**
          * @brief Check if this foreign class points to valid memory
          * @return true if the base pointer is valid and safe to access
          */
         [[nodiscard]] bool isValid() const {
-            return SafeAccess::IsMemorySafe(m_ptr);
+            return IsProvenValid() || SafeAccess::IsMemorySafe(m_ptr);
         }
 
         /**
@@ -395,6 +441,7 @@ namespace kx {
          */
         void reset() {
             m_ptr = nullptr;
+            m_validatedEpoch = 0;
         }
 
         /**
@@ -404,13 +451,25 @@ namespace kx {
         void reset(void* ptr) {
             m_ptr = ptr;
             // Validate the new pointer
-            if (m_ptr && !SafeAccess::IsMemorySafe(m_ptr)) {
-                m_ptr = nullptr;
-            }
+            Validate();
         }
 
     private:
+        /**
+         * @brief Probe the pointer, nullify it if unsafe, and remember the pass it was proven in
+         */
+        void Validate() {
+            m_validatedEpoch = 0;
+            if (!m_ptr) return;
+            if (!SafeAccess::IsMemorySafe(m_ptr)) {
+                m_ptr = nullptr; // Nullify unsafe pointers to prevent future crashes
+                return;
+            }
+            m_validatedEpoch = SafeAccess::CurrentValidationEpoch();
+        }
+
         void* m_ptr;
+        uint32_t m_validatedEpoch = 0; // Extraction pass that proved m_ptr readable (0 = none)
     };
 
     // --- Comparison operators ---
@@ -0,0 +1,184 @@
+#include "MemoryImage.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace kx {
+
+namespace {
+
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+        MemoryImage::Metadata metadata;
+        uint64_t runCount;
+    };
+
+    // A run of consecutive captured pages, followed on disk by pageCount * PAGE_SIZE bytes
+    struct RunHeader {
+        uint64_t firstPage;
+        uint64_t pageCount;
+    };
+
+} // namespace
+
+void MemoryImage::Clear() {
+    m_pageIndex.clear();
+    m_bytes.clear();
+    m_touched.clear();
+    m_requested.clear();
+    m_metadata = Metadata{};
+}
+
+bool MemoryImage::CapturePage(uintptr_t pageBase, PageCopyFn copy) {
+    const uintptr_t pageNumber = pageBase / PAGE_SIZE;
+    if (m_pageIndex.contains(pageNumber)) {
+        return true;
+    }
+
+    const size_t offset = m_bytes.size();
+    m_bytes.resize(offset + PAGE_SIZE);
+    if (!copy(pageNumber * PAGE_SIZE, m_bytes.data() + offset, PAGE_SIZE)) {
+        m_bytes.resize(offset);
+        return false;
+    }
+    m_pageIndex.emplace(pageNumber, offset);
+    return true;
+}
+
+bool MemoryImage::Touch(uintptr_t address) {
+    auto it = m_pageIndex.find(address / PAGE_SIZE);
+    if (it == m_pageIndex.end()) {
+        return false;
+    }
+
+    const size_t slot = it->second / PAGE_SIZE;
+    if (slot >= m_touched.size()) {
+        m_touched.resize(m_bytes.size() / PAGE_SIZE, 0);
+    }
+    m_touched[slot] = 1;
+    return true;
+}
+
+void MemoryImage::CollectTouchedPages(std::vector<uintptr_t>& out) const {
+    out.clear();
+    for (const auto& [pageNumber, offset] : m_pageIndex) {
+        const size_t slot = offset / PAGE_SIZE;
+        if (slot < m_touched.size() && m_touched[slot]) {
+            out.push_back(pageNumber * PAGE_SIZE);
+        }
+    }
+    for (const uintptr_t pageNumber : m_requested) {
+        out.push_back(pageNumber * PAGE_SIZE);
+    }
+}
+
+void MemoryImage::AddPage(uintptr_t pageBase, const uint8_t* bytes) {
+    const uintptr_t pageNumber = pageBase / PAGE_SIZE;
+    if (m_pageIndex.contains(pageNumber)) {
+        return;
+    }
+
+    const size_t offset = m_bytes.size();
+    m_bytes.insert(m_bytes.end(), bytes, bytes + PAGE_SIZE);
+    m_pageIndex.emplace(pageNumber, offset);
+}
+
+bool MemoryImage::Read(uintptr_t address, void* out, size_t size) const {
+    auto* dest = static_cast<uint8_t*>(out);
+
+    while (size > 0) {
+        auto it = m_pageIndex.find(address / PAGE_SIZE);
+        if (it == m_pageIndex.end()) {
+            return false;
+        }
+
+        // Rebase: recorded address -> offset inside the host copy of the page
+        const size_t inPage = address % PAGE_SIZE;
+        const size_t chunk = (std::min)(size, PAGE_SIZE - inPage);
+        std::memcpy(dest, m_bytes.data() + it->second + inPage, chunk);
+
+        dest += chunk;
+        address += chunk;
+        size -= chunk;
+    }
+
+    return true;
+}
+
+bool MemoryImage::SaveToFile(const std::filesystem::path& path) const {
+    std::vector<uintptr_t> pages;
+    pages.reserve(m_pageIndex.size());
+    for (const auto& [pageNumber, offset] : m_pageIndex) {
+        pages.push_back(pageNumber);
+    }
+    std::sort(pages.begin(), pages.end());
+
+    // Coalesce adjacent pages into runs
+    std::vector<RunHeader> runs;
+    for (uintptr_t pageNumber : pages) {
+        if (!runs.empty() && runs.back().firstPage + runs.back().pageCount == pageNumber) {
+            runs.back().pageCount++;
+        } else {
+            runs.push_back({ pageNumber, 1 });
+        }
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+
+    const FileHeader header{ FILE_MAGIC, FILE_VERSION, m_metadata, runs.size() };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const RunHeader& run : runs) {
+        file.write(reinterpret_cast<const char*>(&run), sizeof(run));
+        for (uint64_t i = 0; i < run.pageCount; ++i) {
+            const size_t offset = m_pageIndex.at(run.firstPage + i);
+            file.write(reinterpret_cast<const char*>(m_bytes.data() + offset), PAGE_SIZE);
+        }
+    }
+
+    return static_cast<bool>(file);
+}
+
+bool MemoryImage::LoadFromFile(const std::filesystem::path& path) {
+    Clear();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    FileHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != FILE_MAGIC || header.version != FILE_VERSION) {
+        return false;
+    }
+
+    for (uint64_t r = 0; r < header.runCount; ++r) {
+        RunHeader run{};
+        if (!file.read(reinterpret_cast<char*>(&run), sizeof(run))) {
+            Clear();
+            return false;
+        }
+
+        const size_t offset = m_bytes.size();
+        m_bytes.resize(offset + run.pageCount * PAGE_SIZE);
+        if (!file.read(reinterpret_cast<char*>(m_bytes.data() + offset), run.pageCount * PAGE_SIZE)) {
+            Clear();
+            return false;
+        }
+
+        for (uint64_t i = 0; i < run.pageCount; ++i) {
+            m_pageIndex.emplace(run.firstPage + i, offset + i * PAGE_SIZE);
+        }
+    }
+
+    m_metadata = header.metadata;
+    return true;
+}
+
+} // namespace kx
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+#include <ankerl/unordered_dense.h>
+
+namespace kx {
+
+/**
+ * @brief Page-granular copy of the game memory reachable from the ContextCollection
+ *
+ * Captured pages keep their original virtual addresses as keys. On replay, every
+ * read is rebased from the recorded address onto the host buffer that holds the
+ * page, so recorded pointers can be followed as-is without the original process.
+ *
+ * Platform-neutral: no Windows headers, no SEH. Used by MemorySource for both
+ * the Recording and the Replay backends.
+ */
+class MemoryImage {
+public:
+    static constexpr size_t PAGE_SIZE = 0x1000;
+    static constexpr uint32_t FILE_MAGIC = 0x494D584B; // "KXMI"
+    static constexpr uint32_t FILE_VERSION = 1;
+
+    /**
+     * @brief Process state recorded alongside the pages
+     */
+    struct Metadata {
+        uint64_t moduleBase = 0;        // Game module range, used for VTable validation on replay
+        uint64_t moduleSize = 0;
+        uint64_t contextCollection = 0; // Root pointer extraction starts from
+        uint64_t localPlayer = 0;       // ChCliCharacter* of the local player at capture time
+    };
+
+    MemoryImage() = default;
+
+    /**
+     * @brief Drop all pages and metadata
+     */
+    void Clear();
+
+    /**
+     * @brief Check whether the page containing an address was captured
+     */
+    [[nodiscard]] bool HasPage(uintptr_t address) const {
+        return m_pageIndex.contains(address / PAGE_SIZE);
+    }
+
+    /**
+     * @brief Store a full page. No-op if the page is already present.
+     * @param pageBase Page-aligned address of the page in the source process
+     * @param bytes PAGE_SIZE bytes of page content
+     */
+    void AddPage(uintptr_t pageBase, const uint8_t* bytes);
+
+    using PageCopyFn = bool (*)(uintptr_t source, void* destination, size_t size);
+
+    /**
+     * @brief Copy a page straight into the image's storage. No-op if the page is already present.
+     * @param pageBase Page-aligned address of the page in the source process
+     * @param copy Guarded copy from the source process
+     * @return false if the copy failed; the page is not added
+     */
+    bool CapturePage(uintptr_t pageBase, PageCopyFn copy);
+
+    /**
+     * @brief Mark the page containing an address as used
+     * @return false if the page was not captured
+     */
+    bool Touch(uintptr_t address);
+
+    /**
+     * @brief Note that a page missing from the image was needed (staged decoding)
+     */
+    void RequestPage(uintptr_t address) { m_requested.insert(address / PAGE_SIZE); }
+
+    [[nodiscard]] size_t GetRequestedPageCount() const { return m_requested.size(); }
+
+    /**
+     * @brief Page-aligned addresses of every page marked by Touch() or RequestPage(), in no particular order
+     * @param out Cleared first, keeps its capacity
+     */
+    void CollectTouchedPages(std::vector<uintptr_t>& out) const;
+
+    /**
+     * @brief Copy bytes at a recorded address into a host buffer
+     * @return false if any byte of the range lies in a page that was not captured
+     */
+    [[nodiscard]] bool Read(uintptr_t address, void* out, size_t size) const;
+
+    [[nodiscard]] size_t GetPageCount() const { return m_pageIndex.size(); }
+    [[nodiscard]] size_t GetByteCount() const { return m_bytes.size(); }
+
+    [[nodiscard]] const Metadata& GetMetadata() const { return m_metadata; }
+    void SetMetadata(const Metadata& metadata) { m_metadata = metadata; }
+
+    /**
+     * @brief Write header and pages to disk. Adjacent pages are coalesced into runs.
+     */
+    bool SaveToFile(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Replace the current contents with an image loaded from disk
+     * @return false on I/O error or if the file is not a compatible image
+     */
+    bool LoadFromFile(const std::filesystem::path& path);
+
+private:
+    // Page number (address / PAGE_SIZE) -> byte offset of the page in m_bytes
+    ankerl::unordered_dense::map<uintptr_t, size_t> m_pageIndex;
+    std::vector<uint8_t> m_bytes;
+    std::vector<uint8_t> m_touched; // Per page slot (offset / PAGE_SIZE); grown on demand
+    ankerl::unordered_dense::set<uintptr_t> m_requested; // Page numbers needed but not captured
+    Metadata m_metadata;
+};
+
+} // namespace kx
@@ -0,0 +1,208 @@
+#include "MemorySource.h"
+#include "MemoryImage.h"
+#include "Safety.h"
+#include "AddressManager.h"
+
+namespace kx {
+namespace MemorySource {
+
+namespace {
+
+    /**
+     * @brief Copy every page overlapping [address, address + size) into the recording target
+     * @return false if any of the pages is not readable in the live process
+     */
+    bool RecordRange(MemoryImage& image, uintptr_t address, size_t size) {
+        if (size == 0) return true;
+
+        const uintptr_t firstPage = address / MemoryImage::PAGE_SIZE;
+        const uintptr_t lastPage = (address + size - 1) / MemoryImage::PAGE_SIZE;
+        for (uintptr_t page = firstPage; page <= lastPage; ++page) {
+            const uintptr_t pageBase = page * MemoryImage::PAGE_SIZE;
+            if (image.Touch(pageBase)) continue;
+
+            if (!image.CapturePage(pageBase, &SafeAccess::RawSafeCopy)) {
+                return false;
+            }
+            image.Touch(pageBase);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Mark every page overlapping [address, address + size) as used by a staged decode
+     * @return false if any of the pages was not captured; those are requested for the next capture
+     */
+    bool StagedRange(MemoryImage& image, uintptr_t address, size_t size) {
+        if (size == 0) return true;
+
+        bool captured = true;
+        const uintptr_t firstPage = address / MemoryImage::PAGE_SIZE;
+        const uintptr_t lastPage = (address + size - 1) / MemoryImage::PAGE_SIZE;
+        for (uintptr_t page = firstPage; page <= lastPage; ++page) {
+            const uintptr_t pageBase = page * MemoryImage::PAGE_SIZE;
+            if (!image.Touch(pageBase)) {
+                image.RequestPage(pageBase);
+                ++detail::t_stagedMisses;
+                captured = false;
+            }
+        }
+        return captured;
+    }
+
+    /**
+     * @brief Image whose metadata answers root queries (Replay and Staged), or nullptr
+     */
+    const MemoryImage* GetMetadataSource() noexcept {
+        switch (detail::t_mode) {
+        case Mode::Replay: return detail::t_replaySource;
+        case Mode::Staged: return detail::t_recordTarget;
+        default:           return nullptr;
+        }
+    }
+
+    bool IsInModuleRange(uintptr_t vtable, uintptr_t moduleBase, uint64_t moduleSize) {
+        return moduleBase > 0 && moduleSize > 0 && vtable >= moduleBase && vtable < moduleBase + moduleSize;
+    }
+
+} // namespace
+
+bool ReadBytes(uintptr_t address, void* out, size_t size) noexcept {
+    switch (detail::t_mode) {
+    case Mode::Recording:
+        // Serve the value from the captured copy so a replay sees exactly what was recorded
+        if (!detail::t_recordTarget || !RecordRange(*detail::t_recordTarget, address, size)) {
+            return false;
+        }
+        return detail::t_recordTarget->Read(address, out, size);
+    case Mode::Staged:
+        // Never live memory: the game thread changes and frees it while the decode runs.
+        // A page the capture lacked is unreadable this pass (the extraction keeps the previous
+        // values of the entity behind it) and staged by the next capture.
+        return detail::t_recordTarget && StagedRange(*detail::t_recordTarget, address, size) &&
+            detail::t_recordTarget->Read(address, out, size);
+    case Mode::Replay:
+        return detail::t_replaySource && detail::t_replaySource->Read(address, out, size);
+    case Mode::Live:
+    default:
+        return SafeAccess::RawSafeCopy(address, out, size);
+    }
+}
+
+bool IsReadable(uintptr_t address) noexcept {
+    switch (detail::t_mode) {
+    case Mode::Recording:
+        return detail::t_recordTarget && RecordRange(*detail::t_recordTarget, address, 1);
+    case Mode::Staged:
+        return detail::t_recordTarget && StagedRange(*detail::t_recordTarget, address, 1);
+    case Mode::Replay:
+        return detail::t_replaySource && detail::t_replaySource->HasPage(address);
+    case Mode::Live:
+    default:
+        return SafeAccess::ProbeMemory(reinterpret_cast<void*>(address));
+    }
+}
+
+bool IsValidGameObject(uintptr_t address) noexcept {
+    uintptr_t vtable = 0;
+    if (!ReadBytes(address, &vtable, sizeof(vtable))) {
+        return false;
+    }
+
+    if (detail::t_mode == Mode::Replay || detail::t_mode == Mode::Staged) {
+        const MemoryImage* source = GetMetadataSource();
+        if (!source) return false;
+        const MemoryImage::Metadata& metadata = source->GetMetadata();
+        return IsInModuleRange(vtable, static_cast<uintptr_t>(metadata.moduleBase), metadata.moduleSize);
+    }
+
+    return IsInModuleRange(vtable, AddressManager::GetModuleBase(), AddressManager::GetModuleSize());
+}
+
+size_t CopyWideString(const wchar_t* source, wchar_t* buffer, size_t capacity) noexcept {
+    if (!buffer || capacity == 0) return 0;
+
+    size_t length = 0;
+    if (source) {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(source);
+        while (length + 1 < capacity) {
+            const wchar_t c = Read<wchar_t>(base + length * sizeof(wchar_t), L'\0');
+            if (c == L'\0') break;
+            buffer[length++] = c;
+        }
+    }
+    buffer[length] = L'\0';
+    return length;
+}
+
+void* GetContextCollectionPtr() noexcept {
+    if (detail::t_mode == Mode::Replay || detail::t_mode == Mode::Staged) {
+        const MemoryImage* source = GetMetadataSource();
+        return source ? reinterpret_cast<void*>(source->GetMetadata().contextCollection) : nullptr;
+    }
+    return AddressManager::GetContextCollectionPtr();
+}
+
+void* GetLocalPlayerPtr() noexcept {
+    if (detail::t_mode == Mode::Replay || detail::t_mode == Mode::Staged) {
+        const MemoryImage* source = GetMetadataSource();
+        return source ? reinterpret_cast<void*>(source->GetMetadata().localPlayer) : nullptr;
+    }
+    return AddressManager::GetLocalPlayer();
+}
+
+size_t CaptureStaging(MemoryImage& image, const std::vector<uintptr_t>& pageBases) {
+    image.Clear();
+    {
+        ScopedRecording recording(image); // Resolves the roots; the pages behind them are captured too
+    }
+    // Not touched: only pages the decode actually reads are carried into the next capture
+    for (const uintptr_t pageBase : pageBases) {
+        image.CapturePage(pageBase, &SafeAccess::RawSafeCopy);
+    }
+    return image.GetPageCount();
+}
+
+ScopedRecording::ScopedRecording(MemoryImage& image)
+    : m_previousMode(detail::t_mode), m_previousTarget(detail::t_recordTarget) {
+    detail::t_mode = Mode::Recording;
+    detail::t_recordTarget = &image;
+
+    // Resolve the roots while recording so the pages behind them are captured too
+    MemoryImage::Metadata metadata;
+    metadata.moduleBase = AddressManager::GetModuleBase();
+    metadata.moduleSize = AddressManager::GetModuleSize();
+    metadata.contextCollection = reinterpret_cast<uint64_t>(AddressManager::GetContextCollectionPtr());
+    metadata.localPlayer = reinterpret_cast<uint64_t>(AddressManager::GetLocalPlayer());
+    image.SetMetadata(metadata);
+}
+
+ScopedRecording::~ScopedRecording() {
+    detail::t_mode = m_previousMode;
+    detail::t_recordTarget = m_previousTarget;
+}
+
+ScopedStaging::ScopedStaging(MemoryImage& image)
+    : m_previousMode(detail::t_mode), m_previousTarget(detail::t_recordTarget) {
+    detail::t_mode = Mode::Staged;
+    detail::t_recordTarget = &image;
+}
+
+ScopedStaging::~ScopedStaging() {
+    detail::t_mode = m_previousMode;
+    detail::t_recordTarget = m_previousTarget;
+}
+
+ScopedReplay::ScopedReplay(const MemoryImage& image)
+    : m_previousMode(detail::t_mode), m_previousSource(detail::t_replaySource) {
+    detail::t_mode = Mode::Replay;
+    detail::t_replaySource = &image;
+}
+
+ScopedReplay::~ScopedReplay() {
+    detail::t_mode = m_previousMode;
+    detail::t_replaySource = m_previousSource;
+}
+
+} // namespace MemorySource
+} // namespace kx
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace kx {
+
+class MemoryImage;
+
+/**
+ * @brief Pluggable backend for every game-memory read made by the extraction layer
+ *
+ * - Live:      reads go straight to process memory (the default, zero overhead beyond one TLS check)
+ * - Recording: reads go to process memory and every touched page is copied into a MemoryImage
+ * - Replay:    reads are served from a MemoryImage, so extraction can run without the game
+ * - Staged:    reads are served from a MemoryImage captured on the game thread; pages it
+ *              lacks are unreadable, counted and requested for the next capture (off-thread decoding)
+ *
+ * The mode is per-thread: the game thread can record or replay while the render
+ * thread keeps reading live memory. Use the scoped guards to switch modes.
+ */
+namespace MemorySource {
+
+    enum class Mode : uint8_t {
+        Live,
+        Recording,
+        Replay,
+        Staged
+    };
+
+    namespace detail {
+        inline thread_local Mode t_mode = Mode::Live;
+        inline thread_local MemoryImage* t_recordTarget = nullptr;      // Recording, Staged
+        inline thread_local const MemoryImage* t_replaySource = nullptr; // Replay
+        inline thread_local uint64_t t_stagedMisses = 0;                  // Staged
+    }
+
+    [[nodiscard]] inline Mode GetMode() noexcept { return detail::t_mode; }
+    [[nodiscard]] inline bool IsLive() noexcept { return detail::t_mode == Mode::Live; }
+
+    /**
+     * @brief Running count of pages this thread needed but the staging image lacked
+     *
+     * Only ever grows, in Staged mode; compare two readings to tell whether the reads made in
+     * between were complete.
+     */
+    [[nodiscard]] inline uint64_t GetStagedMisses() noexcept { return detail::t_stagedMisses; }
+
+    // --- Backend dispatch ---
+
+    /**
+     * @brief Copy bytes from the active backend (guarded copy in Live mode)
+     * @return false if the range is unreadable (Live/Recording) or was not captured (Replay/Staged)
+     */
+    bool ReadBytes(uintptr_t address, void* out, size_t size) noexcept;
+
+    /**
+     * @brief Probe a single address on the active backend. Recording captures the page.
+     */
+    bool IsReadable(uintptr_t address) noexcept;
+
+    /**
+     * @brief VTable range check against the live module (Recording) or the recorded module range (Replay)
+     */
+    bool IsValidGameObject(uintptr_t address) noexcept;
+
+    // --- Mode-independent helpers ---
+
+    /**
+     * @brief Typed read through the active backend
+     *
+     * In Live mode this is a plain dereference, identical to the original fast path:
+     * callers are responsible for having validated the base pointer.
+     */
+    template<typename T>
+    [[nodiscard]] inline T Read(uintptr_t address, const T& fallback = T{}) noexcept {
+        if (IsLive()) {
+            return *reinterpret_cast<const T*>(address);
+        }
+        T value;
+        return ReadBytes(address, &value, sizeof(T)) ? value : fallback;
+    }
+
+    /**
+     * @brief Copy a null-terminated wide string into a local buffer
+     * @return Number of characters copied (excluding the terminator)
+     */
+    size_t CopyWideString(const wchar_t* source, wchar_t* buffer, size_t capacity) noexcept;
+
+    /**
+     * @brief ContextCollection root for the active backend (live pointer or recorded root)
+     */
+    void* GetContextCollectionPtr() noexcept;
+
+    /**
+     * @brief Local player ChCliCharacter* for the active backend
+     */
+    void* GetLocalPlayerPtr() noexcept;
+
+    /**
+     * @brief Record every page touched on this thread into an image for the guard's lifetime
+     *
+     * The image metadata (module range, context collection, local player) is filled in
+     * on construction from the live process.
+     */
+    class ScopedRecording {
+    public:
+        explicit ScopedRecording(MemoryImage& image);
+        ~ScopedRecording();
+        ScopedRecording(const ScopedRecording&) = delete;
+        ScopedRecording& operator=(const ScopedRecording&) = delete;
+
+    private:
+        Mode m_previousMode;
+        MemoryImage* m_previousTarget;
+    };
+
+    /**
+     * @brief Capture stage of an off-thread extraction: copy a set of pages into a staging image
+     *
+     * Clears the image, resolves the roots (context collection, local player) from the live
+     * process into its metadata, then copies every listed page that is readable. Meant to run
+     * on the game thread; decoding then happens elsewhere under ScopedStaging.
+     *
+     * @param image Staging image, reused across passes to keep its capacity
+     * @param pageBases Page-aligned addresses to copy (typically the pages the previous decode touched)
+     * @return Number of pages in the image
+     */
+    size_t CaptureStaging(MemoryImage& image, const std::vector<uintptr_t>& pageBases);
+
+    /**
+     * @brief Serve all reads on this thread from a staging image for the guard's lifetime
+     *
+     * Process memory is never read: it may be mid-update or freed since the capture. Reads of
+     * pages missing from the image fail and are counted (GetStagedMisses()), so the extraction
+     * keeps the previous values of the entity behind them, and the pages are requested
+     * (MemoryImage::RequestPage()). Together with the pages marked by MemoryImage::Touch(), the
+     * decode tells the next capture exactly which pages it needs.
+     */
+    class ScopedStaging {
+    public:
+        explicit ScopedStaging(MemoryImage& image);
+        ~ScopedStaging();
+        ScopedStaging(const ScopedStaging&) = delete;
+        ScopedStaging& operator=(const ScopedStaging&) = delete;
+
+    private:
+        Mode m_previousMode;
+        MemoryImage* m_previousTarget;
+    };
+
+    /**
+     * @brief Serve all reads on this thread from a captured image for the guard's lifetime
+     */
+    class ScopedReplay {
+    public:
+        explicit ScopedReplay(const MemoryImage& image);
+        ~ScopedReplay();
+        ScopedReplay(const ScopedReplay&) = delete;
+        ScopedReplay& operator=(const ScopedReplay&) = delete;
+
+    private:
+        Mode m_previousMode;
+        const MemoryImage* m_previousSource;
+    };
+
+} // namespace MemorySource
+} // namespace kx
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+namespace kx {
+namespace SafeAccess {
+
+    /**
+     * @brief Direct-mapped cache of pages already proven readable during one extraction pass
+     *
+     * A single entity extraction constructs dozens of ForeignClass wrappers, and every
+     * construction probes its pointer. Most of those pointers share a handful of pages.
+     * While a cache is active on a thread, IsMemorySafe() answers repeat probes of a
+     * page from this table instead of touching memory again.
+     *
+     * Only successful probes are cached. Entries are tagged with a generation; bumping
+     * the generation once per extraction pass invalidates every entry in O(1), so a page
+     * that was readable last frame is always probed again before it is trusted.
+     *
+     * Generations are unique across all caches, so they double as the validation
+     * epoch that ForeignClass wrappers carry to skip re-probing on copy.
+     */
+    class PageProbeCache {
+    public:
+        static constexpr size_t ENTRY_COUNT = 1024; // Power of two; covers 4 MiB of distinct pages
+        static constexpr unsigned PAGE_SHIFT = 12;
+
+        struct Stats {
+            uint32_t hits = 0;
+            uint32_t misses = 0;
+        };
+
+        PageProbeCache() = default;
+
+        /**
+         * @brief Invalidate all entries and reset the counters. Call once per extraction pass.
+         */
+        void NextGeneration() {
+            const uint32_t next = s_nextGeneration.fetch_add(1, std::memory_order_relaxed);
+            if (next <= m_generation) {
+                // Wrapped: entries tagged with old generations could alias, drop them
+                m_entries.fill(Entry{});
+            }
+            m_generation = next != 0 ? next : s_nextGeneration.fetch_add(1, std::memory_order_relaxed);
+            m_stats = Stats{};
+        }
+
+        [[nodiscard]] uint32_t GetGeneration() const { return m_generation; }
+
+        /**
+         * @brief Check whether the page containing an address was proven readable this generation
+         * Counts a hit or a miss.
+         */
+        [[nodiscard]] bool Lookup(uintptr_t address) {
+            const uintptr_t page = address >> PAGE_SHIFT;
+            const Entry& entry = m_entries[page & (ENTRY_COUNT - 1)];
+            if (entry.page == page && entry.generation == m_generation) {
+                ++m_stats.hits;
+                return true;
+            }
+            ++m_stats.misses;
+            return false;
+        }
+
+        /**
+         * @brief Record that the page containing an address is readable
+         */
+        void Insert(uintptr_t address) {
+            const uintptr_t page = address >> PAGE_SHIFT;
+            m_entries[page & (ENTRY_COUNT - 1)] = { page, m_generation };
+        }
+
+        [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+
+    private:
+        struct Entry {
+            uintptr_t page = 0;
+            uint32_t generation = 0; // 0 never matches: m_generation starts at 1
+        };
+
+        std::array<Entry, ENTRY_COUNT> m_entries{};
+        uint32_t m_generation = 1;
+        Stats m_stats;
+
+        static inline std::atomic<uint32_t> s_nextGeneration{ 2 };
+    };
+
+    namespace detail {
+        inline thread_local PageProbeCache* t_activeProbeCache = nullptr;
+    }
+
+    /**
+     * @brief Page cache consulted by IsMemorySafe() on this thread, or nullptr
+     */
+    [[nodiscard]] inline PageProbeCache* GetActiveProbeCache() noexcept {
+        return detail::t_activeProbeCache;
+    }
+
+    /**
+     * @brief Identifier of the extraction pass running on this thread, or 0 outside of one
+     *
+     * A pointer proven readable under a non-zero epoch stays trusted for the rest of that pass.
+     */
+    [[nodiscard]] inline uint32_t CurrentValidationEpoch() noexcept {
+        return detail::t_activeProbeCache ? detail::t_activeProbeCache->GetGeneration() : 0;
+    }
+
+    /**
+     * @brief Activate a page cache on the current thread for the guard's lifetime
+     *
+     * Scope it to one extraction pass on the Game Thread. Other threads keep probing
+     * memory directly.
+     */
+    class ScopedPageProbeCache {
+    public:
+        explicit ScopedPageProbeCache(PageProbeCache& cache)
+            : m_previous(detail::t_activeProbeCache) {
+            detail::t_activeProbeCache = &cache;
+        }
+        ~ScopedPageProbeCache() { detail::t_activeProbeCache = m_previous; }
+        ScopedPageProbeCache(const ScopedPageProbeCache&) = delete;
+        ScopedPageProbeCache& operator=(const ScopedPageProbeCache&) = delete;
+
+    private:
+        PageProbeCache* m_previous;
+    };
+
+} // namespace SafeAccess
+} // namespace kx
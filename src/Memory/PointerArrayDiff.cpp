@@ -0,0 +1,16 @@
+#include "PointerArrayDiff.h"
+#include "MemorySource.h"
+
+namespace kx {
+namespace SafeAccess {
+
+bool CopyPointerArray(void** array, uint32_t capacity, std::vector<void*>& out) {
+    if (!array || capacity == 0) {
+        return false;
+    }
+    out.resize(capacity);
+    return MemorySource::ReadBytes(reinterpret_cast<uintptr_t>(array), out.data(), capacity * sizeof(void*));
+}
+
+} // namespace SafeAccess
+} // namespace kx
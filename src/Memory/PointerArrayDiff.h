@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+namespace kx {
+namespace SafeAccess {
+
+    /**
+     * @brief Copy a game pointer array with one guarded copy (through the memory source)
+     * @param array The game's pointer array
+     * @param capacity Number of slots in the array
+     * @param out Receives the pointers (resized to capacity, keeps its allocation)
+     * @return False if the array is null, empty or unreadable
+     */
+    bool CopyPointerArray(void** array, uint32_t capacity, std::vector<void*>& out);
+
+    /**
+     * @brief Tracks which slots of one sparse game pointer array changed since the last pass
+     *
+     * Each pass copies the array once and compares it with the pointers of the previous pass;
+     * a single memcmp settles the common case of an unchanged array. Slots whose pointer stayed
+     * the same can still hold an object that changed in place, so a few of them are handed out
+     * per pass in round-robin for the owner to re-read.
+     *
+     * A pass is Read(), then ForEachChanged(), then optionally ForEachRecheck(). Per-slot state
+     * of the owner is its own business, including slots dropped when the array shrinks.
+     */
+    class PointerArrayDiff {
+    public:
+        PointerArrayDiff() = default;
+
+        /**
+         * @brief Copy this pass's pointers
+         * @return False if the array is unreadable; everything is forgotten then
+         */
+        bool Read(void** array, uint32_t capacity) {
+            if (!CopyPointerArray(array, capacity, m_scratch)) {
+                Clear();
+                return false;
+            }
+            // Growth adds empty slots for the comparison; shrinkage drops the tail
+            m_slots.resize(capacity, nullptr);
+            return true;
+        }
+
+        /**
+         * @brief Call onChanged(slot, object) for every slot whose pointer differs from last pass,
+         *        then make this pass's pointers the baseline
+         */
+        template <typename OnChanged>
+        void ForEachChanged(OnChanged&& onChanged) {
+            const uint32_t capacity = GetCapacity();
+            if (std::memcmp(m_scratch.data(), m_slots.data(), capacity * sizeof(void*)) != 0) {
+                for (uint32_t slot = 0; slot < capacity; ++slot) {
+                    if (m_scratch[slot] != m_slots[slot]) {
+                        m_slots[slot] = m_scratch[slot];
+                        onChanged(slot, m_slots[slot]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Call onRecheck(slot, object) for the next `count` slots in round-robin
+         *        (null slots included, so the owner decides what needs a re-read)
+         */
+        template <typename OnRecheck>
+        void ForEachRecheck(uint32_t count, OnRecheck&& onRecheck) {
+            const uint32_t capacity = GetCapacity();
+            if (capacity == 0) {
+                return;
+            }
+            const uint32_t rechecks = (std::min)(count, capacity);
+            for (uint32_t n = 0; n < rechecks; ++n) {
+                const uint32_t slot = m_recheckCursor++ % capacity;
+                onRecheck(slot, m_slots[slot]);
+            }
+            m_recheckCursor %= capacity;
+        }
+
+        /**
+         * @brief Report the slot as changed on the next pass, e.g., after its object was reused in place
+         */
+        void Invalidate(uint32_t slot) {
+            if (slot < m_slots.size()) {
+                m_slots[slot] = nullptr;
+            }
+        }
+
+        /**
+         * @brief Pointers of the last pass, once ForEachChanged() ran
+         */
+        [[nodiscard]] std::span<void* const> GetSlots() const { return m_slots; }
+
+        [[nodiscard]] uint32_t GetCapacity() const { return static_cast<uint32_t>(m_slots.size()); }
+
+        /**
+         * @brief Forget the baseline and the round-robin position (e.g., on map change)
+         */
+        void Clear() {
+            m_slots.clear();
+            m_recheckCursor = 0;
+        }
+
+    private:
+        std::vector<void*> m_slots;     // Slot -> pointer seen last pass
+        std::vector<void*> m_scratch;   // This pass's copy of the pointer array
+        uint32_t m_recheckCursor = 0;
+    };
+
+} // namespace SafeAccess
+} // namespace kx
@@ -1,12 +1,79 @@
 #pragma once
 
 #include <iterator>
+#include <span>
 #include <cstdint>
+#include <vector>
 #include "Safety.h"
+#include "MemorySource.h"
+#include "PointerArrayDiff.h"
+#include "SlotOccupancy.h"
+#include "ValidatedSlot.h"
 
 namespace kx {
 namespace SafeAccess {
 
+    /**
+     * @brief Validate every slot of a sparse game pointer array in one pass
+     *
+     * Instead of one guarded VTable read per slot, the pointer array is copied with a
+     * single guarded copy and all candidate VTables are read inside one guarded region
+     * (resuming after a faulting slot). Only slots whose VTable lies inside the game
+     * module are emitted, in array order.
+     *
+     * @param array The game's sparse pointer array
+     * @param capacity Number of slots in the array
+     * @param out Receives the validated slots (cleared first, keeps its capacity)
+     * @return Number of validated slots
+     */
+    inline size_t ValidateObjectArray(void** array, uint32_t capacity, std::vector<ValidatedSlot>& out) {
+        out.clear();
+        if (!array || capacity == 0) return 0;
+
+        // Per-thread scratch, resolved once: every access to a thread_local goes through TLS
+        static thread_local std::vector<void*> candidateScratch;
+        static thread_local std::vector<uintptr_t> vtableScratch;
+        if (!CopyPointerArray(array, capacity, candidateScratch)) {
+            return 0;
+        }
+        vtableScratch.resize(capacity);
+        void** const candidates = candidateScratch.data();
+        uintptr_t* const vtables = vtableScratch.data();
+
+        if (MemorySource::IsLive()) {
+            const uintptr_t moduleBase = AddressManager::GetModuleBase();
+            const uintptr_t moduleSize = AddressManager::GetModuleSize();
+            if (moduleBase == 0 || moduleSize == 0) return 0;
+
+            volatile uint32_t cursor = 0;
+            while (!RawSafeReadVTables(candidates, vtables, capacity, cursor)) {
+                vtables[cursor] = 0; // Unreadable object, skip it and continue with the next slot
+                cursor = cursor + 1;
+            }
+
+            PageProbeCache* cache = GetActiveProbeCache();
+            for (uint32_t i = 0; i < capacity; ++i) {
+                const uintptr_t vtable = vtables[i];
+                if (vtable >= moduleBase && vtable < moduleBase + moduleSize) {
+                    out.push_back({ i, candidates[i], vtable });
+                    // The VTable read proved the page readable; the wrapper's probe becomes a cache hit
+                    if (cache) cache->Insert(reinterpret_cast<uintptr_t>(candidates[i]));
+                }
+            }
+        } else {
+            // Recorded/replayed memory: per-slot checks through the memory source
+            for (uint32_t i = 0; i < capacity; ++i) {
+                void* candidate = candidates[i];
+                if (IsAddressInBounds(candidate) &&
+                    MemorySource::IsValidGameObject(reinterpret_cast<uintptr_t>(candidate))) {
+                    out.push_back({ i, candidate, MemorySource::Read<uintptr_t>(reinterpret_cast<uintptr_t>(candidate), 0) });
+                }
+            }
+        }
+
+        return out.size();
+    }
+
     /**
      * @brief Generic safe iterator for game array structures
      * 
@@ -28,7 +95,7 @@ namespace SafeAccess {
             void advance_to_valid() {
                 m_current = WrapperType(nullptr);
                 while (m_idx < m_cap) {
-                    void* candidate = m_ptr[m_idx];
+                    void* candidate = MemorySource::Read<void*>(reinterpret_cast<uintptr_t>(m_ptr + m_idx), nullptr);
                     
                     if (IsValidGameObject(candidate)) {
                         WrapperType wrapper(candidate);
@@ -86,18 +153,98 @@ namespace SafeAccess {
             }
         };
 
+        /**
+         * @brief Dense view over the slots that passed ValidateObjectArray()
+         *
+         * A view may be rebuilt from any sub-span of its Slots() and iterated on another
+         * thread while those slots stay alive, e.g. by the workers of a fork-join pass.
+         */
+        class ValidatedView {
+        public:
+            class Iterator {
+            private:
+                using SlotIterator = const ValidatedSlot*;
+
+                SlotIterator m_it;
+                SlotIterator m_end;
+                WrapperType m_current;
+
+                void adopt_current() {
+                    // The VTable read already proved the object readable: adopt it without probing again
+                    m_current.AdoptValidated(m_it != m_end ? m_it->object : nullptr);
+                }
+
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = WrapperType;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const WrapperType*;
+                using reference = const WrapperType&;
+
+                Iterator(SlotIterator it, SlotIterator end)
+                    : m_it(it), m_end(end), m_current(nullptr) {
+                    adopt_current();
+                }
+
+                Iterator& operator++() {
+                    if (m_it != m_end) {
+                        ++m_it;
+                        adopt_current();
+                    }
+                    return *this;
+                }
+
+                bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+                bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+                const WrapperType& operator*() const { return m_current; }
+                const WrapperType* operator->() const { return &m_current; }
+
+                /**
+                 * @brief Index of the current object in the source array
+                 */
+                uint32_t index() const { return m_it->index; }
+            };
+
+            ValidatedView(const ValidatedSlot* first, const ValidatedSlot* last) : m_first(first), m_last(last) {}
+            explicit ValidatedView(std::span<const ValidatedSlot> slots)
+                : ValidatedView(slots.data(), slots.data() + slots.size()) {}
+
+            Iterator begin() const { return Iterator(m_first, m_last); }
+            Iterator end() const { return Iterator(m_last, m_last); }
+            size_t size() const { return static_cast<size_t>(m_last - m_first); }
+            std::span<const ValidatedSlot> Slots() const { return { m_first, size() }; }
+
+        private:
+            const ValidatedSlot* m_first;
+            const ValidatedSlot* m_last;
+        };
+
     private:
         void** m_rawArray;
         uint32_t m_capacity;
+        uint32_t m_count;
 
     public:
+        // Without a reported count, every slot may be occupied
         SafeGameArray(void* ptrArray, uint32_t capacity)
-            : m_rawArray(reinterpret_cast<void**>(ptrArray)), m_capacity(capacity) {
+            : SafeGameArray(ptrArray, capacity, capacity) {}
+
+        /**
+         * @param count Objects the game reports in the array (only bounds Validated(SlotOccupancy&))
+         */
+        SafeGameArray(void* ptrArray, uint32_t capacity, uint32_t count)
+            : m_rawArray(reinterpret_cast<void**>(ptrArray)), m_capacity(capacity), m_count(count) {
             if (!m_rawArray) {
                 m_capacity = 0;
+                m_count = 0;
             }
         }
 
+        void** GetRawArray() const { return m_rawArray; }
+        uint32_t GetCapacity() const { return m_capacity; }
+        uint32_t GetCount() const { return m_count; }
+
         Iterator begin() const {
             return Iterator(m_rawArray, 0, m_capacity);
         }
@@ -105,6 +252,30 @@ namespace SafeAccess {
         Iterator end() const {
             return Iterator(m_rawArray, m_capacity, m_capacity);
         }
+
+        /**
+         * @brief Batch-validate the whole array, then iterate only the valid objects
+         *
+         * Preferred over begin()/end() for full scans of large sparse arrays. Each object is
+         * adopted as already validated, so the wrappers cost no further probes in this pass.
+         * The view uses per-thread scratch storage for this wrapper type and is
+         * invalidated by the next Validated() call for the same type on this thread.
+         */
+        ValidatedView Validated() const {
+            static thread_local std::vector<ValidatedSlot> slots;
+            ValidateObjectArray(m_rawArray, m_capacity, slots);
+            return ValidatedView(slots);
+        }
+
+        /**
+         * @brief Same as Validated(), probing the slots occupied last pass first and stopping at GetCount()
+         *
+         * For lists walked every pass. The view lives in the tracker's storage and is invalidated
+         * by its next Validate() call (see SlotOccupancy).
+         */
+        ValidatedView Validated(SlotOccupancy& occupancy) const {
+            return ValidatedView(occupancy.Validate(m_rawArray, m_capacity, m_count));
+        }
     };
 
 } // namespace SafeAccess
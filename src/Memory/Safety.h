@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include "../Memory/AddressManager.h"
+#include "MemorySource.h"
+#include "PageProbeCache.h"
 
 namespace kx {
 namespace SafeAccess {
@@ -18,48 +22,41 @@ namespace SafeAccess {
     }
 
     // ---------------------------------------------------------
-    // HELPER 1: Safe Pointer Read
-    // Isolated in its own function to avoid C2712 errors.
+    // Fault-guarded raw reads of the live process.
+    // Implemented per platform (SafetyWin32.cpp: SEH; SafetyPosix.cpp:
+    // process_vm_readv), so callers stay free of __try/__except and
+    // this header of Windows.h.
     // ---------------------------------------------------------
-    inline bool SafeReadVTable(void* pObject, uintptr_t& outVTable) {
-        __try {
-            outVTable = *reinterpret_cast<uintptr_t*>(pObject);
-            return true;
-        }
-        __except (EXCEPTION_EXECUTE_HANDLER) {
-            return false;
-        }
-    }
 
-    // ---------------------------------------------------------
-    // HELPER 2: Memory Probe
-    // Isolated in its own function to avoid C2712 errors.
-    // ---------------------------------------------------------
-    inline bool ProbeMemory(void* ptr) {
-        __try {
-            volatile char c = *reinterpret_cast<volatile char*>(ptr);
-            (void)c;
-            return true;
-        }
-        __except (EXCEPTION_EXECUTE_HANDLER) {
-            return false;
-        }
-    }
+    /**
+     * @brief HELPER 1: Safe Pointer Read of an object's first pointer-sized value
+     */
+    bool SafeReadVTable(void* pObject, uintptr_t& outVTable);
 
-    // ---------------------------------------------------------
-    // HELPER 3: Safe Byte Read
-    // Isolated proxy for single-byte reads without C++ objects.
-    // Used by Scanner to avoid SEH/C++ destructor conflicts.
-    // ---------------------------------------------------------
-    inline bool RawSafeReadByte(uintptr_t address, unsigned char& outByte) {
-        __try {
-            outByte = *reinterpret_cast<unsigned char*>(address);
-            return true;
-        }
-        __except (EXCEPTION_EXECUTE_HANDLER) {
-            return false;
-        }
-    }
+    /**
+     * @brief HELPER 2: Memory Probe; true if the byte at ptr is readable
+     */
+    bool ProbeMemory(void* ptr);
+
+    /**
+     * @brief HELPER 3: Safe Byte Read. Used by Scanner to avoid SEH/C++ destructor conflicts.
+     */
+    bool RawSafeReadByte(uintptr_t address, unsigned char& outByte);
+
+    /**
+     * @brief HELPER 4: Safe Block Copy of a raw range (e.g. a whole page).
+     * Used by the MemorySource recording backend and Debug::SafeReadImpl.
+     */
+    bool RawSafeCopy(uintptr_t address, void* out, size_t size);
+
+    /**
+     * @brief HELPER 5: Batched VTable Read. Used by the SafeGameArray batch validator.
+     *
+     * Reads the VTable of every candidate inside one guarded region. On a fault it returns
+     * false with 'cursor' left on the faulting slot, so the caller can clear that slot and
+     * resume after it.
+     */
+    bool RawSafeReadVTables(void* const* candidates, uintptr_t* outVTables, uint32_t count, volatile uint32_t& cursor);
 
     // ---------------------------------------------------------
     // Main Safety Checks
@@ -67,11 +64,28 @@ namespace SafeAccess {
 
     /**
      * @brief The High-Performance Safety Check.
-     * RELIES ON /EHa (Async Exceptions) to catch crashes.
+     * Live probes go through ProbeMemory (SEH on Windows, /EHa).
      */
     inline bool IsMemorySafe(void* ptr) {
         if (!IsAddressInBounds(ptr)) return false;
-        return ProbeMemory(ptr);
+        if (!MemorySource::IsLive()) {
+            return MemorySource::IsReadable(reinterpret_cast<uintptr_t>(ptr));
+        }
+
+        // Inside an extraction pass, repeat probes of the same page are answered from the cache
+        PageProbeCache* cache = GetActiveProbeCache();
+        if (!cache) {
+            return ProbeMemory(ptr);
+        }
+        const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+        if (cache->Lookup(address)) {
+            return true;
+        }
+        if (!ProbeMemory(ptr)) {
+            return false;
+        }
+        cache->Insert(address);
+        return true;
     }
 
     /**
@@ -81,6 +95,9 @@ namespace SafeAccess {
     inline bool IsValidGameObject(void* pObject) {
         // 1. Fast sanity checks
         if (!IsAddressInBounds(pObject)) return false;
+        if (!MemorySource::IsLive()) {
+            return MemorySource::IsValidGameObject(reinterpret_cast<uintptr_t>(pObject));
+        }
 
         // 2. Get Module Info
         // Note: We moved the static vars out or rely on fast getters
@@ -91,6 +108,11 @@ namespace SafeAccess {
         // 3. Use the Helper for the dangerous read
         uintptr_t vtable = 0;
         if (SafeReadVTable(pObject, vtable)) {
+            // The read succeeded, so the page is readable for the rest of this pass
+            if (PageProbeCache* cache = GetActiveProbeCache()) {
+                cache->Insert(reinterpret_cast<uintptr_t>(pObject));
+            }
+
             // 4. Validate VTable range
             if (modBase > 0 && modSize > 0) {
                 return (vtable >= modBase && vtable < (modBase + modSize));
@@ -109,6 +131,9 @@ namespace SafeAccess {
         if (!pObject || !IsMemorySafe(pObject)) {
             return false;
         }
+        if (!MemorySource::IsLive()) {
+            return MemorySource::IsValidGameObject(reinterpret_cast<uintptr_t>(pObject));
+        }
 
         // Safely read the first pointer-sized value (VTable pointer) using helper
         uintptr_t vtablePtr = 0;
@@ -0,0 +1,52 @@
+#ifndef _WIN32
+
+#include <sys/uio.h>  // For process_vm_readv
+#include <unistd.h>   // For getpid
+#include "Safety.h"
+
+// There is no SEH here: every read goes through process_vm_readv on the own process, which
+// reports an unmapped or unreadable source range as an error instead of raising SIGSEGV.
+// Lets the extraction path and the Replay backend run headless (recorded scenes, tests).
+
+namespace kx {
+namespace SafeAccess {
+
+    bool RawSafeCopy(uintptr_t address, void* out, size_t size) {
+        if (size == 0) return true;
+        iovec local{ out, size };
+        iovec remote{ reinterpret_cast<void*>(address), size };
+        const ssize_t copied = process_vm_readv(getpid(), &local, 1, &remote, 1, 0);
+        return copied == static_cast<ssize_t>(size);
+    }
+
+    bool SafeReadVTable(void* pObject, uintptr_t& outVTable) {
+        return RawSafeCopy(reinterpret_cast<uintptr_t>(pObject), &outVTable, sizeof(outVTable));
+    }
+
+    bool ProbeMemory(void* ptr) {
+        unsigned char byte = 0;
+        return RawSafeCopy(reinterpret_cast<uintptr_t>(ptr), &byte, sizeof(byte));
+    }
+
+    bool RawSafeReadByte(uintptr_t address, unsigned char& outByte) {
+        return RawSafeCopy(address, &outByte, sizeof(outByte));
+    }
+
+    bool RawSafeReadVTables(void* const* candidates, uintptr_t* outVTables, uint32_t count, volatile uint32_t& cursor) {
+        for (; cursor < count; ++cursor) {
+            void* object = candidates[cursor];
+            if (!IsAddressInBounds(object)) {
+                outVTables[cursor] = 0;
+                continue;
+            }
+            if (!SafeReadVTable(object, outVTables[cursor])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace SafeAccess
+} // namespace kx
+
+#endif // !_WIN32
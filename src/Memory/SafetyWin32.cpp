@@ -0,0 +1,69 @@
+#ifdef _WIN32
+
+#include <windows.h> // For __try/__except
+#include <cstring>
+#include "Safety.h"
+
+// Each helper is isolated in its own function with no C++ objects to avoid C2712 errors.
+
+namespace kx {
+namespace SafeAccess {
+
+    bool SafeReadVTable(void* pObject, uintptr_t& outVTable) {
+        __try {
+            outVTable = *reinterpret_cast<uintptr_t*>(pObject);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER) {
+            return false;
+        }
+    }
+
+    bool ProbeMemory(void* ptr) {
+        __try {
+            volatile char c = *reinterpret_cast<volatile char*>(ptr);
+            (void)c;
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER) {
+            return false;
+        }
+    }
+
+    bool RawSafeReadByte(uintptr_t address, unsigned char& outByte) {
+        __try {
+            outByte = *reinterpret_cast<unsigned char*>(address);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER) {
+            return false;
+        }
+    }
+
+    bool RawSafeCopy(uintptr_t address, void* out, size_t size) {
+        __try {
+            std::memcpy(out, reinterpret_cast<const void*>(address), size);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER) {
+            return false;
+        }
+    }
+
+    bool RawSafeReadVTables(void* const* candidates, uintptr_t* outVTables, uint32_t count, volatile uint32_t& cursor) {
+        __try {
+            for (; cursor < count; ++cursor) {
+                void* object = candidates[cursor];
+                outVTables[cursor] = IsAddressInBounds(object) ? *reinterpret_cast<const uintptr_t*>(object) : 0;
+            }
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER) {
+            return false;
+        }
+    }
+
+} // namespace SafeAccess
+} // namespace kx
+
+#endif // _WIN32
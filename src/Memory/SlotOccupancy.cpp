@@ -0,0 +1,160 @@
+#include "SlotOccupancy.h"
+#include <algorithm>
+#include <bit>
+#include "AddressManager.h"
+#include "MemorySource.h"
+#include "PointerArrayDiff.h"
+#include "Safety.h"
+
+namespace kx {
+namespace SafeAccess {
+
+namespace {
+
+    constexpr uint32_t WORD_BITS = 64;
+
+    uint32_t WordCount(uint32_t capacity) {
+        return (capacity + WORD_BITS - 1) / WORD_BITS;
+    }
+
+    // Bits of `word` that lie inside the array; the last word may be partial
+    uint64_t SlotMask(uint32_t word, uint32_t capacity) {
+        const uint32_t slots = capacity - word * WORD_BITS;
+        return slots >= WORD_BITS ? ~0ull : (1ull << slots) - 1;
+    }
+
+} // namespace
+
+std::span<const ValidatedSlot> SlotOccupancy::Validate(void** array, uint32_t capacity, uint32_t count) {
+    m_stats = Stats{};
+    m_slots.clear();
+    if (!array || capacity == 0) {
+        Clear();
+        return {};
+    }
+
+    if (!CopyPointerArray(array, capacity, m_candidates)) {
+        Clear();
+        return {};
+    }
+
+    // A reallocated list keeps nothing at its old slot indices
+    if (array != m_array || capacity != m_capacity) {
+        m_array = array;
+        m_capacity = capacity;
+        m_occupied.assign(WordCount(capacity), 0);
+        m_passesSinceRescan = RESCAN_INTERVAL;
+    }
+
+    const bool rescan = !m_countTrusted || ++m_passesSinceRescan >= RESCAN_INTERVAL;
+    if (rescan) {
+        m_passesSinceRescan = 0;
+    }
+    m_stats.capacity = capacity;
+    m_stats.rescanned = true;
+
+    // Slots occupied last pass: one batch, they are the likeliest to hold this pass's objects
+    const uint32_t words = WordCount(capacity);
+    for (uint32_t word = 0; word < words; ++word) {
+        Gather(word, m_occupied[word]);
+    }
+    ProbeGathered();
+    const size_t firstPhase = m_slots.size();
+
+    // The rest in array order, a word at a time, until the reported count is reached
+    for (uint32_t word = 0; word < words; ++word) {
+        if (!rescan && m_slots.size() >= count) {
+            m_stats.rescanned = false;
+            break;
+        }
+        Gather(word, ~m_occupied[word] & SlotMask(word, capacity));
+        ProbeGathered();
+    }
+
+    // Both phases are in array order on their own
+    std::inplace_merge(m_slots.begin(), m_slots.begin() + firstPhase, m_slots.end(),
+        [](const ValidatedSlot& a, const ValidatedSlot& b) { return a.index < b.index; });
+
+    std::fill(m_occupied.begin(), m_occupied.end(), 0);
+    for (const ValidatedSlot& slot : m_slots) {
+        m_occupied[slot.index / WORD_BITS] |= 1ull << (slot.index % WORD_BITS);
+    }
+
+    m_stats.found = static_cast<uint32_t>(m_slots.size());
+    if (m_slots.size() > count) {
+        m_countTrusted = false; // Early termination would drop objects on this array
+        m_cleanPasses = 0;
+    } else if (!m_countTrusted && ++m_cleanPasses >= RETRUST_PASSES) {
+        m_countTrusted = true; // Distrusted passes probe every slot, so these passes were exact
+        m_cleanPasses = 0;
+    }
+    return m_slots;
+}
+
+void SlotOccupancy::Gather(uint32_t word, uint64_t bits) {
+    m_stats.probed += static_cast<uint32_t>(std::popcount(bits));
+    while (bits) {
+        const uint32_t index = word * WORD_BITS + static_cast<uint32_t>(std::countr_zero(bits));
+        bits &= bits - 1;
+        if (m_candidates[index]) {
+            m_gathered.push_back(m_candidates[index]);
+            m_gatheredIndices.push_back(index);
+        }
+    }
+}
+
+void SlotOccupancy::ProbeGathered() {
+    const uint32_t gathered = static_cast<uint32_t>(m_gathered.size());
+    if (gathered == 0) {
+        return;
+    }
+
+    if (MemorySource::IsLive()) {
+        const uintptr_t moduleBase = AddressManager::GetModuleBase();
+        const uintptr_t moduleSize = AddressManager::GetModuleSize();
+        if (moduleBase != 0 && moduleSize != 0) {
+            m_vtables.resize(gathered);
+            volatile uint32_t cursor = 0;
+            while (!RawSafeReadVTables(m_gathered.data(), m_vtables.data(), gathered, cursor)) {
+                m_vtables[cursor] = 0; // Unreadable object, skip it and continue with the next slot
+                cursor = cursor + 1;
+            }
+
+            PageProbeCache* cache = GetActiveProbeCache();
+            for (uint32_t i = 0; i < gathered; ++i) {
+                const uintptr_t vtable = m_vtables[i];
+                if (vtable >= moduleBase && vtable < moduleBase + moduleSize) {
+                    m_slots.push_back({ m_gatheredIndices[i], m_gathered[i], vtable });
+                    if (cache) cache->Insert(reinterpret_cast<uintptr_t>(m_gathered[i]));
+                }
+            }
+        }
+    } else {
+        // Recorded/replayed memory: per-slot checks through the memory source
+        for (uint32_t i = 0; i < gathered; ++i) {
+            void* candidate = m_gathered[i];
+            if (IsAddressInBounds(candidate) &&
+                MemorySource::IsValidGameObject(reinterpret_cast<uintptr_t>(candidate))) {
+                m_slots.push_back({ m_gatheredIndices[i], candidate, MemorySource::Read<uintptr_t>(reinterpret_cast<uintptr_t>(candidate), 0) });
+            }
+        }
+    }
+
+    m_gathered.clear();
+    m_gatheredIndices.clear();
+}
+
+void SlotOccupancy::Clear() {
+    m_occupied.clear();
+    m_candidates.clear();
+    m_slots.clear();
+    m_array = nullptr;
+    m_capacity = 0;
+    m_passesSinceRescan = 0;
+    m_cleanPasses = 0;
+    m_countTrusted = true;
+    m_stats = Stats{};
+}
+
+} // namespace SafeAccess
+} // namespace kx
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "ValidatedSlot.h"
+
+namespace kx {
+namespace SafeAccess {
+
+    /**
+     * @brief Remembers which slots of one sparse game pointer array held valid objects last pass
+     *
+     * The game's entity lists are sized for the zone, not for what is loaded: a 2048-slot
+     * character list may hold 40 characters. Instead of validating every slot like
+     * ValidateObjectArray(), the slots occupied last pass are probed first, then the rest in
+     * array order until the game-reported count is satisfied. Every RESCAN_INTERVAL passes the
+     * whole remainder is probed regardless, which catches objects a freed-but-intact slot would
+     * hide. If a pass finds more objects than the reported count, the count is not trusted and
+     * every pass probes the whole array, until RETRUST_PASSES passes in a row stay within it.
+     *
+     * The pointer array is still copied with one guarded copy (CopyPointerArray()); only the
+     * VTable reads are skipped.
+     * Owned by the thread running the pass (see ExtractionContext). Cleared on map change
+     * (ExtractionContext::ClearMapState()), which also forgets a distrusted count.
+     */
+    class SlotOccupancy {
+    public:
+        // Passes between full probes of the slots that were empty last pass
+        static constexpr uint32_t RESCAN_INTERVAL = 30;
+        // Full passes within the reported count before a distrusted count is trusted again
+        static constexpr uint32_t RETRUST_PASSES = 4 * RESCAN_INTERVAL;
+
+        struct Stats {
+            uint32_t capacity = 0;  // Slots of the array this pass
+            uint32_t probed = 0;    // Slots examined this pass (null slots included)
+            uint32_t found = 0;     // Of which held a valid object
+            bool rescanned = false; // Every slot was examined this pass
+        };
+
+        SlotOccupancy() = default;
+
+        /**
+         * @brief Validate the array, probing last pass's occupied slots first
+         * @param array The game's sparse pointer array
+         * @param capacity Number of slots in the array
+         * @param count Number of objects the game reports in the array; probing stops once reached
+         * @return The validated slots in array order; valid until the next Validate() or Clear()
+         */
+        std::span<const ValidatedSlot> Validate(void** array, uint32_t capacity, uint32_t count);
+
+        [[nodiscard]] const Stats& GetStats() const { return m_stats; }
+
+        /**
+         * @brief False after a pass found more objects than the game reported, until RETRUST_PASSES clean passes
+         */
+        [[nodiscard]] bool IsCountTrusted() const { return m_countTrusted; }
+
+        /**
+         * @brief Forget the occupancy, the count distrust and the stats (e.g., on map change)
+         */
+        void Clear();
+
+    private:
+        // Validates the gathered slots, appending the valid ones to m_slots
+        void ProbeGathered();
+        // Queues the non-null slots of bitmap word `word` selected by `bits` for ProbeGathered()
+        void Gather(uint32_t word, uint64_t bits);
+
+        std::vector<uint64_t> m_occupied;         // Bit per slot: held a valid object last pass
+        std::vector<void*> m_candidates;          // This pass's copy of the pointer array
+        std::vector<void*> m_gathered;            // Non-null candidates queued for one guarded VTable read
+        std::vector<uint32_t> m_gatheredIndices;
+        std::vector<uintptr_t> m_vtables;
+        std::vector<ValidatedSlot> m_slots;
+        void** m_array = nullptr;
+        uint32_t m_capacity = 0;
+        uint32_t m_passesSinceRescan = 0;
+        uint32_t m_cleanPasses = 0;     // Passes within the count since it was distrusted
+        bool m_countTrusted = true;
+        Stats m_stats;
+    };
+
+} // namespace SafeAccess
+} // namespace kx
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kx {
+namespace SafeAccess {
+
+    /**
+     * @brief One entry of a batch-validated game pointer array
+     */
+    struct ValidatedSlot {
+        uint32_t index;   // Position in the source array
+        void* object;     // Object pointer whose VTable lies inside the game module
+        uintptr_t vtable;
+    };
+
+} // namespace SafeAccess
+} // namespace kx
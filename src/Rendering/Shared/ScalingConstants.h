@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace kx {
 
 /**
@@ -37,6 +39,18 @@ namespace AdaptiveScaling {
     constexpr float PLAYER_NPC_MIN_ALPHA = 0.5f;     // 50% minimum (higher than gadgets for combat clarity)
 }
 
+/**
+ * @brief Fade of entities kept stale by distance LOD
+ *
+ * Round-robin refreshes are usually quicker than FADE_START_MS, so only entities that
+ * have gone unread for a while (dense maps) fade, and they never flicker per pass.
+ */
+namespace StaleFade {
+    constexpr uint32_t FADE_START_MS = 300;  // Stale values younger than this are drawn as-is
+    constexpr uint32_t FADE_END_MS = 2000;   // Age at which MIN_ALPHA is reached
+    constexpr float MIN_ALPHA = 0.4f;        // Never fade out completely: the entity is still there
+}
+
 /**
  * @brief Scaling limits for ESP elements
  * 
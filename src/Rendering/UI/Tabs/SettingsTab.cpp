@@ -15,7 +15,11 @@
 #include "SDK/GadgetStructs.h"
 #include "../../../Memory/SafeGameArray.h"
 #include "../../../Features/Visuals/Presentation/Formatting.h"
+#include "../../../Game/Extraction/ExtractionLod.h"
+#include "../../../Game/Extraction/ExtractionScheduler.h"
 #include "../../../Memory/AddressManager.h"
+#include "../../../Core/AppLifecycleManager.h"
+#include "../../../Core/AppState.h"
 
 namespace kx {
     namespace GUI {
@@ -500,6 +504,145 @@ namespace kx {
             }
         }
         
+        void RenderExtractionStats() {
+            const FrameDataHandle frameData = g_App.GetEntityManager().AcquireFrameData();
+            const ExtractionStats& stats = frameData->stats;
+
+            const size_t entityCount = frameData->players.size() + frameData->npcs.size() +
+                frameData->gadgets.size() + frameData->attackTargets.size() + frameData->items.size();
+            const uint32_t probes = stats.probeCacheHits + stats.probeCacheMisses;
+            const float hitRate = probes > 0 ? 100.0f * stats.probeCacheHits / probes : 0.0f;
+            const float probesPerEntity = entityCount > 0 ? static_cast<float>(probes) / entityCount : 0.0f;
+            ImGui::Text("Probe Cache: %u hits / %u misses (%.1f%%), %.1f probes per entity",
+                stats.probeCacheHits, stats.probeCacheMisses, hitRate, probesPerEntity);
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Memory probes during the last extraction pass.\nHits are repeat probes of a page already proven readable in the same pass.\nWrappers copied within a pass carry their validation and are not probed again.");
+            }
+
+            ImGui::Text("Extraction: %.2f ms on %u thread%s (%.2f ms resolving lists), %zu entities",
+                stats.extractionMicros / 1000.0f, stats.extractionThreads,
+                stats.extractionThreads == 1 ? "" : "s", stats.resolveMicros / 1000.0f, entityCount);
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Wall time of the last extraction pass.\nUnless decoded in the background, the game thread waits for this long on every ESP update.\nResolving lists: validating the entity lists, walking the player roster and reclassifying items before any entity is read.");
+            }
+
+            const uint32_t shapeLookups = stats.shapeCacheHits + stats.shapeCacheMisses;
+            if (shapeLookups > 0 || stats.shapeWalksSavedPerSecond > 0) {
+                ImGui::Text("Shape Cache: %u of %u shapes cached this pass, %u Havok walks saved per second",
+                    stats.shapeCacheHits, shapeLookups, stats.shapeWalksSavedPerSecond);
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Collision shape dimensions reused from earlier passes instead of walking the Havok shape chain.\nCleared on map change.");
+                }
+            }
+
+            if (stats.pinnedSlots > 0 || stats.skippedPasses > 0) {
+                ImGui::Text("Frames: %u retired frame%s pinned by readers, %u passes skipped",
+                    stats.pinnedSlots, stats.pinnedSlots == 1 ? "" : "s", stats.skippedPasses);
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Frames are only recycled once no reader holds them.\nPasses are skipped when readers hold every spare frame.");
+                }
+            }
+
+            ImGui::Text("Agents: %u indexed, %u spawned / %u despawned this pass",
+                stats.liveAgents, stats.spawnedAgents, stats.despawnedAgents);
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Agent slot table: agentId lookups are a direct index.\nA slot only changes when its agent spawns or despawns.");
+            }
+
+            if (stats.rosterPlayers > 0) {
+                ImGui::Text("Roster: %u players, %u names converted this pass", stats.rosterPlayers, stats.namesTranscoded);
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Player names are converted to UTF-8 once, when the player shows up in the player list.");
+                }
+            }
+
+            if (stats.slotCapacity > 0) {
+                ImGui::Text("Entity Lists: %u of %u slots probed this pass", stats.slotsProbed, stats.slotCapacity);
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("The character, gadget and attack target lists are sized for the zone and mostly empty.\nSlots that held an object last pass are probed first; probing stops at the count the game reports.\nThe rest is probed every %u passes.", SafeAccess::SlotOccupancy::RESCAN_INTERVAL);
+                }
+            }
+
+            if (stats.itemListSize > 0) {
+                ImGui::Text("Items: %u on the ground of %u listed, %u reclassified this pass",
+                    stats.groundItems, stats.itemListSize, stats.itemsReclassified);
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("The item list also holds every equipped and bagged item of every loaded character.\nOnly slots that changed since the last pass are classified again; only ground items are extracted.");
+                }
+            }
+
+            if (stats.staticGadgets > 0) {
+                ImGui::Text("Static Gadgets: %u cached for this map, %u reused this pass", stats.staticGadgets, stats.staticGadgetHits);
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Waypoints, vistas, crafting stations and resource nodes never move within a map.\nTheir position and shape are read once; later passes only check that they are still there.\nCleared on map change.");
+                }
+            }
+
+            if (stats.staleEntities > 0) {
+                ImGui::Text("Distance LOD: %u of %zu entities kept from earlier passes", stats.staleEntities, entityCount);
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Mid and far entities that were outside this pass's round-robin slice.\nThey keep their last values and fade out the longer they go without a refresh.");
+                }
+            }
+
+            if (stats.budgetMicros > 0) {
+                ImGui::Text("Budget: %.2f of %.2f ms decoding (game frame %u ms), %u deferred, sweep %u ms over %u pass%s",
+                    (stats.extractionMicros - std::min(stats.resolveMicros, stats.extractionMicros)) / 1000.0f,
+                    stats.budgetMicros / 1000.0f, stats.gameFrameMs,
+                    stats.deferredEntities, stats.sweepLatencyMs, stats.sweepPasses, stats.sweepPasses == 1 ? "" : "es");
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("The budget covers decoding only: resolving the lists comes first and always runs in full.\nDeferred entities were not reached before the budget ran out and kept their last values.\nSweep: time the slowest category last took to refresh every one of its entities.");
+                }
+            }
+
+            if (stats.stagedPages > 0) {
+                ImGui::Text("Capture: %.2f ms on game thread, %u pages staged (%u new entities), %u missing (%u entities kept)",
+                    stats.captureMicros / 1000.0f, stats.stagedPages, stats.primedEntities, stats.missingPages, stats.missedEntities);
+                if (ImGui::IsItemHovered()) {
+                    ImGui::SetTooltip("Background decode: the game thread copies the pages the previous decode read, and reads entities that just appeared in full.\nMissing pages were first needed this pass: entities behind them keep their last values until the next capture copies them.");
+                }
+            }
+        }
+
+#ifdef _DEBUG
+        void RenderExtractionSnapshotControls() {
+            ImGui::Separator();
+            ImGui::Text("Extraction Snapshot");
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Record the memory touched by one extraction pass to a file,\nthen replay extraction against it for repeatable timings.");
+            }
+
+            static char snapshotPath[MAX_PATH] = {};
+            if (snapshotPath[0] == '\0') {
+                auto defaultPath = SettingsManager::GetConfigDirectory() / "snapshots" / "scene.kxmi";
+                strncpy_s(snapshotPath, defaultPath.u8string().c_str(), _TRUNCATE);
+            }
+            static int replayIterations = 100;
+
+            ImGui::PushItemWidth(-1.0f);
+            ImGui::InputText("##SnapshotPath", snapshotPath, sizeof(snapshotPath));
+            ImGui::PopItemWidth();
+            ImGui::SliderInt("Replay Iterations", &replayIterations, 1, 1000);
+
+            EntityManager& entityManager = g_App.GetEntityManager();
+            if (ImGui::Button("Capture Snapshot")) {
+                std::filesystem::path path = std::filesystem::u8path(snapshotPath);
+                std::error_code ec;
+                std::filesystem::create_directories(path.parent_path(), ec);
+                entityManager.RequestSnapshotCapture(path);
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Replay Benchmark")) {
+                entityManager.RequestSnapshotReplay(std::filesystem::u8path(snapshotPath), static_cast<uint32_t>(replayIterations));
+            }
+
+            const std::string status = entityManager.GetSnapshotStatus();
+            if (!status.empty()) {
+                ImGui::TextWrapped("%s", status.c_str());
+            }
+        }
+#endif
+
         void RenderSettingsTab() {
             if (ImGui::BeginTabItem("Settings")) {
                 auto& settings = AppState::Get().GetSettings();
@@ -549,12 +692,64 @@ namespace kx {
                 
                 // Performance Settings
                 if (ImGui::CollapsingHeader("Performance", ImGuiTreeNodeFlags_DefaultOpen)) {
-                    ImGui::SliderFloat("ESP Update Rate", &settings.espUpdateRate, 30.0f, 360.0f, "%.0f FPS");
+                    ImGui::Text("Update Rates");
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("(?)");
+                    if (ImGui::IsItemHovered()) {
+                        ImGui::SetTooltip("How often each kind of entity is re-read from game memory.\nLower values improve performance but make that category less responsive.\nPlayers: 60-120 Hz for smooth tracking, up to 360 Hz for high refresh displays.\nGadgets and ground items rarely move; low rates are barely noticeable.");
+                    }
+                    const float minRate = ExtractionScheduler::MIN_RATE;
+                    const float maxRate = ExtractionScheduler::MAX_RATE;
+                    ImGui::SliderFloat("Players##Rate", &settings.extraction.playerRate, minRate, maxRate, "%.0f Hz");
+                    ImGui::SliderFloat("NPCs##Rate", &settings.extraction.npcRate, minRate, maxRate, "%.0f Hz");
+                    ImGui::SliderFloat("Gadgets##Rate", &settings.extraction.gadgetRate, minRate, maxRate, "%.0f Hz");
+                    ImGui::SliderFloat("Attack Targets##Rate", &settings.extraction.attackTargetRate, minRate, maxRate, "%.0f Hz");
+                    ImGui::SliderFloat("Ground Items##Rate", &settings.extraction.itemRate, minRate, maxRate, "%.0f Hz");
+
+                    ImGui::Checkbox("Distance Level of Detail", &settings.extraction.distanceLod);
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("(?)");
+                    if (ImGui::IsItemHovered()) {
+                        ImGui::SetTooltip("Entities closer than %.0fm are read on every update. Farther NPCs, objects and items\nare read a fixed number at a time, keeping their last values in between.\nKeeps the update cost flat in crowded maps. Players are always read in full.",
+                            ExtractionLod::NEAR_DISTANCE);
+                    }
+
+                    ImGui::Checkbox("Time Budget", &settings.extraction.timeBudget);
                     ImGui::SameLine();
                     ImGui::TextDisabled("(?)");
                     if (ImGui::IsItemHovered()) {
-                        ImGui::SetTooltip("Lower values improve performance but make ESP less responsive.\nRecommended: 60-120 FPS for good balance, up to 360 FPS for high refresh displays.");
+                        ImGui::SetTooltip("Stop each update once decoding entities has taken this long and continue where it left off on the next one.\nEntities not reached keep their last values. Caps the game thread stall at the cost of\nslower full refreshes; compare the sweep time below with the game's frame time.\nValidating the entity lists and walking the player roster come first and are not cut short.\nHas no effect with background decode.");
                     }
+                    if (settings.extraction.timeBudget) {
+                        ImGui::SliderInt("Budget##Extraction", &settings.extraction.budgetMicros,
+                            ExtractionSettings::MIN_BUDGET_MICROS, ExtractionSettings::MAX_BUDGET_MICROS, "%d us");
+                    }
+
+                    ImGui::SliderInt("Prefetch Distance", &settings.extraction.prefetchDistance, 0, ExtractionSettings::MAX_PREFETCH_DISTANCE);
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("(?)");
+                    if (ImGui::IsItemHovered()) {
+                        ImGui::SetTooltip("While one character or object is read, request the memory of the next ones ahead of time.\nHides cache misses on the game's heap; 0 turns it off. 4-8 suits most CPUs.");
+                    }
+
+                    ImGui::Checkbox("Parallel Extraction", &settings.extraction.parallelExtraction);
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("(?)");
+                    if (ImGui::IsItemHovered()) {
+                        ImGui::SetTooltip("Split each extraction pass across worker threads.\nShortens the game thread stall in crowded areas (WvW zergs, meta events)\nat the cost of extra CPU. Compare the extraction time below with it on and off.");
+                    }
+                    if (settings.extraction.parallelExtraction) {
+                        ImGui::SliderInt("Worker Threads", &settings.extraction.workerThreads, 1, ExtractionSettings::MAX_WORKER_THREADS);
+                    }
+
+                    ImGui::Checkbox("Background Decode", &settings.extraction.backgroundDecode);
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("(?)");
+                    if (ImGui::IsItemHovered()) {
+                        ImGui::SetTooltip("The game thread only copies raw memory pages; entities are decoded on a background thread.\nNearly removes the game thread stall, at the cost of one update of latency.\nParallel extraction does not apply while this is on.");
+                    }
+
+                    RenderExtractionStats();
                 }
                 
                 // Debug Settings
@@ -726,6 +921,8 @@ namespace kx {
                     } else {
                         ImGui::Text("ContextCollection not available.");
                     }
+
+                    RenderExtractionSnapshotControls();
                 }
 #endif
                 ImGui::EndTabItem();
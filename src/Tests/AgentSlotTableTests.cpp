@@ -0,0 +1,121 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Game/Extraction/AgentSlotTable.h"
+#include "IdentityAddress.h"
+
+namespace {
+
+    const void* const WRAPPER_A = kx::Testing::IdentityAddress(1);
+    const void* const WRAPPER_B = kx::Testing::IdentityAddress(2);
+
+} // namespace
+
+SCENARIO("Agent slots keep their generation while the agent stays in the frame", "[AgentSlots]")
+{
+    GIVEN("A table where agent 7 spawned") {
+        kx::AgentSlotTable table;
+        table.BeginPass();
+        const kx::EntityHandle first = table.Touch(7, WRAPPER_A);
+        table.Sweep();
+
+        REQUIRE(first.IsValid());
+        CHECK(first.agentId == 7);
+        CHECK(table.GetStats().spawned == 1);
+        CHECK(table.LiveCount() == 1);
+
+        WHEN("The agent is seen again by the same wrapper") {
+            table.BeginPass();
+            const kx::EntityHandle again = table.Touch(7, WRAPPER_A);
+            table.Sweep();
+
+            THEN("The handle and the table are unchanged") {
+                CHECK(again == first);
+                CHECK(table.GetStats().spawned == 0);
+                CHECK(table.GetStats().despawned == 0);
+                CHECK(table.Find(7) == first);
+            }
+        }
+
+        WHEN("A pass does not contain the agent") {
+            table.BeginPass();
+            table.Sweep();
+
+            THEN("It despawns and a later spawn gets a new generation") {
+                CHECK(table.GetStats().despawned == 1);
+                CHECK_FALSE(table.Find(7).IsValid());
+
+                table.BeginPass();
+                const kx::EntityHandle respawned = table.Touch(7, WRAPPER_A);
+                CHECK(respawned.IsValid());
+                CHECK(respawned.generation != first.generation);
+            }
+        }
+
+        WHEN("Another wrapper shows up under the same id") {
+            table.BeginPass();
+            const kx::EntityHandle reused = table.Touch(7, WRAPPER_B);
+            table.Sweep();
+
+            THEN("The old handle goes stale") {
+                CHECK(reused.generation != first.generation);
+                CHECK(table.GetStats().spawned == 1);
+                CHECK(table.GetStats().despawned == 1);
+                CHECK(table.LiveCount() == 1);
+            }
+        }
+
+        WHEN("Two wrappers claim the id in the same pass") {
+            table.BeginPass();
+            const kx::EntityHandle kept = table.Touch(7, WRAPPER_A);
+            const kx::EntityHandle duplicate = table.Touch(7, WRAPPER_B);
+
+            THEN("The first keeps the slot and the second gets a null handle") {
+                CHECK(kept == first);
+                CHECK_FALSE(duplicate.IsValid());
+            }
+        }
+
+        WHEN("The table is cleared") {
+            table.Clear();
+
+            THEN("Nothing is live and the next spawn does not revive old handles") {
+                CHECK(table.LiveCount() == 0);
+                table.BeginPass();
+                CHECK(table.Touch(7, WRAPPER_A).generation != first.generation);
+            }
+        }
+    }
+
+    GIVEN("Ids the table does not index") {
+        kx::AgentSlotTable table;
+        table.BeginPass();
+
+        THEN("They get null handles") {
+            CHECK_FALSE(table.Touch(0, WRAPPER_A).IsValid());
+            CHECK_FALSE(table.Touch(-3, WRAPPER_A).IsValid());
+            CHECK_FALSE(table.Touch(static_cast<int32_t>(kx::AgentSlotTable::MAX_AGENT_ID), WRAPPER_A).IsValid());
+            CHECK(table.LiveCount() == 0);
+        }
+    }
+}
+
+SCENARIO("Sweeping despawns only the agents missing from the pass", "[AgentSlots]")
+{
+    kx::AgentSlotTable table;
+    table.BeginPass();
+    for (int32_t id = 1; id <= 100; ++id) {
+        table.Touch(id, reinterpret_cast<const void*>(static_cast<uintptr_t>(id) << 8));
+    }
+    table.Sweep();
+    REQUIRE(table.LiveCount() == 100);
+
+    table.BeginPass();
+    for (int32_t id = 2; id <= 100; id += 2) {
+        table.Touch(id, reinterpret_cast<const void*>(static_cast<uintptr_t>(id) << 8));
+    }
+    CHECK(table.Sweep() == 50);
+    CHECK(table.LiveCount() == 50);
+    for (uint32_t id = 1; id <= 100; ++id) {
+        CHECK(table.Find(id).IsValid() == (id % 2 == 0));
+    }
+}
@@ -0,0 +1,91 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Game/Data/FrameData.h"
+#include "../Game/Data/EntityData.h"
+
+SCENARIO("Entity columns mirror the typed lists of a frame, grouped by type", "[EntityColumns]")
+{
+    GIVEN("A frame with a hostile player, an invalid NPC, a valid NPC and a gadget with physics dimensions") {
+        kx::PlayerEntity player;
+        player.entityType = kx::EntityTypes::Player;
+        player.isValid = true;
+        player.position = { 1.0f, 2.0f, 3.0f };
+        player.currentHealth = 50.0f;
+        player.maxHealth = 100.0f;
+        player.attitude = kx::Game::Attitude::Hostile;
+
+        kx::NpcEntity deadSlot;
+        deadSlot.entityType = kx::EntityTypes::NPC;
+        deadSlot.isValid = false;
+
+        kx::NpcEntity npc;
+        npc.entityType = kx::EntityTypes::NPC;
+        npc.isValid = true;
+        npc.attitude = kx::Game::Attitude::Friendly;
+        npc.isStale = true;
+        npc.staleMs = 40;
+
+        kx::GadgetEntity gadget;
+        gadget.entityType = kx::EntityTypes::Gadget;
+        gadget.isValid = true;
+        gadget.hasPhysicsDimensions = true;
+        gadget.physicsWidth = 1.0f;
+        gadget.physicsDepth = 2.0f;
+        gadget.physicsHeight = 4.0f;
+
+        kx::FrameGameData frame;
+        frame.players = { &player };
+        frame.npcs = { &deadSlot, &npc };
+        frame.gadgets = { &gadget };
+        frame.columns.Build(frame);
+        const kx::EntityColumns& columns = frame.columns;
+
+        THEN("Invalid entities are skipped and every column has one slot per kept entity") {
+            REQUIRE(columns.Size() == 3);
+            CHECK(columns.position.size() == 3);
+            CHECK(columns.attitude.size() == 3);
+            CHECK(columns.physicsSize.size() == 3);
+            CHECK(columns.entity[1] == &npc);
+        }
+
+        THEN("Each type's slots form one contiguous range") {
+            CHECK(columns.GetRange(kx::EntityTypes::Player).begin == 0);
+            CHECK(columns.GetRange(kx::EntityTypes::Player).end == 1);
+            CHECK(columns.GetRange(kx::EntityTypes::NPC).begin == 1);
+            CHECK(columns.GetRange(kx::EntityTypes::NPC).end == 2);
+            CHECK(columns.GetRange(kx::EntityTypes::Gadget).begin == 2);
+            CHECK(columns.GetRange(kx::EntityTypes::Gadget).end == 3);
+            CHECK(columns.GetRange(kx::EntityTypes::Item).begin == columns.GetRange(kx::EntityTypes::Item).end);
+        }
+
+        THEN("Hot columns carry the values the render passes read") {
+            CHECK(columns.position[0] == glm::vec3(1.0f, 2.0f, 3.0f));
+            CHECK(columns.currentHealth[0] == 50.0f);
+            CHECK(columns.attitude[0] == kx::Game::Attitude::Hostile);
+            CHECK(columns.attitude[1] == kx::Game::Attitude::Friendly);
+            CHECK(columns.attitude[2] == kx::Game::Attitude::Neutral);
+            CHECK(columns.staleMs[0] == 0);
+            CHECK(columns.staleMs[1] == 40);
+            CHECK(columns.physicsSize[0] == glm::vec3(0.0f));
+            CHECK(columns.physicsSize[2] == glm::vec3(1.0f, 2.0f, 4.0f));
+        }
+
+        WHEN("A filter copies only the gadget into another frame") {
+            kx::EntityColumns filtered;
+            filtered.BeginRange(kx::EntityTypes::Player);
+            filtered.BeginRange(kx::EntityTypes::NPC);
+            filtered.BeginRange(kx::EntityTypes::Gadget);
+            filtered.AppendFrom(columns, 2, 10.0f, 12.0f);
+
+            THEN("The copy lands in the gadget range with its distances") {
+                REQUIRE(filtered.Size() == 1);
+                CHECK(filtered.GetRange(kx::EntityTypes::NPC).end == 0);
+                CHECK(filtered.GetRange(kx::EntityTypes::Gadget).begin == 0);
+                CHECK(filtered.GetRange(kx::EntityTypes::Gadget).end == 1);
+                CHECK(filtered.visualDistance[0] == 10.0f);
+                CHECK(filtered.gameplayDistance[0] == 12.0f);
+                CHECK(filtered.entity[0] == &gadget);
+            }
+        }
+    }
+}
@@ -0,0 +1,114 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include <vector>
+#include "../Game/Extraction/EntityEventDiff.h"
+#include "IdentityAddress.h"
+
+using kx::EntityEventKind;
+using kx::EntityTypes;
+using kx::Testing::IdentityAddress;
+
+namespace {
+
+    size_t Count(const std::vector<kx::EntityEvent>& events, EntityEventKind kind) {
+        size_t count = 0;
+        for (const kx::EntityEvent& event : events) {
+            count += event.kind == kind ? 1 : 0;
+        }
+        return count;
+    }
+
+} // namespace
+
+SCENARIO("Entity events come from a merge of consecutive frames", "[EntityEvents]")
+{
+    GIVEN("A first frame with two players, an item and an address-only gadget") {
+        kx::EntityEventDiff diff;
+        std::vector<kx::EntityEvent> events;
+
+        diff.Add(30, IdentityAddress(3), EntityTypes::Item);
+        diff.Add(10, IdentityAddress(1), EntityTypes::Player);
+        diff.Add(20, IdentityAddress(2), EntityTypes::Player);
+        diff.Add(0, IdentityAddress(9), EntityTypes::Gadget);
+        diff.Diff(events);
+
+        THEN("Every entity is reported as spawned, in key order") {
+            REQUIRE(events.size() == 4);
+            CHECK(Count(events, EntityEventKind::Spawned) == 4);
+            CHECK(events[0].agentId == 0);
+            CHECK(events[1].agentId == 10);
+            CHECK(events[3].entityType == EntityTypes::Item);
+        }
+
+        WHEN("The next frame has the same entities, added in another order") {
+            diff.Add(20, IdentityAddress(2), EntityTypes::Player);
+            diff.Add(0, IdentityAddress(9), EntityTypes::Gadget);
+            diff.Add(30, IdentityAddress(3), EntityTypes::Item);
+            diff.Add(10, IdentityAddress(1), EntityTypes::Player);
+            diff.Diff(events);
+
+            THEN("There are no events") {
+                CHECK(events.empty());
+            }
+        }
+
+        WHEN("One player leaves, an NPC arrives and the item's agentId moves to a new address") {
+            diff.Add(10, IdentityAddress(1), EntityTypes::Player);
+            diff.Add(30, IdentityAddress(4), EntityTypes::Item);
+            diff.Add(40, IdentityAddress(5), EntityTypes::NPC);
+            diff.Add(0, IdentityAddress(9), EntityTypes::Gadget);
+            diff.Diff(events);
+
+            THEN("Only the three changes are reported") {
+                REQUIRE(events.size() == 3);
+                CHECK(events[0].kind == EntityEventKind::Despawned);
+                CHECK(events[0].agentId == 20);
+                CHECK(events[0].address == IdentityAddress(2));
+                CHECK(events[1].kind == EntityEventKind::Respawned);
+                CHECK(events[1].address == IdentityAddress(4));
+                CHECK(events[1].previousAddress == IdentityAddress(3));
+                CHECK(events[2].kind == EntityEventKind::Spawned);
+                CHECK(events[2].entityType == EntityTypes::NPC);
+            }
+        }
+
+        WHEN("An address-only entity moves to another address") {
+            diff.Add(10, IdentityAddress(1), EntityTypes::Player);
+            diff.Add(20, IdentityAddress(2), EntityTypes::Player);
+            diff.Add(30, IdentityAddress(3), EntityTypes::Item);
+            diff.Add(0, IdentityAddress(8), EntityTypes::Gadget);
+            diff.Diff(events);
+
+            THEN("It is a despawn and a spawn, since the address is its identity") {
+                REQUIRE(events.size() == 2);
+                CHECK(events[0].kind == EntityEventKind::Spawned);
+                CHECK(events[0].address == IdentityAddress(8));
+                CHECK(events[1].kind == EntityEventKind::Despawned);
+                CHECK(events[1].address == IdentityAddress(9));
+            }
+        }
+
+        WHEN("An agentId shows up twice in the same frame") {
+            diff.Add(10, IdentityAddress(1), EntityTypes::Player);
+            diff.Add(20, IdentityAddress(2), EntityTypes::Player);
+            diff.Add(30, IdentityAddress(3), EntityTypes::Item);
+            diff.Add(30, IdentityAddress(3), EntityTypes::Item);
+            diff.Add(0, IdentityAddress(9), EntityTypes::Gadget);
+            diff.Diff(events);
+
+            THEN("It counts once") {
+                CHECK(events.empty());
+                CHECK(diff.GetPreviousSize() == 4);
+            }
+        }
+
+        WHEN("The next frame is empty") {
+            diff.Diff(events);
+
+            THEN("Everything despawns") {
+                CHECK(Count(events, EntityEventKind::Despawned) == 4);
+                CHECK(diff.GetPreviousSize() == 0);
+            }
+        }
+    }
+}
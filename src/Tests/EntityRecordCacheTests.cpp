@@ -0,0 +1,138 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Game/Extraction/EntityRecordCache.h"
+#include "IdentityAddress.h"
+
+namespace {
+
+    const void* const CHARACTER_A = kx::Testing::IdentityAddress(1);
+    const void* const CHARACTER_B = kx::Testing::IdentityAddress(2);
+
+} // namespace
+
+SCENARIO("Entity records refresh their stable tier on a slow cadence", "[RecordCache]")
+{
+    GIVEN("A record cache with one player read at t=1000") {
+        kx::EntityRecordCache cache;
+        cache.BeginTick(1000);
+
+        kx::EntityRecord& record = cache.Touch(kx::CombatStateKey(42, CHARACTER_A), kx::EntityTypes::Player);
+        REQUIRE(cache.NeedsStableRefresh(record));
+        record.stable.level = 80;
+        cache.MarkStableRefreshed(record, 42);
+
+        THEN("The stable tier is reused until the refresh interval has passed") {
+            cache.BeginTick(1000 + kx::EntityRecordCache::STABLE_REFRESH_INTERVAL_MS - 1);
+            kx::EntityRecord& again = cache.Touch(kx::CombatStateKey(42, CHARACTER_A), kx::EntityTypes::Player);
+            CHECK_FALSE(cache.NeedsStableRefresh(again));
+            CHECK(again.stable.level == 80);
+
+            cache.BeginTick(1000 + kx::EntityRecordCache::STABLE_REFRESH_INTERVAL_MS +
+                kx::EntityRecordCache::STABLE_REFRESH_JITTER_MS);
+            CHECK(cache.NeedsStableRefresh(cache.Touch(kx::CombatStateKey(42, CHARACTER_A), kx::EntityTypes::Player)));
+        }
+
+        WHEN("The agentId is reused by a different character") {
+            cache.BeginTick(1100);
+            kx::EntityRecord& reused = cache.Touch(kx::CombatStateKey(42, CHARACTER_B), kx::EntityTypes::Player);
+
+            THEN("The record starts over instead of inheriting stale fields") {
+                CHECK(cache.NeedsStableRefresh(reused));
+                CHECK(reused.stable.level == 0);
+                CHECK(reused.address == CHARACTER_B);
+            }
+        }
+
+        WHEN("The same key turns up as a different entity type") {
+            cache.BeginTick(1100);
+            kx::EntityRecord& npc = cache.Touch(kx::CombatStateKey(42, CHARACTER_A), kx::EntityTypes::NPC);
+
+            THEN("The record is reset") {
+                CHECK(cache.NeedsStableRefresh(npc));
+            }
+        }
+
+        WHEN("The entity is not touched on the next tick") {
+            cache.BeginTick(1100);
+            cache.Touch(kx::CombatStateKey(7, CHARACTER_B), kx::EntityTypes::NPC);
+
+            THEN("Sweep drops only the missing record") {
+                CHECK(cache.Sweep() == 1);
+                CHECK(cache.Size() == 1);
+            }
+
+            THEN("A sweep limited to NPCs keeps the untouched player") {
+                CHECK(cache.Sweep(kx::EntityTypes::NPC) == 0);
+                CHECK(cache.Size() == 2);
+            }
+        }
+    }
+}
+
+TEST_CASE("Stable fields round-trip through a record", "[RecordCache]")
+{
+    kx::PlayerEntity source;
+    source.level = 80;
+    source.scaledLevel = 62;
+    source.profession = kx::Game::Profession::Guardian;
+    source.race = kx::Game::Race::Norn;
+    source.physicsHeight = 2.1f;
+    source.hasPhysicsDimensions = true;
+    source.AddGear(kx::Game::EquipmentSlot::Helm, { 123, 456, kx::Game::ItemRarity::Ascended });
+
+    kx::CharacterStableFields stable;
+    stable.CaptureFrom(source);
+
+    kx::PlayerEntity target;
+    stable.ApplyTo(target);
+
+    CHECK(target.level == 80);
+    CHECK(target.scaledLevel == 62);
+    CHECK(target.profession == kx::Game::Profession::Guardian);
+    CHECK(target.race == kx::Game::Race::Norn);
+    CHECK(target.physicsHeight == 2.1f);
+    CHECK(target.hasPhysicsDimensions);
+    REQUIRE(target.gearCount == 1);
+    REQUIRE(target.GetGearInfo(kx::Game::EquipmentSlot::Helm) != nullptr);
+    CHECK(target.GetGearInfo(kx::Game::EquipmentSlot::Helm)->itemId == 123);
+}
+
+TEST_CASE("Cached gear is reused while the slot fingerprint is unchanged", "[RecordCache]")
+{
+    kx::PlayerEntity decoded;
+    decoded.AddGear(kx::Game::EquipmentSlot::Helm, { 123, 456, kx::Game::ItemRarity::Ascended });
+
+    kx::CharacterStableFields stable;
+    REQUIRE_FALSE(stable.TryReuseGear(0xABCD, decoded)); // First refresh always decodes
+    stable.CaptureFrom(decoded);
+
+    kx::PlayerEntity next;
+    REQUIRE(stable.TryReuseGear(0xABCD, next));
+    REQUIRE(next.GetGearInfo(kx::Game::EquipmentSlot::Helm) != nullptr);
+    CHECK(next.GetGearInfo(kx::Game::EquipmentSlot::Helm)->statId == 456);
+
+    SECTION("A different fingerprint forces a decode") {
+        kx::PlayerEntity changed;
+        CHECK_FALSE(stable.TryReuseGear(0xBEEF, changed));
+        CHECK(changed.gearCount == 0);
+    }
+
+    SECTION("A matching fingerprint is trusted a bounded number of times in a row") {
+        for (int i = 1; i < kx::CharacterStableFields::MAX_GEAR_REUSES; ++i) {
+            kx::PlayerEntity reused;
+            REQUIRE(stable.TryReuseGear(0xABCD, reused));
+        }
+        kx::PlayerEntity revalidated;
+        CHECK_FALSE(stable.TryReuseGear(0xABCD, revalidated));
+    }
+
+    SECTION("A refresh that could not decode the gear is not reused") {
+        kx::PlayerEntity partial;
+        CHECK_FALSE(stable.TryReuseGear(0xBEEF, partial));
+        stable.ForgetGearFingerprint();
+        stable.CaptureFrom(partial);
+
+        kx::PlayerEntity next;
+        CHECK_FALSE(stable.TryReuseGear(0xBEEF, next));
+    }
+}
@@ -0,0 +1,64 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include <array>
+#include <cstring>
+#include "../Memory/MemoryImage.h"
+#include "../Memory/MemorySource.h"
+#include "../Game/Extraction/ExtractionContext.h"
+#include "../Game/Extraction/ExtractionPlan.h"
+
+using kx::CategoryBit;
+using kx::ExtractionCategory;
+
+SCENARIO("The extraction plan reads due categories and carries the rest, for consumed categories only", "[ExtractionPlan]")
+{
+    const kx::ExtractionCategoryMask players = CategoryBit(ExtractionCategory::Players);
+    const kx::ExtractionCategoryMask gadgets = CategoryBit(ExtractionCategory::Gadgets);
+    const kx::ExtractionCategoryMask items = CategoryBit(ExtractionCategory::Items);
+
+    GIVEN("Items are not consumed by any feature") {
+        const kx::ExtractionCategoryMask consumed = kx::ALL_EXTRACTION_CATEGORIES & ~items;
+
+        WHEN("Players and items are due") {
+            const kx::ExtractionPlan plan(players | items, consumed, true);
+
+            THEN("Players are read, items are skipped and the other consumed categories are carried over") {
+                CHECK(plan.GetRead() == players);
+                CHECK_FALSE(plan.Reads(ExtractionCategory::Items));
+                CHECK_FALSE(plan.Carries(ExtractionCategory::Items));
+                CHECK(plan.GetCarried() == (consumed & ~players));
+            }
+        }
+
+        WHEN("There is no previous frame") {
+            const kx::ExtractionPlan plan(gadgets, consumed, false);
+
+            THEN("Every consumed category is read and nothing is carried over") {
+                CHECK(plan.GetRead() == consumed);
+                CHECK(plan.GetCarried() == 0);
+            }
+        }
+    }
+
+    GIVEN("A ContextCollection whose contexts are all null, replayed from a recording") {
+        constexpr uintptr_t COLLECTION_PAGE = 0x7FF600080000;
+        std::array<uint8_t, kx::MemoryImage::PAGE_SIZE> page{};
+        kx::MemoryImage image;
+        image.AddPage(COLLECTION_PAGE, page.data());
+        kx::MemorySource::ScopedReplay replay(image);
+
+        kx::ExtractionContext context;
+        context.npcCandidates.push_back({ 0, reinterpret_cast<void*>(0x1000), 0 });
+        kx::ExtractionPlan plan(kx::ALL_EXTRACTION_CATEGORIES, kx::ALL_EXTRACTION_CATEGORIES, false);
+        plan.Resolve(reinterpret_cast<void*>(COLLECTION_PAGE), context);
+
+        THEN("No list is walked and the previous pass's scratch is cleared") {
+            CHECK(context.roster.GetStats().players == 0);
+            CHECK(context.playerCandidates.empty());
+            CHECK(context.npcCandidates.empty());
+            CHECK(plan.GetGadgetCandidates().empty());
+            CHECK(plan.GetAttackTargetCandidates().empty());
+            CHECK(plan.GetItemCandidates().empty());
+        }
+    }
+}
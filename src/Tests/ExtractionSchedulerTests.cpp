@@ -0,0 +1,93 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <array>
+#include "../Core/Settings/ExtractionSettings.h"
+#include "../Game/Extraction/ExtractionScheduler.h"
+#include "../Game/Extraction/ExtractionLod.h"
+
+using kx::CategoryBit;
+using kx::ExtractionCategory;
+
+SCENARIO("Each extraction category follows its own integer-millisecond cadence", "[Scheduler]")
+{
+    GIVEN("Players at 50 Hz and everything else at 10 Hz") {
+        kx::ExtractionSettings settings;
+        settings.playerRate = 50.0f;
+        settings.npcRate = 10.0f;
+        settings.gadgetRate = 10.0f;
+        settings.attackTargetRate = 10.0f;
+        settings.itemRate = 10.0f;
+
+        kx::ExtractionScheduler scheduler;
+        scheduler.SetRates(settings);
+        REQUIRE(scheduler.GetIntervalMs(ExtractionCategory::Players) == 20);
+        REQUIRE(scheduler.GetIntervalMs(ExtractionCategory::Items) == 100);
+
+        // Far from zero: a float-seconds clock has only millisecond-scale resolution here
+        constexpr uint64_t START = 40ull * 24 * 60 * 60 * 1000;
+        REQUIRE(scheduler.GetDue(START) == kx::ALL_EXTRACTION_CATEGORIES);
+        scheduler.MarkExtracted(kx::ALL_EXTRACTION_CATEGORIES, START);
+
+        THEN("Nothing is due until the shortest interval has passed") {
+            CHECK(scheduler.GetDue(START + 19) == 0);
+            CHECK(scheduler.GetDue(START + 20) == CategoryBit(ExtractionCategory::Players));
+        }
+
+        THEN("Deadlines hold the cadence even when ticks arrive late") {
+            uint64_t itemPasses = 0;
+            for (uint64_t now = START + 17; now < START + 1020; now += 17) {
+                const kx::ExtractionCategoryMask due = scheduler.GetDue(now);
+                if (due & CategoryBit(ExtractionCategory::Items)) ++itemPasses;
+                scheduler.MarkExtracted(due, now);
+            }
+            CHECK(itemPasses == 10);
+        }
+
+        WHEN("A category falls far behind") {
+            scheduler.MarkExtracted(CategoryBit(ExtractionCategory::Items), START + 5000);
+
+            THEN("It restarts from now instead of catching up in a burst") {
+                CHECK_FALSE(scheduler.GetDue(START + 5099) & CategoryBit(ExtractionCategory::Items));
+                CHECK(scheduler.GetDue(START + 5100) & CategoryBit(ExtractionCategory::Items));
+            }
+        }
+
+        WHEN("The scheduler is reset") {
+            scheduler.Reset();
+
+            THEN("Every category is due immediately") {
+                CHECK(scheduler.GetDue(START + 1) == kx::ALL_EXTRACTION_CATEGORIES);
+            }
+        }
+    }
+}
+
+TEST_CASE("Distance LOD slices cover a whole tier in round-robin order", "[Scheduler]")
+{
+    CHECK(kx::ExtractionLod::Classify(10.0f * 10.0f) == kx::LodTier::Near);
+    CHECK(kx::ExtractionLod::Classify(100.0f * 100.0f) == kx::LodTier::Mid);
+    CHECK(kx::ExtractionLod::Classify(200.0f * 200.0f) == kx::LodTier::Far);
+
+    constexpr size_t COUNT = 150;
+    constexpr size_t BUDGET = kx::ExtractionLod::MID_BUDGET;
+    constexpr size_t PASSES = (COUNT + BUDGET - 1) / BUDGET;
+
+    std::array<int, COUNT> reads{};
+    uint32_t cursor = 0;
+    for (size_t pass = 0; pass < PASSES; ++pass) {
+        size_t readThisPass = 0;
+        for (size_t ordinal = 0; ordinal < COUNT; ++ordinal) {
+            if (kx::ExtractionLod::InSlice(ordinal, COUNT, cursor, BUDGET)) {
+                ++reads[ordinal];
+                ++readThisPass;
+            }
+        }
+        CHECK(readThisPass == BUDGET); // The per-pass cost stays fixed
+        cursor = kx::ExtractionLod::AdvanceCursor(cursor, COUNT, BUDGET);
+    }
+
+    // Every entity was read within ceil(count / budget) passes
+    CHECK(std::ranges::all_of(reads, [](int n) { return n >= 1; }));
+    CHECK(kx::ExtractionLod::InSlice(COUNT - 1, BUDGET, 0, BUDGET)); // A tier within budget is read in full
+}
@@ -0,0 +1,327 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Memory/MemoryImage.h"
+#include "../Memory/MemorySource.h"
+#include "../Game/Extraction/DataExtractor.h"
+#include "../Game/Extraction/ExtractionContext.h"
+#include "../Game/Extraction/ExtractionSnapshot.h"
+#include "../Rendering/Shared/LayoutConstants.h"
+#include "FakeProcess.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+namespace {
+
+    // Fake "process" addresses; they are never dereferenced, only used as image keys
+    constexpr uintptr_t PAGE_A = 0x7FF600010000;
+    constexpr uintptr_t PAGE_B = PAGE_A + kx::MemoryImage::PAGE_SIZE;
+    constexpr uintptr_t PAGE_FAR = 0x20000000;
+
+    std::array<uint8_t, kx::MemoryImage::PAGE_SIZE> MakePage(uint8_t seed) {
+        std::array<uint8_t, kx::MemoryImage::PAGE_SIZE> page{};
+        for (size_t i = 0; i < page.size(); ++i) {
+            page[i] = static_cast<uint8_t>(seed + i);
+        }
+        return page;
+    }
+
+    template <typename T>
+    void Put(std::array<uint8_t, kx::MemoryImage::PAGE_SIZE>& page, uintptr_t offset, const T& value) {
+        std::memcpy(page.data() + offset, &value, sizeof(T));
+    }
+
+    /**
+     * @brief Fake process with ground items only: ContextCollection -> ItCliContext -> item list,
+     *        each item -> AgentInl -> AgKeyFramed -> CoKeyFramed on a page of its own
+     */
+    struct FakeGroundItems {
+        static constexpr uintptr_t ROOT_PAGE = 0x7FF700100000;  // Collection, item context and list
+        static constexpr uintptr_t ITEM_CONTEXT = ROOT_PAGE + 0x400;
+        static constexpr uintptr_t ITEM_LIST = ROOT_PAGE + 0x800;
+        static constexpr uintptr_t ITEM_PAGE = ROOT_PAGE + kx::MemoryImage::PAGE_SIZE;
+        static constexpr uintptr_t ITEM_STRIDE = 0x100;
+        static constexpr uintptr_t ITEM_VTABLE = kx::Testing::MODULE_BASE + 0x2000;
+        static constexpr uint32_t CAPACITY = 4;
+
+        uint32_t count = 0;
+
+        static void* Item(uint32_t item) { return reinterpret_cast<void*>(ITEM_PAGE + item * ITEM_STRIDE); }
+        static uintptr_t AgentPage(uint32_t item) { return ROOT_PAGE + (2 + item) * kx::MemoryImage::PAGE_SIZE; }
+
+        // Every page of the process, or all but the ones listed
+        kx::MemoryImage Build(std::initializer_list<uintptr_t> without = {}) const {
+            using Page = std::array<uint8_t, kx::MemoryImage::PAGE_SIZE>;
+            kx::MemoryImage image = kx::Testing::MakeProcessImage();
+            kx::MemoryImage::Metadata metadata = image.GetMetadata();
+            metadata.contextCollection = ROOT_PAGE;
+            image.SetMetadata(metadata);
+            auto add = [&](uintptr_t base, const Page& page) {
+                if (std::find(without.begin(), without.end(), base) == without.end()) {
+                    image.AddPage(base, page.data());
+                }
+            };
+
+            Page root{};
+            Put(root, 0x178, ITEM_CONTEXT);                 // ContextCollection::IT_CLI_CONTEXT
+            Put(root, ITEM_CONTEXT - ROOT_PAGE + 0x30, ITEM_LIST);
+            Put(root, ITEM_CONTEXT - ROOT_PAGE + 0x38, CAPACITY);
+            Put(root, ITEM_CONTEXT - ROOT_PAGE + 0x3C, count);
+            Page items{};
+            for (uint32_t item = 0; item < count; ++item) {
+                Put(root, ITEM_LIST - ROOT_PAGE + item * sizeof(void*), Item(item));
+                Put(items, item * ITEM_STRIDE, ITEM_VTABLE);
+                Put(items, item * ITEM_STRIDE + 0x48, static_cast<uint16_t>(kx::Game::ItemLocation::Agent));
+                Put(items, item * ITEM_STRIDE + 0x58, AgentPage(item)); // AgentInl
+
+                Page agent{};
+                Put(agent, 0x18, AgentPage(item) + 0x100);              // AgentInl -> AgKeyFramed
+                Put(agent, 0x100 + 0x0C, static_cast<int32_t>(100 + item)); // Agent ID
+                Put(agent, 0x100 + 0x50, AgentPage(item) + 0x200);      // AgKeyFramed -> CoKeyFramed
+                Put(agent, 0x200 + 0x30, glm::vec3(10.0f * (item + 1), 20.0f, 30.0f));
+                add(AgentPage(item), agent);
+            }
+            add(ROOT_PAGE, root);
+            add(ITEM_PAGE, items);
+            return image;
+        }
+    };
+
+    // Pools plus the frame pointing into them; kept alive as the next pass's previous frame
+    struct FrameBuffers {
+        kx::ObjectPool<kx::PlayerEntity> playerPool{ 4 };
+        kx::ObjectPool<kx::NpcEntity> npcPool{ 4 };
+        kx::ObjectPool<kx::GadgetEntity> gadgetPool{ 4 };
+        kx::ObjectPool<kx::AttackTargetEntity> attackTargetPool{ 4 };
+        kx::ObjectPool<kx::ItemEntity> itemPool{ 4 };
+        kx::FrameGameData frame;
+
+        bool Extract(kx::ExtractionContext& context) {
+            return kx::DataExtractor::ExtractFrameData(playerPool, npcPool, gadgetPool,
+                attackTargetPool, itemPool, frame, context);
+        }
+    };
+
+} // namespace
+
+SCENARIO("Memory image serves recorded addresses from host copies", "[Snapshot]")
+{
+    GIVEN("An image with two adjacent pages and one distant page") {
+        kx::MemoryImage image;
+        const auto pageA = MakePage(0x10);
+        const auto pageB = MakePage(0x80);
+        const auto pageFar = MakePage(0xF0);
+        image.AddPage(PAGE_A, pageA.data());
+        image.AddPage(PAGE_B, pageB.data());
+        image.AddPage(PAGE_FAR, pageFar.data());
+        image.SetMetadata({ 0x7FF600000000, 0x01000000, PAGE_A + 0x40, PAGE_FAR + 0x100 });
+
+        WHEN("Reading inside a captured page") {
+            uint32_t value = 0;
+            REQUIRE(image.Read(PAGE_A + 0x20, &value, sizeof(value)));
+
+            THEN("The bytes match the source page") {
+                uint32_t expected = 0;
+                std::memcpy(&expected, pageA.data() + 0x20, sizeof(expected));
+                CHECK(value == expected);
+            }
+        }
+
+        WHEN("Reading across the boundary of two adjacent pages") {
+            uint64_t value = 0;
+            REQUIRE(image.Read(PAGE_B - 4, &value, sizeof(value)));
+
+            THEN("The value is stitched from both pages") {
+                uint8_t expected[8];
+                std::memcpy(expected, pageA.data() + kx::MemoryImage::PAGE_SIZE - 4, 4);
+                std::memcpy(expected + 4, pageB.data(), 4);
+                CHECK(std::memcmp(&value, expected, sizeof(value)) == 0);
+            }
+        }
+
+        WHEN("Reading memory that was never captured") {
+            uint32_t value = 0;
+            THEN("The read fails instead of returning garbage") {
+                CHECK_FALSE(image.Read(PAGE_B + kx::MemoryImage::PAGE_SIZE, &value, sizeof(value)));
+                CHECK_FALSE(image.Read(PAGE_FAR + kx::MemoryImage::PAGE_SIZE - 2, &value, sizeof(value)));
+                CHECK_FALSE(image.HasPage(PAGE_FAR - 1));
+            }
+        }
+
+        WHEN("The image is saved and loaded back") {
+            const auto path = std::filesystem::temp_directory_path() / "kx_vision_image_test.kxmi";
+            REQUIRE(image.SaveToFile(path));
+
+            kx::MemoryImage loaded;
+            REQUIRE(loaded.LoadFromFile(path));
+            std::filesystem::remove(path);
+
+            THEN("Pages, contents and metadata survive the round trip") {
+                CHECK(loaded.GetPageCount() == 3);
+                CHECK(loaded.GetMetadata().contextCollection == PAGE_A + 0x40);
+                CHECK(loaded.GetMetadata().localPlayer == PAGE_FAR + 0x100);
+
+                uint64_t original = 0;
+                uint64_t reloaded = 0;
+                REQUIRE(image.Read(PAGE_B - 4, &original, sizeof(original)));
+                REQUIRE(loaded.Read(PAGE_B - 4, &reloaded, sizeof(reloaded)));
+                CHECK(original == reloaded);
+            }
+        }
+
+        WHEN("The memory source replays the image on this thread") {
+            kx::MemorySource::ScopedReplay replay(image);
+
+            THEN("Typed reads and probes go through the image") {
+                CHECK(kx::MemorySource::IsReadable(PAGE_FAR));
+                CHECK_FALSE(kx::MemorySource::IsReadable(PAGE_FAR + kx::MemoryImage::PAGE_SIZE));
+                CHECK(kx::MemorySource::Read<uint8_t>(PAGE_A + 1, 0) == pageA[1]);
+                CHECK(kx::MemorySource::Read<uint32_t>(0x30000000, 0xDEADBEEF) == 0xDEADBEEF);
+                CHECK(kx::MemorySource::GetContextCollectionPtr() == reinterpret_cast<void*>(PAGE_A + 0x40));
+            }
+        }
+    }
+}
+
+SCENARIO("Staged reads decode from the capture only and learn the pages they need", "[Snapshot]")
+{
+    GIVEN("Three pages of host memory, two of them captured into a staging image") {
+        alignas(kx::MemoryImage::PAGE_SIZE) static uint8_t memory[3][kx::MemoryImage::PAGE_SIZE];
+        memory[0][0x10] = 1;
+        memory[1][0x10] = 2;
+        memory[2][0x10] = 3;
+        const uintptr_t page0 = reinterpret_cast<uintptr_t>(memory[0]);
+        const uintptr_t page1 = reinterpret_cast<uintptr_t>(memory[1]);
+        const uintptr_t page2 = reinterpret_cast<uintptr_t>(memory[2]);
+
+        kx::MemoryImage staging;
+        const size_t staged = kx::MemorySource::CaptureStaging(staging, { page0, page1 });
+        REQUIRE(staged >= 2);
+
+        // The game moves on after the capture
+        memory[0][0x10] = 10;
+        memory[2][0x10] = 30;
+
+        WHEN("The decode reads one captured page and one page the capture lacked") {
+            uint8_t fromCapture = 0;
+            uint8_t missing = 0;
+            bool missingReadable = true;
+            {
+                kx::MemorySource::ScopedStaging decode(staging);
+                fromCapture = kx::MemorySource::Read<uint8_t>(page0 + 0x10, 0);
+                missing = kx::MemorySource::Read<uint8_t>(page2 + 0x10, 0xFF);
+                missingReadable = kx::MemorySource::IsReadable(page2);
+            }
+
+            THEN("Captured pages show the captured state and missing pages are unreadable, not read live") {
+                CHECK(fromCapture == 1);
+                CHECK(missing == 0xFF);
+                CHECK_FALSE(missingReadable);
+                CHECK(staging.GetPageCount() == staged);
+                CHECK(staging.GetRequestedPageCount() == 1);
+            }
+
+            THEN("The pages that were read or missing are handed to the next capture") {
+                std::vector<uintptr_t> next;
+                staging.CollectTouchedPages(next);
+                CHECK(std::find(next.begin(), next.end(), page0) != next.end());
+                CHECK(std::find(next.begin(), next.end(), page2) != next.end());
+                CHECK(std::find(next.begin(), next.end(), page1) == next.end());
+
+                AND_THEN("The next capture stages the missing page") {
+                    kx::MemorySource::CaptureStaging(staging, next);
+                    kx::MemorySource::ScopedStaging decode(staging);
+                    CHECK(kx::MemorySource::Read<uint8_t>(page2 + 0x10, 0xFF) == 30);
+                    CHECK(staging.GetRequestedPageCount() == 0);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("A staged decode keeps entities behind missing pages instead of dropping them", "[Snapshot]")
+{
+    GIVEN("Two ground items extracted from a complete capture") {
+        FakeGroundItems process;
+        process.count = 2;
+
+        kx::ExtractionContext context;
+        context.consumed = kx::CategoryBit(kx::ExtractionCategory::Items);
+        context.now = 1000;
+        FrameBuffers first;
+        kx::MemoryImage complete = process.Build();
+        {
+            kx::MemorySource::ScopedStaging decode(complete);
+            REQUIRE(first.Extract(context));
+        }
+        REQUIRE(first.frame.items.size() == 2);
+        CHECK(first.frame.stats.missedEntities == 0);
+        CHECK(first.frame.stats.missedCategories == 0);
+
+        WHEN("The next capture lacks the page behind one item, and a third item appears on a page it lacks") {
+            process.count = 3;
+            kx::MemoryImage partial = process.Build({ FakeGroundItems::AgentPage(1), FakeGroundItems::AgentPage(2) });
+            context.now = 1250;
+            context.previousFrame = &first.frame;
+            FrameBuffers second;
+            {
+                kx::MemorySource::ScopedStaging decode(partial);
+                REQUIRE(second.Extract(context));
+            }
+
+            THEN("The known item keeps its previous values, flagged stale, and only the new one waits for the pages") {
+                REQUIRE(second.frame.items.size() == 2);
+                const kx::ItemEntity* kept = nullptr;
+                for (const kx::ItemEntity* item : second.frame.items) {
+                    if (item->address == FakeGroundItems::Item(1)) kept = item;
+                }
+                REQUIRE(kept != nullptr);
+                CHECK(kept->isStale);
+                CHECK(kept->staleMs == 250);
+                CHECK(kept->agentId == 101);
+                CHECK(second.frame.stats.missedEntities == 2);
+                CHECK(second.frame.stats.missedCategories == kx::CategoryBit(kx::ExtractionCategory::Items));
+                CHECK(partial.GetRequestedPageCount() == 2);
+            }
+        }
+    }
+}
+
+// Headless throughput benchmark against a recorded scene.
+// Hidden by default; run with KX_REPLAY_IMAGE=<path to .kxmi> and the "[replay]" tag.
+TEST_CASE("Extraction replay throughput", "[.][replay]")
+{
+    const char* imagePath = std::getenv("KX_REPLAY_IMAGE");
+    if (!imagePath) {
+        SKIP("KX_REPLAY_IMAGE is not set");
+    }
+
+    kx::ObjectPool<kx::PlayerEntity> playerPool(kx::EntityLimits::MAX_PLAYERS);
+    kx::ObjectPool<kx::NpcEntity> npcPool(kx::EntityLimits::MAX_NPCS);
+    kx::ObjectPool<kx::GadgetEntity> gadgetPool(kx::EntityLimits::MAX_GADGETS);
+    kx::ObjectPool<kx::AttackTargetEntity> attackTargetPool(kx::EntityLimits::MAX_ATTACK_TARGETS);
+    kx::ObjectPool<kx::ItemEntity> itemPool(kx::EntityLimits::MAX_ITEMS);
+    kx::FrameGameData frameData;
+    kx::ExtractionContext context;
+
+    auto extract = [&]() {
+        playerPool.Reset();
+        npcPool.Reset();
+        gadgetPool.Reset();
+        attackTargetPool.Reset();
+        itemPool.Reset();
+        return kx::DataExtractor::ExtractFrameData(playerPool, npcPool, gadgetPool,
+            attackTargetPool, itemPool, frameData, context);
+    };
+
+    kx::ExtractionSnapshot::ReplayResult result;
+    REQUIRE(kx::ExtractionSnapshot::Replay(imagePath, 200, extract, result));
+
+    WARN("Replayed " << (frameData.players.size() + frameData.npcs.size() + frameData.gadgets.size() +
+        frameData.attackTargets.size() + frameData.items.size())
+        << " entities x" << result.iterations << ": avg " << result.avgUs << " us, min "
+        << result.minUs << " us, max " << result.maxUs << " us");
+}
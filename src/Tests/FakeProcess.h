@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include "../Memory/MemoryImage.h"
+#include "../Memory/MemorySource.h"
+
+namespace kx {
+namespace Testing {
+
+    /**
+     * @brief Game module of the fake process replayed by the tests
+     *
+     * An object counts as valid if its VTable lies inside the module, so fake objects start
+     * with an address in [MODULE_BASE, MODULE_BASE + MODULE_SIZE).
+     */
+    constexpr uintptr_t MODULE_BASE = 0x7FF600000000;
+    constexpr uintptr_t MODULE_SIZE = 0x100000;
+
+    /**
+     * @brief Empty image carrying the fake module's metadata; the caller adds the pages
+     */
+    inline MemoryImage MakeProcessImage() {
+        MemoryImage image;
+        MemoryImage::Metadata metadata;
+        metadata.moduleBase = MODULE_BASE;
+        metadata.moduleSize = MODULE_SIZE;
+        image.SetMetadata(metadata);
+        return image;
+    }
+
+    /**
+     * @brief Run one pass against a freshly built image of `state`
+     *
+     * Pages are immutable once added, so a test that changes the fake process between passes
+     * rebuilds the image (state.Build()) and replays it for the duration of the pass.
+     */
+    template <typename State, typename Pass>
+    decltype(auto) ReplayPass(const State& state, Pass&& pass) {
+        const MemoryImage image = state.Build();
+        MemorySource::ScopedReplay replay(image);
+        return std::forward<Pass>(pass)();
+    }
+
+} // namespace Testing
+} // namespace kx
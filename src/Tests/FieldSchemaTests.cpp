@@ -0,0 +1,81 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Memory/MemoryImage.h"
+#include "../Memory/MemorySource.h"
+#include "../Memory/FieldSchema.h"
+#include "../Game/SdkStructs.h"
+#include <array>
+#include <cstring>
+
+namespace {
+
+    // Fake "process" address of a recorded ChCliHealth; never dereferenced
+    constexpr uintptr_t HEALTH_PAGE = 0x7FF600040000;
+    constexpr uintptr_t HEALTH_OBJECT = HEALTH_PAGE + 0x100;
+
+    struct TestSchema {
+        static constexpr kx::FieldSchema::Field<uint8_t> FLAG{ 0x03, "flag" };
+        static constexpr kx::FieldSchema::Field<float> VALUE{ 0x10, "value" };
+        static constexpr kx::FieldSchema::Field<void*> POINTER{ 0x18, "pointer" };
+
+        static constexpr kx::FieldSchema::Span ALL = kx::FieldSchema::CoveringSpan(VALUE, FLAG, POINTER);
+    };
+
+    static_assert(TestSchema::ALL.begin == 0x03);
+    static_assert(TestSchema::ALL.end == 0x20);
+
+    template<typename T>
+    void Put(std::array<uint8_t, kx::MemoryImage::PAGE_SIZE>& page, uintptr_t offset, const T& value) {
+        std::memcpy(page.data() + offset, &value, sizeof(T));
+    }
+
+} // namespace
+
+SCENARIO("Schema blocks copy the covering span once and decode fields from it", "[FieldSchema]")
+{
+    GIVEN("A replayed page holding a health object and a schema-described record") {
+        std::array<uint8_t, kx::MemoryImage::PAGE_SIZE> page{};
+        Put(page, 0x100 + 0x0C, 750.0f);   // ChCliHealth current
+        Put(page, 0x100 + 0x10, 1000.0f);  // ChCliHealth max
+        Put(page, 0x100 + 0x28, 42.0f);    // ChCliHealth barrier
+        Put<uint8_t>(page, 0x800 + 0x03, 7);
+        Put(page, 0x800 + 0x10, 2.5f);
+
+        kx::MemoryImage image;
+        image.AddPage(HEALTH_PAGE, page.data());
+        kx::MemorySource::ScopedReplay replay(image);
+
+        WHEN("A block loads a recorded span") {
+            kx::FieldSchema::Block<TestSchema::ALL> block;
+            REQUIRE(block.Load(reinterpret_cast<const void*>(HEALTH_PAGE + 0x800)));
+
+            THEN("Each field decodes at its own offset") {
+                CHECK(block.Get<TestSchema::FLAG>() == 7);
+                CHECK(block.Get<TestSchema::VALUE>() == 2.5f);
+                CHECK(block.Get<TestSchema::POINTER>() == nullptr);
+            }
+        }
+
+        WHEN("The span was not recorded") {
+            kx::FieldSchema::Block<TestSchema::ALL> block;
+            CHECK_FALSE(block.Load(reinterpret_cast<const void*>(0x30000000)));
+
+            THEN("Fields fall back") {
+                CHECK(block.Get<TestSchema::VALUE>(-1.0f) == -1.0f);
+            }
+        }
+
+        WHEN("A wrapper reads its values in bulk") {
+            kx::ReClass::ChCliHealth health(reinterpret_cast<void*>(HEALTH_OBJECT));
+            const kx::ReClass::ChCliHealth::Values values = health.ReadValues();
+
+            THEN("They match the single-field getters") {
+                CHECK(values.current == 750.0f);
+                CHECK(values.max == 1000.0f);
+                CHECK(values.barrier == 42.0f);
+                CHECK(values.current == health.GetCurrent());
+                CHECK(values.barrier == health.GetBarrier());
+            }
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Utils/ForkJoinPool.h"
+#include "../Utils/ObjectPool.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Fork-join pool runs every participant exactly once per job", "[ForkJoinPool]")
+{
+    kx::ForkJoinPool pool;
+    const size_t workers = GENERATE(0, 1, 3);
+    pool.Resize(workers);
+    REQUIRE(pool.GetWorkerCount() == workers);
+
+    const std::thread::id caller = std::this_thread::get_id();
+    for (int job = 0; job < 50; ++job) {
+        std::vector<std::atomic<int>> runs(workers + 1);
+        std::atomic<bool> participantZeroOnCaller{ false };
+
+        const size_t ran = pool.Run([&](size_t participant) {
+            runs[participant].fetch_add(1);
+            if (participant == 0) {
+                participantZeroOnCaller = std::this_thread::get_id() == caller;
+            }
+        });
+
+        CHECK(ran == workers + 1);
+        CHECK(participantZeroOnCaller);
+        for (const auto& count : runs) {
+            CHECK(count.load() == 1);
+        }
+    }
+
+    pool.Resize(0);
+    CHECK(pool.GetWorkerCount() == 0);
+}
+
+TEST_CASE("Object pool slices hand out disjoint objects", "[ForkJoinPool]")
+{
+    kx::ObjectPool<int> pool(10);
+    auto first = pool.Slice(0, 4);
+    auto second = pool.Slice(4, 20); // Clamped to the pool size
+
+    CHECK(first.Size() == 4);
+    CHECK(second.Size() == 6);
+
+    int* a = first.Get();
+    int* b = second.Get();
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    CHECK(b - a == 4);
+
+    for (int i = 1; i < 4; ++i) {
+        CHECK(first.Get() != nullptr);
+    }
+    CHECK(first.Get() == nullptr); // Exhausted without spilling into the next slice
+    CHECK(first.Used() == 4);
+}
@@ -0,0 +1,144 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include <array>
+#include <cstring>
+#include "../Game/Extraction/ExtractionContext.h"
+#include "../Game/Extraction/GroundItemIndex.h"
+#include "FakeProcess.h"
+
+namespace {
+
+    // Fake process layout: one page holds the item pointer array, one page the items themselves
+    constexpr uintptr_t ITEM_VTABLE = kx::Testing::MODULE_BASE + 0x1000;
+    constexpr uintptr_t LIST_PAGE = 0x7FF700010000;
+    constexpr uintptr_t ITEM_PAGE = 0x7FF700020000;
+    constexpr uintptr_t ITEM_STRIDE = 0x80;
+    constexpr uint32_t CAPACITY = 8;
+
+    constexpr uint16_t LOCATION_AGENT = 1;
+    constexpr uint16_t LOCATION_EQUIPMENT = 2;
+
+    void* ItemAddress(uint32_t item) {
+        return reinterpret_cast<void*>(ITEM_PAGE + item * ITEM_STRIDE);
+    }
+
+    // Item list state, replayed from a fresh image on every pass
+    struct FakeItemList {
+        std::array<void*, CAPACITY> slots{};
+        std::array<uint16_t, CAPACITY> locations{};
+
+        void Place(uint32_t slot, uint32_t item, uint16_t location) {
+            slots[slot] = ItemAddress(item);
+            locations[item] = location;
+        }
+
+        kx::MemoryImage Build() const {
+            std::array<uint8_t, kx::MemoryImage::PAGE_SIZE> listPage{};
+            std::memcpy(listPage.data(), slots.data(), sizeof(slots));
+
+            std::array<uint8_t, kx::MemoryImage::PAGE_SIZE> itemPage{};
+            for (uint32_t item = 0; item < CAPACITY; ++item) {
+                std::memcpy(itemPage.data() + item * ITEM_STRIDE, &ITEM_VTABLE, sizeof(ITEM_VTABLE));
+                std::memcpy(itemPage.data() + item * ITEM_STRIDE + 0x48, &locations[item], sizeof(uint16_t));
+            }
+
+            kx::MemoryImage image = kx::Testing::MakeProcessImage();
+            image.AddPage(LIST_PAGE, listPage.data());
+            image.AddPage(ITEM_PAGE, itemPage.data());
+            return image;
+        }
+    };
+
+    size_t UpdateFrom(const FakeItemList& list, kx::GroundItemIndex& index, uint32_t capacity = CAPACITY) {
+        return kx::Testing::ReplayPass(list, [&] {
+            return index.Update(reinterpret_cast<void**>(LIST_PAGE), capacity).size();
+        });
+    }
+
+} // namespace
+
+SCENARIO("The ground item index reclassifies only the item slots that changed", "[GroundItems]")
+{
+    GIVEN("A list of five equipped items and one ground item") {
+        FakeItemList list;
+        for (uint32_t slot = 0; slot < 5; ++slot) {
+            list.Place(slot, slot, LOCATION_EQUIPMENT);
+        }
+        list.Place(6, 6, LOCATION_AGENT);
+
+        kx::GroundItemIndex index;
+        REQUIRE(UpdateFrom(list, index) == 1);
+        CHECK(index.GetStats().listItems == 6);
+        CHECK(index.GetStats().groundItems == 1);
+
+        WHEN("The next pass sees the same list") {
+            UpdateFrom(list, index);
+
+            THEN("Only the round-robin re-check reads item locations") {
+                CHECK(index.GetStats().groundItems == 1);
+                CHECK(index.GetStats().reclassified == 5); // The equipped items, re-checked in place
+            }
+        }
+
+        WHEN("An item is dropped into an empty slot") {
+            list.Place(7, 7, LOCATION_AGENT);
+
+            THEN("It joins the index") {
+                CHECK(UpdateFrom(list, index) == 2);
+            }
+        }
+
+        WHEN("The ground item is picked up in place") {
+            list.locations[6] = LOCATION_EQUIPMENT;
+
+            THEN("The index drops it") {
+                CHECK(UpdateFrom(list, index) == 0);
+            }
+        }
+
+        WHEN("The list shrinks below the ground item's slot") {
+            THEN("The slot leaves the index") {
+                CHECK(UpdateFrom(list, index, 4) == 0);
+                CHECK(index.GetStats().listItems == 4);
+            }
+        }
+
+        WHEN("The list is gone") {
+            THEN("The index is empty") {
+                kx::MemoryImage empty;
+                kx::MemorySource::ScopedReplay replay(empty);
+                CHECK(index.Update(nullptr, 0).empty());
+                CHECK(index.GetStats().listItems == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("A map change drops the ground item index", "[GroundItems]")
+{
+    GIVEN("A ground item indexed on the old map") {
+        FakeItemList list;
+        list.Place(0, 0, LOCATION_AGENT);
+
+        kx::ExtractionContext context;
+        REQUIRE(UpdateFrom(list, context.groundItems) == 1);
+
+        WHEN("The map changes") {
+            context.ClearMapState();
+
+            THEN("Nothing of the old list is left") {
+                CHECK(context.groundItems.GetStats().groundItems == 0);
+                CHECK(context.groundItems.GetStats().listItems == 0);
+            }
+
+            AND_WHEN("The new map's list holds an equipped item at the same address") {
+                list.locations[0] = LOCATION_EQUIPMENT;
+
+                THEN("The slot is classified from scratch") {
+                    CHECK(UpdateFrom(list, context.groundItems) == 0);
+                    CHECK(context.groundItems.GetStats().listItems == 1);
+                }
+            }
+        }
+    }
+}
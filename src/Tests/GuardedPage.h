@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace kx {
+namespace Testing {
+
+    /**
+     * @brief One readable page followed by one inaccessible page
+     *
+     * A read that runs past the end of the readable page faults, so tests can prove that a
+     * routine stops at a terminator placed in the page's last bytes.
+     */
+    class GuardedPage {
+    public:
+        static constexpr size_t PAGE_BYTES = 0x1000;
+
+        GuardedPage() {
+#ifdef _WIN32
+            void* base = VirtualAlloc(nullptr, 2 * PAGE_BYTES, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            DWORD oldProtect = 0;
+            if (base && VirtualProtect(static_cast<char*>(base) + PAGE_BYTES, PAGE_BYTES, PAGE_NOACCESS, &oldProtect)) {
+                m_base = base;
+            } else if (base) {
+                VirtualFree(base, 0, MEM_RELEASE);
+            }
+#else
+            void* base = mmap(nullptr, 2 * PAGE_BYTES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (base == MAP_FAILED) {
+                return;
+            }
+            if (mprotect(static_cast<char*>(base) + PAGE_BYTES, PAGE_BYTES, PROT_NONE) == 0) {
+                m_base = base;
+            } else {
+                munmap(base, 2 * PAGE_BYTES);
+            }
+#endif
+        }
+
+        ~GuardedPage() {
+            if (!m_base) return;
+#ifdef _WIN32
+            VirtualFree(m_base, 0, MEM_RELEASE);
+#else
+            munmap(m_base, 2 * PAGE_BYTES);
+#endif
+        }
+
+        GuardedPage(const GuardedPage&) = delete;
+        GuardedPage& operator=(const GuardedPage&) = delete;
+
+        /**
+         * @brief Start of the readable page, or nullptr if the pages could not be set up
+         */
+        [[nodiscard]] void* Data() const { return m_base; }
+
+    private:
+        void* m_base = nullptr;
+    };
+
+} // namespace Testing
+} // namespace kx
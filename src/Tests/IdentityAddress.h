@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace kx {
+namespace Testing {
+
+    /**
+     * @brief Distinct fake object address for tests that key state by pointer
+     *
+     * Only compared and hashed, never dereferenced: nothing is mapped at these addresses.
+     * @param n Any nonzero number; equal numbers give equal addresses
+     */
+    inline void* IdentityAddress(uintptr_t n) {
+        return reinterpret_cast<void*>(0x10000 * n);
+    }
+
+} // namespace Testing
+} // namespace kx
@@ -0,0 +1,98 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Memory/Safety.h"
+#include "../Memory/ForeignClass.h"
+#include "../Memory/PageProbeCache.h"
+
+SCENARIO("Page probe cache answers repeat probes within one generation", "[ProbeCache]")
+{
+    GIVEN("A cache with one page inserted") {
+        kx::SafeAccess::PageProbeCache cache;
+        cache.NextGeneration();
+
+        constexpr uintptr_t ADDRESS = 0x7FF612345678;
+        CHECK_FALSE(cache.Lookup(ADDRESS));
+        cache.Insert(ADDRESS);
+
+        THEN("Any address in the same page hits") {
+            CHECK(cache.Lookup(ADDRESS & ~uintptr_t(0xFFF)));
+            CHECK(cache.Lookup(ADDRESS | 0xFFF));
+            CHECK(cache.GetStats().hits == 2);
+            CHECK(cache.GetStats().misses == 1);
+        }
+
+        THEN("A page mapping to the same entry misses") {
+            const uintptr_t aliased = ADDRESS + (kx::SafeAccess::PageProbeCache::ENTRY_COUNT << kx::SafeAccess::PageProbeCache::PAGE_SHIFT);
+            CHECK_FALSE(cache.Lookup(aliased));
+        }
+
+        WHEN("The next extraction pass starts") {
+            cache.NextGeneration();
+
+            THEN("The page must be probed again and the counters restart") {
+                CHECK(cache.GetStats().hits == 0);
+                CHECK_FALSE(cache.Lookup(ADDRESS));
+            }
+        }
+    }
+}
+
+TEST_CASE("IsMemorySafe uses the probe cache only while it is active", "[ProbeCache]")
+{
+    alignas(64) static uint64_t readable[4] = {}; // Aligned: all four words share one page
+    kx::SafeAccess::PageProbeCache cache;
+    cache.NextGeneration();
+
+    CHECK(kx::SafeAccess::IsMemorySafe(&readable[0]));
+    CHECK(cache.GetStats().misses == 0); // Not active yet
+
+    {
+        kx::SafeAccess::ScopedPageProbeCache scope(cache);
+        CHECK(kx::SafeAccess::GetActiveProbeCache() == &cache);
+        CHECK(kx::SafeAccess::IsMemorySafe(&readable[0]));
+        CHECK(kx::SafeAccess::IsMemorySafe(&readable[1]));
+        CHECK_FALSE(kx::SafeAccess::IsMemorySafe(nullptr));
+    }
+
+    CHECK(kx::SafeAccess::GetActiveProbeCache() == nullptr);
+    CHECK(cache.GetStats().misses == 1);
+    CHECK(cache.GetStats().hits == 1);
+}
+
+TEST_CASE("ForeignClass copies carry their validation through one extraction pass", "[ProbeCache]")
+{
+    alignas(64) static uint64_t object[4] = {};
+    kx::SafeAccess::PageProbeCache cache;
+    cache.NextGeneration();
+    kx::SafeAccess::ScopedPageProbeCache scope(cache);
+
+    auto probes = [&]() { return cache.GetStats().hits + cache.GetStats().misses; };
+
+    kx::ForeignClass original(&object[0]);
+    REQUIRE(original.data() == &object[0]);
+    CHECK(probes() == 1);
+
+    // Copies, assignments and validity checks within the pass cost no further probes
+    kx::ForeignClass copy = original;
+    kx::ForeignClass assigned(nullptr);
+    assigned = copy;
+    CHECK(copy.isValid());
+    CHECK(static_cast<bool>(assigned));
+    CHECK(probes() == 1);
+
+    SECTION("A raw pointer promoted once is trusted without a probe") {
+        kx::ForeignClass adopted(nullptr);
+        adopted.AdoptValidated(&object[1]);
+        CHECK(adopted.IsProvenValid());
+        CHECK(adopted.isValid());
+        CHECK(probes() == 1);
+    }
+
+    SECTION("The proof expires with the pass") {
+        cache.NextGeneration();
+        CHECK_FALSE(copy.IsProvenValid());
+        kx::ForeignClass recopied = copy;
+        CHECK(recopied.data() == &object[0]);
+        CHECK(probes() == 1); // Counters restarted: exactly one new probe
+    }
+}
@@ -0,0 +1,158 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include <array>
+#include <cstring>
+#include <string_view>
+#include "../Game/Extraction/ExtractionContext.h"
+#include "../Game/Extraction/PlayerRoster.h"
+#include "FakeProcess.h"
+
+namespace {
+
+    // Fake process layout: the player pointer array, the ChCliPlayer objects and their names
+    constexpr uintptr_t PLAYER_VTABLE = kx::Testing::MODULE_BASE + 0x2000;
+    constexpr uintptr_t LIST_PAGE = 0x7FF700110000;
+    constexpr uintptr_t PLAYER_PAGE = 0x7FF700120000;
+    constexpr uintptr_t NAME_PAGE = 0x7FF700130000;
+    constexpr uintptr_t PLAYER_STRIDE = 0x100;
+    constexpr uintptr_t NAME_STRIDE = 0x100;
+    constexpr uint32_t CAPACITY = 4;
+
+    void* PlayerAddress(uint32_t player) {
+        return reinterpret_cast<void*>(PLAYER_PAGE + player * PLAYER_STRIDE);
+    }
+
+    const void* CharacterAddress(uint32_t character) {
+        return reinterpret_cast<const void*>(0x7FF700200000 + character * 0x1000);
+    }
+
+    struct FakePlayerList {
+        std::array<void*, CAPACITY> slots{};
+        std::array<const void*, CAPACITY> characters{};
+        std::array<std::wstring_view, CAPACITY> names{};
+
+        void Place(uint32_t slot, uint32_t player, uint32_t character, std::wstring_view name) {
+            slots[slot] = PlayerAddress(player);
+            characters[player] = CharacterAddress(character);
+            names[player] = name;
+        }
+
+        kx::MemoryImage Build() const {
+            std::array<uint8_t, kx::MemoryImage::PAGE_SIZE> listPage{};
+            std::memcpy(listPage.data(), slots.data(), sizeof(slots));
+
+            std::array<uint8_t, kx::MemoryImage::PAGE_SIZE> playerPage{};
+            std::array<uint8_t, kx::MemoryImage::PAGE_SIZE> namePage{};
+            for (uint32_t player = 0; player < CAPACITY; ++player) {
+                const uintptr_t name = NAME_PAGE + player * NAME_STRIDE;
+                uint8_t* object = playerPage.data() + player * PLAYER_STRIDE;
+                std::memcpy(object, &PLAYER_VTABLE, sizeof(PLAYER_VTABLE));
+                std::memcpy(object + 0x18, &characters[player], sizeof(void*));
+                std::memcpy(object + 0x68, &name, sizeof(name));
+                std::memcpy(namePage.data() + player * NAME_STRIDE, names[player].data(), names[player].size() * sizeof(wchar_t));
+            }
+
+            kx::MemoryImage image = kx::Testing::MakeProcessImage();
+            image.AddPage(LIST_PAGE, listPage.data());
+            image.AddPage(PLAYER_PAGE, playerPage.data());
+            image.AddPage(NAME_PAGE, namePage.data());
+            return image;
+        }
+    };
+
+    void UpdateFrom(const FakePlayerList& list, kx::PlayerRoster& roster) {
+        kx::Testing::ReplayPass(list, [&] {
+            roster.Update(reinterpret_cast<void**>(LIST_PAGE), CAPACITY);
+        });
+    }
+
+    std::string_view NameOf(const kx::PlayerRoster& roster, uint32_t character) {
+        const kx::PlayerRoster::Entry* entry = roster.Find(CharacterAddress(character));
+        return entry ? std::string_view(entry->name) : std::string_view("<none>");
+    }
+
+} // namespace
+
+SCENARIO("The player roster converts each name once, when its player shows up", "[PlayerRoster]")
+{
+    GIVEN("Two players in the list") {
+        FakePlayerList list;
+        list.Place(0, 0, 10, L"Alpha");
+        list.Place(2, 1, 11, L"Bravo");
+
+        kx::PlayerRoster roster;
+        UpdateFrom(list, roster);
+
+        REQUIRE(roster.GetStats().players == 2);
+        CHECK(roster.GetStats().namesTranscoded == 2);
+        CHECK(NameOf(roster, 10) == "Alpha");
+        CHECK(NameOf(roster, 11) == "Bravo");
+        CHECK(roster.Find(CharacterAddress(12)) == nullptr);
+
+        WHEN("The list is unchanged") {
+            UpdateFrom(list, roster);
+
+            THEN("No name is converted again") {
+                CHECK(roster.GetStats().namesTranscoded == 0);
+                CHECK(NameOf(roster, 10) == "Alpha");
+            }
+        }
+
+        WHEN("A player leaves and another joins") {
+            list.slots[0] = nullptr;
+            list.Place(1, 2, 12, L"Charlie");
+            UpdateFrom(list, roster);
+
+            THEN("Only the newcomer is converted and the leaver is gone") {
+                CHECK(roster.GetStats().namesTranscoded == 1);
+                CHECK(roster.GetStats().players == 2);
+                CHECK(roster.Find(CharacterAddress(10)) == nullptr);
+                CHECK(NameOf(roster, 12) == "Charlie");
+            }
+        }
+
+        WHEN("The extraction binds a character to a different agent than before") {
+            roster.BindAgent(CharacterAddress(11), 7);
+            roster.BindAgent(CharacterAddress(11), 8);
+            list.names[1] = L"Delta";
+            UpdateFrom(list, roster);
+
+            THEN("The entry is read and converted again") {
+                CHECK(roster.GetStats().namesTranscoded == 1);
+                CHECK(NameOf(roster, 11) == "Delta");
+                CHECK(roster.Find(CharacterAddress(11))->agentId == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("A map change drops the roster before the new map reuses character addresses", "[PlayerRoster]")
+{
+    GIVEN("A player known on the old map") {
+        FakePlayerList list;
+        list.Place(0, 0, 10, L"Alpha");
+
+        kx::ExtractionContext context;
+        UpdateFrom(list, context.roster);
+        REQUIRE(NameOf(context.roster, 10) == "Alpha");
+
+        WHEN("The map changes") {
+            context.ClearMapState();
+
+            THEN("The old character pointer no longer resolves to a player") {
+                CHECK(context.roster.Find(CharacterAddress(10)) == nullptr);
+                CHECK(context.roster.GetStats().players == 0);
+            }
+
+            AND_WHEN("Another player of the new map sits at the same addresses") {
+                list.names[0] = L"Echo";
+                UpdateFrom(list, context.roster);
+
+                THEN("Its own name is read") {
+                    CHECK(context.roster.GetStats().namesTranscoded == 1);
+                    CHECK(NameOf(context.roster, 10) == "Echo");
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,197 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#include "../Memory/Safety.h"
+#include "../Memory/PageProbeCache.h"
+#include "../Game/SdkStructs.h"
+#include "../Game/Extraction/EntityExtractor.h"
+#include "../Game/Extraction/EntityRecordCache.h"
+#include "../Game/Extraction/ShapeDimensionCache.h"
+#include "../Game/Extraction/PrefetchPipeline.h"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+
+    // Records which objects the pipeline touched, in order
+    struct RecordingObject {
+        static inline std::vector<const void*> prefetched;
+        static inline std::vector<const void*> peeked;
+
+        static void PrefetchHot(const void* object) { prefetched.push_back(object); }
+        static const void* PeekAgent(const void* object) {
+            peeked.push_back(object);
+            return object;
+        }
+    };
+
+    struct RecordingAgent {
+        static inline std::vector<const void*> prefetched;
+
+        static void PrefetchHeader(const void* agent) { prefetched.push_back(agent); }
+    };
+
+    std::vector<kx::SafeAccess::ValidatedSlot> MakeSlots(size_t count) {
+        std::vector<kx::SafeAccess::ValidatedSlot> slots;
+        for (size_t i = 0; i < count; ++i) {
+            slots.push_back({ static_cast<uint32_t>(i), reinterpret_cast<void*>((i + 1) << 12), 0 });
+        }
+        return slots;
+    }
+
+    void ResetRecordings() {
+        RecordingObject::prefetched.clear();
+        RecordingObject::peeked.clear();
+        RecordingAgent::prefetched.clear();
+    }
+
+} // namespace
+
+SCENARIO("The prefetch pipeline requests every object once, ahead of its decode", "[Prefetch]")
+{
+    const std::vector<kx::SafeAccess::ValidatedSlot> slots = MakeSlots(10);
+    ResetRecordings();
+
+    GIVEN("A look-ahead of four slots") {
+        const kx::PrefetchPipeline<RecordingObject, RecordingAgent> pipeline(slots, 4);
+
+        THEN("Construction warms the first four objects") {
+            REQUIRE(RecordingObject::prefetched.size() == 4);
+            CHECK(RecordingObject::prefetched.back() == slots[3].object);
+        }
+
+        WHEN("The whole list is walked") {
+            for (size_t i = 0; i < slots.size(); ++i) {
+                pipeline.Advance(i);
+            }
+
+            THEN("Each object gets its first hop once, in order") {
+                REQUIRE(RecordingObject::prefetched.size() == slots.size());
+                for (size_t i = 0; i < slots.size(); ++i) {
+                    CHECK(RecordingObject::prefetched[i] == slots[i].object);
+                }
+            }
+
+            THEN("The second hop runs two slots ahead and stops at the end of the list") {
+                REQUIRE(RecordingObject::peeked.size() == slots.size() - 2);
+                CHECK(RecordingObject::peeked.front() == slots[2].object);
+                CHECK(RecordingAgent::prefetched == RecordingObject::peeked);
+            }
+        }
+    }
+
+    GIVEN("A look-ahead of zero") {
+        const kx::PrefetchPipeline<RecordingObject, RecordingAgent> pipeline(slots, 0);
+        for (size_t i = 0; i < slots.size(); ++i) {
+            pipeline.Advance(i);
+        }
+
+        THEN("The pipeline is off") {
+            CHECK(RecordingObject::prefetched.empty());
+            CHECK(RecordingObject::peeked.empty());
+        }
+    }
+}
+
+namespace {
+
+    // Synthetic game heap: every entity is a character, its agent, its coordinate system and its
+    // health, each in its own block, the blocks shuffled across a heap larger than the caches
+    constexpr size_t BLOCK_SIZE = 0x400;
+    constexpr size_t BENCH_ENTITIES = 32768;
+    constexpr size_t BLOCKS_PER_ENTITY = 4;
+
+    template<typename T>
+    void Put(std::byte* base, uintptr_t offset, const T& value) {
+        std::memcpy(base + offset, &value, sizeof(T));
+    }
+
+    struct SyntheticHeap {
+        std::vector<std::byte> memory = std::vector<std::byte>(BENCH_ENTITIES * BLOCKS_PER_ENTITY * BLOCK_SIZE);
+        std::vector<kx::SafeAccess::ValidatedSlot> characters;
+
+        explicit SyntheticHeap(uint32_t seed) {
+            std::vector<size_t> blocks(BENCH_ENTITIES * BLOCKS_PER_ENTITY);
+            std::iota(blocks.begin(), blocks.end(), size_t{ 0 });
+            std::shuffle(blocks.begin(), blocks.end(), std::mt19937(seed));
+
+            for (size_t i = 0; i < BENCH_ENTITIES; ++i) {
+                std::byte* character = memory.data() + blocks[i * BLOCKS_PER_ENTITY + 0] * BLOCK_SIZE;
+                std::byte* agent = memory.data() + blocks[i * BLOCKS_PER_ENTITY + 1] * BLOCK_SIZE;
+                std::byte* coChar = memory.data() + blocks[i * BLOCKS_PER_ENTITY + 2] * BLOCK_SIZE;
+                std::byte* health = memory.data() + blocks[i * BLOCKS_PER_ENTITY + 3] * BLOCK_SIZE;
+
+                // Offsets as in the ReClass schemas
+                Put(character, 0x98, agent);
+                Put(character, 0xC0, uint32_t{ 2 });
+                Put(character, 0x3E8, health);
+                Put(agent, 0x08, uint32_t{ 0 }); // AgentType::Character
+                Put(agent, 0x0C, static_cast<int32_t>(i + 1));
+                Put(agent, 0x50, coChar);
+                Put(coChar, 0x30, glm::vec3(1.0f + i, 2.0f, 3.0f));
+                Put(health, 0x0C, 50.0f);
+                Put(health, 0x10, 100.0f);
+
+                characters.push_back({ static_cast<uint32_t>(i), character, 0 });
+            }
+        }
+    };
+
+    // Walk a buffer larger than the last-level cache so every run starts cold
+    void EvictCaches(std::vector<std::byte>& scratch) {
+        for (size_t i = 0; i < scratch.size(); i += kx::FieldSchema::CACHE_LINE_SIZE) {
+            scratch[i] = static_cast<std::byte>(static_cast<uint8_t>(scratch[i]) + 1);
+        }
+    }
+
+} // namespace
+
+// Manual timing: the compact reporter used by the in-game runner does not print BENCHMARK results.
+// Hidden by default; run with the "[benchmark]" tag.
+TEST_CASE("Pipelined character traversal on a randomized heap", "[.][benchmark][Prefetch]")
+{
+    SyntheticHeap heap(91011);
+    std::vector<std::byte> scratch(256u << 20);
+    std::vector<kx::NpcEntity> npcs(BENCH_ENTITIES);
+    kx::EntityRecordCache recordCache;
+    kx::ShapeDimensionCache shapeCache;
+    kx::SafeAccess::PageProbeCache probeCache;
+    kx::SafeAccess::ScopedPageProbeCache probeScope(probeCache);
+
+    auto traverse = [&](uint32_t distance) {
+        probeCache.NextGeneration();
+        recordCache.BeginTick(0);
+        const kx::PrefetchPipeline<kx::ReClass::ChCliCharacter, kx::ReClass::AgChar> pipeline(heap.characters, distance);
+        size_t extracted = 0;
+        for (size_t i = 0; i < heap.characters.size(); ++i) {
+            pipeline.Advance(i);
+            kx::ReClass::ChCliCharacter character(nullptr);
+            character.AdoptValidated(heap.characters[i].object);
+            extracted += kx::EntityExtractor::ExtractNpc(npcs[i], character, recordCache, shapeCache) ? 1 : 0;
+        }
+        return extracted;
+    };
+
+    REQUIRE(traverse(0) == BENCH_ENTITIES); // Warm-up: fills the record cache's stable tier
+
+    for (const uint32_t distance : { 0u, 2u, 4u, 8u, 16u, 32u }) {
+        constexpr int RUNS = 5;
+        uint64_t cycles = 0;
+        for (int run = 0; run < RUNS; ++run) {
+            EvictCaches(scratch);
+            const uint64_t start = __rdtsc();
+            traverse(distance);
+            cycles += __rdtsc() - start;
+        }
+
+        WARN("Prefetch distance " << distance << ": "
+            << static_cast<double>(cycles) / (static_cast<double>(RUNS) * BENCH_ENTITIES) << " cycles per entity");
+    }
+}
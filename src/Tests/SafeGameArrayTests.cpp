@@ -0,0 +1,198 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "GuardedPage.h"
+#include "../Memory/AddressManager.h"
+#include "../Memory/ForeignClass.h"
+#include "../Memory/SafeGameArray.h"
+#include <chrono>
+#include <random>
+#include <vector>
+
+namespace {
+
+    constexpr uint32_t SYNTHETIC_CAPACITY = 2048;
+
+    // Looks like a game object to the validators: the first word is a VTable inside the module
+    struct FakeObject {
+        uintptr_t vtable;
+        uint8_t payload[56];
+    };
+
+    /**
+     * @brief Sparse pointer array in the layout of the game's entity lists
+     *
+     * Occupied slots point at fake objects with an in-module VTable. A few slots hold
+     * decoys the validators must reject: an object with a foreign VTable, a dangling
+     * pointer into an inaccessible page, and an out-of-bounds value.
+     */
+    struct SyntheticArray {
+        std::vector<FakeObject> objects;
+        std::vector<void*> slots;
+        FakeObject foreignObject{};
+        kx::Testing::GuardedPage guardedPage;
+        void* inaccessiblePage = nullptr;
+
+        SyntheticArray(double occupancy, uint32_t seed) : objects(SYNTHETIC_CAPACITY), slots(SYNTHETIC_CAPACITY, nullptr) {
+            const uintptr_t inModuleVTable = kx::AddressManager::GetModuleBase() + 0x1000;
+            foreignObject.vtable = 0x1234;
+
+            if (guardedPage.Data()) {
+                inaccessiblePage = static_cast<char*>(guardedPage.Data()) + kx::Testing::GuardedPage::PAGE_BYTES;
+            }
+
+            std::mt19937 rng(seed);
+            std::bernoulli_distribution occupied(occupancy);
+            for (uint32_t i = 0; i < SYNTHETIC_CAPACITY; ++i) {
+                if (occupied(rng)) {
+                    objects[i].vtable = inModuleVTable;
+                    slots[i] = &objects[i];
+                }
+            }
+
+            slots[1] = &foreignObject;
+            slots[2] = inaccessiblePage;
+            slots[3] = reinterpret_cast<void*>(0x42);
+        }
+
+        kx::SafeAccess::SafeGameArray<kx::ForeignClass> View() {
+            return kx::SafeAccess::SafeGameArray<kx::ForeignClass>(slots.data(), SYNTHETIC_CAPACITY);
+        }
+
+        // Objects the game would report: every occupied slot except the decoys
+        uint32_t Count() const {
+            uint32_t count = 0;
+            for (const void* slot : slots) {
+                if (slot >= objects.data() && slot < objects.data() + objects.size()) ++count;
+            }
+            return count;
+        }
+
+        // One despawn and one spawn at random slots, as between two ticks of a busy map
+        void Churn(std::mt19937& rng) {
+            std::uniform_int_distribution<uint32_t> slot(4, SYNTHETIC_CAPACITY - 1);
+            uint32_t leaving = slot(rng);
+            while (!slots[leaving]) leaving = slot(rng);
+            uint32_t joining = slot(rng);
+            while (slots[joining]) joining = slot(rng);
+            slots[leaving] = nullptr;
+            objects[joining].vtable = kx::AddressManager::GetModuleBase() + 0x1000;
+            slots[joining] = &objects[joining];
+        }
+    };
+
+    template <typename Fn>
+    double AverageMicroseconds(int iterations, Fn&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            fn();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+    }
+
+} // namespace
+
+TEST_CASE("Batched validation matches the per-slot iterator", "[SafeGameArray]")
+{
+    if (kx::AddressManager::GetModuleBase() == 0) {
+        SKIP("Module range not initialized (requires running inside the game)");
+    }
+
+    const double occupancy = GENERATE(0.1, 0.5, 0.9);
+    SyntheticArray array(occupancy, 1234);
+    auto view = array.View();
+
+    std::vector<const void*> expected;
+    for (const auto& object : view) {
+        expected.push_back(object.data());
+    }
+
+    std::vector<const void*> batched;
+    for (const auto& object : view.Validated()) {
+        batched.push_back(object.data());
+    }
+
+    CHECK(batched == expected);
+    for (const void* object : batched) {
+        CHECK(object != &array.foreignObject);
+        CHECK(object != array.inaccessiblePage);
+    }
+}
+
+// Manual timing: the compact reporter used by the in-game runner does not print BENCHMARK results.
+// Hidden by default; run with the "[benchmark]" tag.
+TEST_CASE("SafeGameArray batched validation throughput", "[.][benchmark][SafeGameArray]")
+{
+    if (kx::AddressManager::GetModuleBase() == 0) {
+        SKIP("Module range not initialized (requires running inside the game)");
+    }
+
+    constexpr int ITERATIONS = 200;
+
+    for (const double occupancy : { 0.1, 0.5, 0.9 }) {
+        SyntheticArray array(occupancy, 5678);
+        auto view = array.View();
+
+        size_t sink = 0;
+        const double perSlotUs = AverageMicroseconds(ITERATIONS, [&]() {
+            for (const auto& object : view) {
+                sink += reinterpret_cast<uintptr_t>(object.data()) & 1;
+            }
+        });
+        const double batchedUs = AverageMicroseconds(ITERATIONS, [&]() {
+            for (const auto& object : view.Validated()) {
+                sink += reinterpret_cast<uintptr_t>(object.data()) & 1;
+            }
+        });
+
+        WARN("Occupancy " << static_cast<int>(occupancy * 100) << "% of " << SYNTHETIC_CAPACITY
+            << " slots: per-slot " << perSlotUs << " us, batched " << batchedUs << " us ("
+            << (batchedUs > 0.0 ? perSlotUs / batchedUs : 0.0) << "x), sink " << sink);
+    }
+}
+
+// Manual timing: the compact reporter used by the in-game runner does not print BENCHMARK results.
+// Hidden by default; run with the "[benchmark]" tag.
+TEST_CASE("SafeGameArray slots probed per tick with slot occupancy", "[.][benchmark][SafeGameArray]")
+{
+    if (kx::AddressManager::GetModuleBase() == 0) {
+        SKIP("Module range not initialized (requires running inside the game)");
+    }
+
+    constexpr int TICKS = 300;
+
+    // 2% is a 2048-slot character list holding about 40 characters
+    for (const double occupancy : { 0.02, 0.1, 0.5 }) {
+        SyntheticArray array(occupancy, 4321);
+        std::mt19937 rng(99);
+        kx::SafeAccess::SlotOccupancy tracker;
+
+        size_t sink = 0;
+        uint64_t probed = 0;
+        uint32_t rescans = 0;
+        double fullUs = 0.0;
+        double trackedUs = 0.0;
+        for (int tick = 0; tick < TICKS; ++tick) {
+            array.Churn(rng);
+            const auto view = kx::SafeAccess::SafeGameArray<kx::ForeignClass>(array.slots.data(), SYNTHETIC_CAPACITY, array.Count());
+
+            fullUs += AverageMicroseconds(1, [&]() {
+                for (const auto& object : view.Validated()) {
+                    sink += reinterpret_cast<uintptr_t>(object.data()) & 1;
+                }
+            });
+            trackedUs += AverageMicroseconds(1, [&]() {
+                for (const auto& object : view.Validated(tracker)) {
+                    sink += reinterpret_cast<uintptr_t>(object.data()) & 1;
+                }
+            });
+            probed += tracker.GetStats().probed;
+            rescans += tracker.GetStats().rescanned ? 1 : 0;
+        }
+
+        WARN("Occupancy " << static_cast<int>(occupancy * 100) << "% of " << SYNTHETIC_CAPACITY
+            << " slots, one spawn and one despawn per tick: full scan " << SYNTHETIC_CAPACITY << " slots/tick, "
+            << fullUs / TICKS << " us; occupancy " << static_cast<double>(probed) / TICKS << " slots/tick ("
+            << rescans << " full rescans), " << trackedUs / TICKS << " us; sink " << sink);
+    }
+}
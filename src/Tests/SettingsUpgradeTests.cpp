@@ -0,0 +1,48 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Core/Settings.h"
+
+SCENARIO("Settings files from version 1 keep their tuned ESP update rate", "[Settings]")
+{
+    GIVEN("A version 1 file with a tuned espUpdateRate") {
+        nlohmann::json j = {
+            { "settingsVersion", 1 },
+            { "espUpdateRate", 144.0f },
+            { "autoSaveOnExit", false }
+        };
+
+        WHEN("It is upgraded and loaded") {
+            REQUIRE(kx::UpgradeSettingsJson(j) == kx::CURRENT_SETTINGS_VERSION);
+            kx::Settings settings;
+            j.get_to(settings);
+
+            THEN("Players and NPCs run at the old rate, the rest keep their defaults") {
+                CHECK(settings.extraction.playerRate == 144.0f);
+                CHECK(settings.extraction.npcRate == 144.0f);
+                CHECK(settings.extraction.gadgetRate == kx::ExtractionSettings{}.gadgetRate);
+                CHECK_FALSE(settings.autoSaveOnExit);
+                CHECK_FALSE(j.contains("espUpdateRate"));
+            }
+        }
+    }
+
+    GIVEN("A file of the current version") {
+        kx::Settings saved;
+        saved.extraction.npcRate = 30.0f;
+        nlohmann::json j = saved;
+
+        THEN("The upgrade leaves it alone") {
+            const nlohmann::json before = j;
+            CHECK(kx::UpgradeSettingsJson(j) == kx::CURRENT_SETTINGS_VERSION);
+            CHECK(j == before);
+        }
+    }
+
+    GIVEN("A file without a version") {
+        nlohmann::json j = { { "espUpdateRate", 144.0f } };
+
+        THEN("It is not upgraded") {
+            CHECK(kx::UpgradeSettingsJson(j) != kx::CURRENT_SETTINGS_VERSION);
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Game/Extraction/ExtractionContext.h"
+#include "../Game/Extraction/ShapeDimensionCache.h"
+#include "IdentityAddress.h"
+
+namespace {
+
+    const void* const SHAPE_A = kx::Testing::IdentityAddress(1);
+    const void* const SHAPE_B = kx::Testing::IdentityAddress(2);
+
+    constexpr uint8_t BOX_TAG = static_cast<uint8_t>(kx::Havok::HkcdShapeType::BOX);
+    constexpr uint8_t CYLINDER_TAG = static_cast<uint8_t>(kx::Havok::HkcdShapeType::CYLINDER);
+
+    using Path = kx::ShapeDimensionCache::Path;
+
+} // namespace
+
+SCENARIO("Resolved shape dimensions are reused while the shape's type byte is unchanged", "[ShapeCache]")
+{
+    GIVEN("A cache holding one resolved box shape") {
+        kx::ShapeDimensionCache cache;
+
+        kx::GameEntity resolved;
+        resolved.shapeType = kx::Havok::HkcdShapeType::BOX;
+        resolved.physicsWidth = 1.0f;
+        resolved.physicsDepth = 2.0f;
+        resolved.physicsHeight = 3.0f;
+        resolved.hasPhysicsDimensions = true;
+        cache.Store(SHAPE_A, BOX_TAG, Path::KeyframedRigidBody, resolved);
+
+        THEN("A lookup with the same tag and path copies the dimensions") {
+            kx::GameEntity entity;
+            REQUIRE(cache.TryApply(SHAPE_A, BOX_TAG, Path::KeyframedRigidBody, entity));
+            CHECK(entity.hasPhysicsDimensions);
+            CHECK(entity.shapeType == kx::Havok::HkcdShapeType::BOX);
+            CHECK(entity.physicsWidth == 1.0f);
+            CHECK(entity.physicsDepth == 2.0f);
+            CHECK(entity.physicsHeight == 3.0f);
+            CHECK(cache.GetStats().hits == 1);
+        }
+
+        THEN("A changed type byte, another path or an unknown shape is a miss") {
+            kx::GameEntity entity;
+            CHECK_FALSE(cache.TryApply(SHAPE_A, CYLINDER_TAG, Path::KeyframedRigidBody, entity));
+            CHECK_FALSE(cache.TryApply(SHAPE_A, BOX_TAG, Path::NpcBox, entity));
+            CHECK_FALSE(cache.TryApply(SHAPE_B, BOX_TAG, Path::KeyframedRigidBody, entity));
+            CHECK_FALSE(entity.hasPhysicsDimensions);
+            CHECK(cache.GetStats().misses == 3);
+        }
+
+        WHEN("The cache is cleared on map change") {
+            cache.Clear();
+
+            THEN("The shape is walked again") {
+                kx::GameEntity entity;
+                CHECK_FALSE(cache.TryApply(SHAPE_A, BOX_TAG, Path::KeyframedRigidBody, entity));
+                CHECK(cache.Size() == 0);
+            }
+        }
+    }
+
+    GIVEN("A shape whose resolution failed") {
+        kx::ShapeDimensionCache cache;
+        kx::GameEntity failed;
+        failed.shapeType = kx::Havok::HkcdShapeType::INVALID;
+        cache.Store(SHAPE_A, BOX_TAG, Path::PlayerRigidBody, failed);
+
+        THEN("Nothing is cached, so the next pass retries the walk") {
+            CHECK(cache.Size() == 0);
+        }
+    }
+}
+
+SCENARIO("A map change empties the shape cache of every participant", "[ShapeCache]")
+{
+    GIVEN("Three participants that each resolved a shape on the old map") {
+        kx::ExtractionContext context;
+        context.workers.resize(3);
+
+        kx::GameEntity resolved;
+        resolved.shapeType = kx::Havok::HkcdShapeType::BOX;
+        resolved.hasPhysicsDimensions = true;
+        for (kx::ExtractionWorker& worker : context.workers) {
+            worker.shapeCache.Store(SHAPE_A, BOX_TAG, Path::KeyframedRigidBody, resolved);
+            REQUIRE(worker.shapeCache.Size() == 1);
+        }
+
+        WHEN("The extraction state of the old map is dropped") {
+            context.ClearMapState();
+
+            THEN("No participant can serve the old shape pointer") {
+                for (kx::ExtractionWorker& worker : context.workers) {
+                    kx::GameEntity entity;
+                    CHECK(worker.shapeCache.Size() == 0);
+                    CHECK_FALSE(worker.shapeCache.TryApply(SHAPE_A, BOX_TAG, Path::KeyframedRigidBody, entity));
+                }
+            }
+        }
+    }
+}
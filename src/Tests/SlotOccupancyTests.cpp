@@ -0,0 +1,153 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include <array>
+#include <cstring>
+#include <vector>
+#include "../Memory/SafeGameArray.h"
+#include "FakeProcess.h"
+
+namespace {
+
+    // Fake process layout: a two-page pointer array and one page of objects with an in-module VTable
+    constexpr uintptr_t OBJECT_VTABLE = kx::Testing::MODULE_BASE + 0x3000;
+    constexpr uintptr_t ARRAY_PAGE = 0x7FF700140000;
+    constexpr uintptr_t OBJECT_PAGE = 0x7FF700150000;
+    constexpr uintptr_t OBJECT_STRIDE = 0x20;
+    constexpr uint32_t CAPACITY = 2 * kx::MemoryImage::PAGE_SIZE / sizeof(void*);
+
+    void* ObjectAddress(uint32_t object) {
+        return reinterpret_cast<void*>(OBJECT_PAGE + object * OBJECT_STRIDE);
+    }
+
+    struct FakeList {
+        std::array<void*, CAPACITY> slots{};
+
+        kx::MemoryImage Build() const {
+            std::array<uint8_t, 2 * kx::MemoryImage::PAGE_SIZE> arrayPages{};
+            std::memcpy(arrayPages.data(), slots.data(), sizeof(slots));
+
+            std::array<uint8_t, kx::MemoryImage::PAGE_SIZE> objectPage{};
+            for (size_t offset = 0; offset < objectPage.size(); offset += OBJECT_STRIDE) {
+                std::memcpy(objectPage.data() + offset, &OBJECT_VTABLE, sizeof(OBJECT_VTABLE));
+            }
+
+            kx::MemoryImage image = kx::Testing::MakeProcessImage();
+            image.AddPage(ARRAY_PAGE, arrayPages.data());
+            image.AddPage(ARRAY_PAGE + kx::MemoryImage::PAGE_SIZE, arrayPages.data() + kx::MemoryImage::PAGE_SIZE);
+            image.AddPage(OBJECT_PAGE, objectPage.data());
+            return image;
+        }
+    };
+
+    std::vector<uint32_t> Indices(std::span<const kx::SafeAccess::ValidatedSlot> slots) {
+        std::vector<uint32_t> indices;
+        for (const kx::SafeAccess::ValidatedSlot& slot : slots) {
+            indices.push_back(slot.index);
+        }
+        return indices;
+    }
+
+    // Validates with the tracker and checks the result against a full scan of the same image
+    std::vector<uint32_t> Pass(const FakeList& list, uint32_t count, kx::SafeAccess::SlotOccupancy& occupancy) {
+        return kx::Testing::ReplayPass(list, [&] {
+            std::vector<kx::SafeAccess::ValidatedSlot> expected;
+            kx::SafeAccess::ValidateObjectArray(reinterpret_cast<void**>(ARRAY_PAGE), CAPACITY, expected);
+
+            const std::vector<uint32_t> tracked = Indices(occupancy.Validate(reinterpret_cast<void**>(ARRAY_PAGE), CAPACITY, count));
+            if (count >= expected.size()) {
+                CHECK(tracked == Indices(expected));
+            }
+            return tracked;
+        });
+    }
+
+} // namespace
+
+SCENARIO("Slot occupancy probes last pass's slots first and stops at the reported count", "[SlotOccupancy]")
+{
+    GIVEN("Ten objects scattered over a 1024-slot list") {
+        FakeList list;
+        for (uint32_t i = 0; i < 10; ++i) {
+            list.slots[i * 97 + 5] = ObjectAddress(i);
+        }
+
+        kx::SafeAccess::SlotOccupancy occupancy;
+        Pass(list, 10, occupancy);
+
+        REQUIRE(occupancy.GetStats().found == 10);
+        CHECK(occupancy.GetStats().rescanned);
+        CHECK(occupancy.GetStats().probed == CAPACITY);
+
+        WHEN("The list is unchanged") {
+            Pass(list, 10, occupancy);
+
+            THEN("Only the ten occupied slots are probed") {
+                CHECK(occupancy.GetStats().probed == 10);
+                CHECK(occupancy.GetStats().found == 10);
+                CHECK_FALSE(occupancy.GetStats().rescanned);
+            }
+        }
+
+        WHEN("An object leaves and another takes a slot further down the list") {
+            list.slots[5] = nullptr;
+            list.slots[900] = ObjectAddress(10);
+            const std::vector<uint32_t> found = Pass(list, 10, occupancy);
+
+            THEN("The newcomer is found in array order and the probing stops right after it") {
+                CHECK(found.back() == 900);
+                CHECK(occupancy.GetStats().probed < CAPACITY);
+            }
+        }
+
+        WHEN("The reported count lags behind a newcomer") {
+            list.slots[1000] = ObjectAddress(11);
+            uint32_t passes = 0;
+            std::vector<uint32_t> found;
+            do {
+                found = Pass(list, 10, occupancy);
+                ++passes;
+            } while (found.size() == 10 && passes <= kx::SafeAccess::SlotOccupancy::RESCAN_INTERVAL);
+
+            THEN("The periodic rescan picks it up and the count is no longer trusted") {
+                CHECK(passes <= kx::SafeAccess::SlotOccupancy::RESCAN_INTERVAL);
+                CHECK(found.back() == 1000);
+                CHECK(occupancy.GetStats().rescanned);
+                CHECK_FALSE(occupancy.IsCountTrusted());
+            }
+        }
+
+        WHEN("The game reports fewer objects than the list holds") {
+            Pass(list, 4, occupancy);
+            Pass(list, 4, occupancy);
+
+            THEN("The count is no longer trusted and every slot is probed") {
+                CHECK_FALSE(occupancy.IsCountTrusted());
+                CHECK(occupancy.GetStats().probed == CAPACITY);
+                CHECK(occupancy.GetStats().found == 10);
+            }
+
+            AND_WHEN("The count is right again for long enough") {
+                for (uint32_t pass = 0; pass < kx::SafeAccess::SlotOccupancy::RETRUST_PASSES; ++pass) {
+                    Pass(list, 10, occupancy);
+                }
+                Pass(list, 10, occupancy);
+
+                THEN("Only the occupied slots are probed again") {
+                    CHECK(occupancy.IsCountTrusted());
+                    CHECK(occupancy.GetStats().probed == 10);
+                }
+            }
+
+            AND_WHEN("The map changes") {
+                occupancy.Clear();
+                Pass(list, 10, occupancy);
+                Pass(list, 10, occupancy);
+
+                THEN("The new map starts with a trusted count") {
+                    CHECK(occupancy.IsCountTrusted());
+                    CHECK(occupancy.GetStats().probed == 10);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include "../Game/Extraction/StaticGadgetCache.h"
+#include "IdentityAddress.h"
+
+namespace {
+
+    const void* const GADGET_A = kx::Testing::IdentityAddress(1);
+    void* const AGENT_A = kx::Testing::IdentityAddress(2);
+    const void* const CO_KEYFRAMED_A = kx::Testing::IdentityAddress(3);
+
+    constexpr uint32_t MAP_LIONS_ARCH = 50;
+    constexpr uint32_t MAP_DIVINITYS_REACH = 18;
+
+    kx::GadgetEntity Waypoint() {
+        kx::GadgetEntity gadget;
+        gadget.agent = AGENT_A;
+        gadget.agentId = 1234;
+        gadget.agentType = kx::Game::AgentType::Gadget;
+        gadget.type = kx::Game::GadgetType::Waypoint;
+        gadget.position = glm::vec3(10.0f, 20.0f, 30.0f);
+        gadget.physicsHeight = 4.0f;
+        gadget.hasPhysicsDimensions = true;
+        gadget.shapeType = kx::Havok::HkcdShapeType::BOX;
+        return gadget;
+    }
+
+} // namespace
+
+SCENARIO("Static gadgets keep their position and shape for the lifetime of a map", "[StaticGadgets]")
+{
+    GIVEN("A waypoint stored on Lion's Arch") {
+        kx::StaticGadgetCache cache;
+        cache.BeginPass(MAP_LIONS_ARCH);
+        REQUIRE(kx::StaticGadgetCache::IsStaticType(kx::Game::GadgetType::Waypoint));
+        cache.Store(GADGET_A, kx::StaticGadgetCache::Capture(Waypoint(), CO_KEYFRAMED_A));
+
+        THEN("The entry applies while the gadget read matches it") {
+            const kx::StaticGadgetCache::Entry* entry = cache.Find(GADGET_A);
+            REQUIRE(entry != nullptr);
+            CHECK(entry->Matches(AGENT_A, 1234, kx::Game::AgentType::Gadget, CO_KEYFRAMED_A, kx::Game::GadgetType::Waypoint));
+
+            kx::GadgetEntity gadget;
+            entry->ApplyTo(gadget);
+            CHECK(gadget.position == glm::vec3(10.0f, 20.0f, 30.0f));
+            CHECK(gadget.physicsHeight == 4.0f);
+            CHECK(gadget.hasPhysicsDimensions);
+        }
+
+        THEN("A different agent under the same address does not match") {
+            const kx::StaticGadgetCache::Entry* entry = cache.Find(GADGET_A);
+            REQUIRE(entry != nullptr);
+            CHECK_FALSE(entry->Matches(AGENT_A, 5678, kx::Game::AgentType::Gadget, CO_KEYFRAMED_A, kx::Game::GadgetType::Waypoint));
+            CHECK_FALSE(entry->Matches(AGENT_A, 1234, kx::Game::AgentType::Gadget, nullptr, kx::Game::GadgetType::Waypoint));
+        }
+
+        WHEN("The next pass is on the same map") {
+            cache.BeginPass(MAP_LIONS_ARCH);
+
+            THEN("The entry is kept") {
+                CHECK(cache.Find(GADGET_A) != nullptr);
+            }
+        }
+
+        WHEN("The player travels to another map") {
+            cache.BeginPass(MAP_DIVINITYS_REACH);
+
+            THEN("Every entry is dropped") {
+                CHECK(cache.Find(GADGET_A) == nullptr);
+                CHECK(cache.Size() == 0);
+            }
+        }
+
+        WHEN("MumbleLink no longer reports a map") {
+            cache.BeginPass(0);
+
+            THEN("The cache is disabled") {
+                CHECK_FALSE(cache.IsEnabled());
+                CHECK(cache.Find(GADGET_A) == nullptr);
+                cache.Store(GADGET_A, kx::StaticGadgetCache::Capture(Waypoint(), CO_KEYFRAMED_A));
+                CHECK(cache.Size() == 0);
+            }
+        }
+    }
+
+    GIVEN("Gadget types that can move or animate") {
+        THEN("They are never classified as static") {
+            CHECK_FALSE(kx::StaticGadgetCache::IsStaticType(kx::Game::GadgetType::Door));
+            CHECK_FALSE(kx::StaticGadgetCache::IsStaticType(kx::Game::GadgetType::PlayerCreated));
+            CHECK_FALSE(kx::StaticGadgetCache::IsStaticType(kx::Game::GadgetType::AttackTarget));
+        }
+    }
+}
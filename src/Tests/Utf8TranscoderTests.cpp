@@ -0,0 +1,199 @@
+#include "../../libs/Catch2/catch_amalgamated.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "../Utils/Utf8Transcoder.h"
+#include "GuardedPage.h"
+
+using kx::Utf8::SimdLevel;
+
+namespace {
+
+    constexpr SimdLevel LEVELS[] = { SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2 };
+
+    // Straightforward decoder: one code point at a time, unpaired surrogates become U+FFFD.
+    // Truncates to the longest whole-code-point prefix that fits in capacity - 1 bytes.
+    std::string Reference(const std::u16string& source, size_t capacity) {
+        std::string result;
+        for (size_t i = 0; i < source.size(); ++i) {
+            uint32_t cp = source[i];
+            if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < source.size() && source[i + 1] >= 0xDC00 && source[i + 1] <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (source[++i] - 0xDC00);
+            } else if (cp >= 0xD800 && cp <= 0xDFFF) {
+                cp = 0xFFFD;
+            }
+
+            std::string encoded;
+            if (cp < 0x80) {
+                encoded += static_cast<char>(cp);
+            } else if (cp < 0x800) {
+                encoded += static_cast<char>(0xC0 | (cp >> 6));
+                encoded += static_cast<char>(0x80 | (cp & 0x3F));
+            } else if (cp < 0x10000) {
+                encoded += static_cast<char>(0xE0 | (cp >> 12));
+                encoded += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                encoded += static_cast<char>(0x80 | (cp & 0x3F));
+            } else {
+                encoded += static_cast<char>(0xF0 | (cp >> 18));
+                encoded += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                encoded += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                encoded += static_cast<char>(0x80 | (cp & 0x3F));
+            }
+
+            if (result.size() + encoded.size() > capacity - 1) {
+                break;
+            }
+            result += encoded;
+        }
+        return result;
+    }
+
+    std::string Transcode(const char16_t* source, size_t capacity, SimdLevel level) {
+        std::vector<char> buffer(capacity, '\x7F');
+        const size_t written = kx::Utf8::WriteUTF16ToUTF8(source, buffer, level);
+        REQUIRE(written < capacity);
+        REQUIRE(buffer[written] == '\0');
+        return std::string(buffer.data(), written);
+    }
+
+    // Mixes ASCII runs with every other class of code unit, weighted towards the ASCII fast path
+    std::u16string RandomString(std::mt19937& rng, size_t length) {
+        std::uniform_int_distribution<int> kind(0, 9);
+        std::u16string result;
+        while (result.size() < length) {
+            switch (kind(rng)) {
+            case 0: result += static_cast<char16_t>(std::uniform_int_distribution<int>(0x80, 0x7FF)(rng)); break;
+            case 1: result += static_cast<char16_t>(std::uniform_int_distribution<int>(0x800, 0xD7FF)(rng)); break;
+            case 2: // Surrogate pair
+                result += static_cast<char16_t>(std::uniform_int_distribution<int>(0xD800, 0xDBFF)(rng));
+                result += static_cast<char16_t>(std::uniform_int_distribution<int>(0xDC00, 0xDFFF)(rng));
+                break;
+            case 3: result += static_cast<char16_t>(std::uniform_int_distribution<int>(0xD800, 0xDFFF)(rng)); break;
+            case 4: result += static_cast<char16_t>(std::uniform_int_distribution<int>(0xE000, 0xFFFF)(rng)); break;
+            default:
+                for (int n = std::uniform_int_distribution<int>(1, 24)(rng); n > 0; --n) {
+                    result += static_cast<char16_t>(std::uniform_int_distribution<int>(1, 0x7F)(rng));
+                }
+                break;
+            }
+        }
+        return result;
+    }
+
+} // namespace
+
+TEST_CASE("UTF-16 to UTF-8 conversion of names", "[Utf8]")
+{
+    for (const SimdLevel level : LEVELS) {
+        CAPTURE(static_cast<int>(level));
+        CHECK(Transcode(u"Zojja Ardentfire", 64, level) == "Zojja Ardentfire");
+        CHECK(Transcode(u"Ælfrïc Dûrandel", 64, level) == "\xC3\x86lfr\xC3\xAF" "c D\xC3\xBBrandel");
+        CHECK(Transcode(u"黒い剣士", 64, level) == "\xE9\xBB\x92\xE3\x81\x84\xE5\x89\xA3\xE5\xA3\xAB");
+        CHECK(Transcode(u"Ranger \U0001F3F9", 64, level) == "Ranger \xF0\x9F\x8F\xB9");
+        CHECK(Transcode(u"", 64, level).empty());
+
+        const char16_t loneSurrogates[] = { u'a', 0xDC00, u'b', 0xD800, 0 };
+        CHECK(Transcode(loneSurrogates, 64, level) == "a\xEF\xBF\xBD" "b\xEF\xBF\xBD");
+    }
+
+    char buffer[8] = { 'x' };
+    CHECK(kx::Utf8::WriteUTF16ToUTF8(nullptr, buffer) == 0);
+    CHECK(buffer[0] == '\0');
+    CHECK(kx::Utf8::WriteUTF16ToUTF8(u"abc", std::span<char>()) == 0);
+}
+
+TEST_CASE("UTF-16 to UTF-8 truncation never splits a code point", "[Utf8]")
+{
+    for (const SimdLevel level : LEVELS) {
+        CAPTURE(static_cast<int>(level));
+        CHECK(Transcode(u"Zojja Ardentfire of the Priory", 17, level) == "Zojja Ardentfire");
+        CHECK(Transcode(u"abcé", 5, level) == "abc"); // é needs 2 bytes, 1 is left
+        CHECK(Transcode(u"ab\U0001F3F9", 6, level) == "ab");
+        CHECK(Transcode(u"abc", 1, level).empty());
+    }
+}
+
+TEST_CASE("UTF-16 to UTF-8 matches the reference decoder on random input", "[Utf8]")
+{
+    std::mt19937 rng(20240521);
+    std::uniform_int_distribution<size_t> lengths(0, 96);
+    std::uniform_int_distribution<size_t> capacities(1, 160);
+
+    for (int iteration = 0; iteration < 2000; ++iteration) {
+        const std::u16string source = RandomString(rng, lengths(rng));
+        const size_t capacity = capacities(rng);
+        const std::string expected = Reference(source, capacity);
+        for (const SimdLevel level : LEVELS) {
+            INFO("iteration " << iteration << ", capacity " << capacity << ", level " << static_cast<int>(level));
+            REQUIRE(Transcode(source.c_str(), capacity, level) == expected);
+        }
+    }
+}
+
+TEST_CASE("UTF-16 to UTF-8 reads up to the end of a page, not past it", "[Utf8]")
+{
+    // A readable page followed by an inaccessible one: reading past the terminator faults
+    constexpr size_t PAGE_UNITS = kx::Testing::GuardedPage::PAGE_BYTES / sizeof(char16_t);
+    const kx::Testing::GuardedPage pages;
+    REQUIRE(pages.Data() != nullptr);
+    char16_t* const page = static_cast<char16_t*>(pages.Data());
+    std::mt19937 rng(7);
+
+    for (size_t length = 0; length < 40; ++length) {
+        // The terminator is the last unit of the readable page
+        const std::u16string source = RandomString(rng, length).substr(0, length);
+        char16_t* start = page + PAGE_UNITS - 1 - source.size();
+        std::fill(page, page + PAGE_UNITS, u'\xFFFF');
+        std::copy(source.begin(), source.end(), start);
+        start[source.size()] = 0;
+
+        for (const SimdLevel level : LEVELS) {
+            CAPTURE(length, static_cast<int>(level));
+            REQUIRE(Transcode(start, 256, level) == Reference(source, 256));
+        }
+    }
+}
+
+// Manual timing: the compact reporter used by the in-game runner does not print BENCHMARK results.
+// Hidden by default; run with the "[benchmark]" tag.
+TEST_CASE("UTF-16 to UTF-8 throughput on name corpora", "[.][benchmark][Utf8]")
+{
+    struct Corpus {
+        const char* label;
+        std::vector<std::u16string> names;
+    };
+
+    // Character names as they show up in a busy map: mostly ASCII on EU/NA, Latin-1 accents, CJK on the Chinese client
+    const Corpus corpora[] = {
+        { "ASCII", { u"Zojja Ardentfire", u"Kasmeer Meade", u"Rytlock Brimstone", u"Logan Thackeray", u"Braham Eirsson",
+                     u"Taimi Of Rata Sum", u"Canach The Sylvari", u"Marjory Delaqua", u"Eir Stegalkin", u"Caithe Of Ventry" } },
+        { "Accented", { u"Ælfrïc Dûrandel", u"Séverine Lafêt", u"Jöran Ødegård", u"Príncipe Ñandú", u"Zoë Brontë",
+                        u"Ðaria Þórsdóttir", u"Łukasz Wąsik", u"Renée Façade", u"Über Kräuter", u"Çelik Dönmez" } },
+        { "CJK", { u"黒い影の剣士", u"风之守护者", u"龙焰猎人", u"星辰法师", u"青龍の騎士",
+                   u"月下独酌", u"铁血战士", u"白銀の弓手", u"幽灵刺客", u"天空守望" } },
+    };
+
+    constexpr int ITERATIONS = 20000;
+    char buffer[64];
+
+    for (const Corpus& corpus : corpora) {
+        for (const SimdLevel level : LEVELS) {
+            size_t sink = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                for (const std::u16string& name : corpus.names) {
+                    sink += kx::Utf8::WriteUTF16ToUTF8(name.c_str(), buffer, level);
+                }
+            }
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            const double perNameNs = std::chrono::duration<double, std::nano>(elapsed).count() / (ITERATIONS * corpus.names.size());
+
+            WARN(corpus.label << ", level " << static_cast<int>(level) << " (best " << static_cast<int>(kx::Utf8::GetSimdLevel())
+                << "): " << perNameNs << " ns/name, sink " << sink);
+        }
+    }
+}
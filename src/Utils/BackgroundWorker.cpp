@@ -0,0 +1,78 @@
+#include "BackgroundWorker.h"
+#include "DebugLogger.h"
+
+namespace kx {
+
+BackgroundWorker::~BackgroundWorker() {
+    Stop();
+}
+
+void BackgroundWorker::Start(std::function<void()> job) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_thread.joinable()) return;
+
+    m_job = std::move(job);
+    m_state.store(State::Idle, std::memory_order_relaxed);
+    try {
+        m_thread = std::thread(&BackgroundWorker::ThreadLoop, this);
+        m_running.store(true, std::memory_order_release);
+    }
+    catch (const std::exception& e) {
+        LOG_ERROR("[BackgroundWorker] Failed to spawn thread: %s", e.what());
+    }
+}
+
+void BackgroundWorker::Stop() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_thread.joinable()) return;
+
+    WaitIdle();
+    m_running.store(false, std::memory_order_release);
+    m_state.store(State::Stopping, std::memory_order_release);
+    m_state.notify_all();
+    m_thread.join();
+    m_state.store(State::Idle, std::memory_order_relaxed);
+}
+
+bool BackgroundWorker::TryKick() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_thread.joinable()) return false;
+
+    State expected = State::Idle;
+    if (!m_state.compare_exchange_strong(expected, State::Busy, std::memory_order_acq_rel)) {
+        return false;
+    }
+    m_state.notify_all();
+    return true;
+}
+
+void BackgroundWorker::WaitIdle() const {
+    for (State state = m_state.load(std::memory_order_acquire); state == State::Busy;
+         state = m_state.load(std::memory_order_acquire)) {
+        m_state.wait(state, std::memory_order_acquire);
+    }
+}
+
+void BackgroundWorker::ThreadLoop() {
+    for (;;) {
+        m_state.wait(State::Idle, std::memory_order_acquire);
+        if (m_state.load(std::memory_order_acquire) == State::Stopping) {
+            return;
+        }
+
+        try {
+            m_job();
+        }
+        catch (const std::exception& e) {
+            LOG_ERROR("[BackgroundWorker] Job failed: %s", e.what());
+        }
+        catch (...) {
+            LOG_ERROR("[BackgroundWorker] Job failed with an unknown exception");
+        }
+
+        m_state.store(State::Idle, std::memory_order_release);
+        m_state.notify_all();
+    }
+}
+
+} // namespace kx
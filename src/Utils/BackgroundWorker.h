@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace kx {
+
+/**
+ * @brief One dedicated thread that runs a fixed job each time it is kicked
+ *
+ * The owner kicks the job and returns immediately; a kick while the previous run is
+ * still going is refused rather than queued. The thread sleeps on an atomic wait
+ * between runs. Completion publishes everything the job wrote (release/acquire on
+ * the state), so the owner may read the job's results once IsBusy() returns false.
+ */
+class BackgroundWorker {
+public:
+    BackgroundWorker() = default;
+    ~BackgroundWorker();
+
+    BackgroundWorker(const BackgroundWorker&) = delete;
+    BackgroundWorker& operator=(const BackgroundWorker&) = delete;
+
+    /**
+     * @brief Spawn the thread with the job it will run on every kick. No-op if already running.
+     */
+    void Start(std::function<void()> job);
+
+    /**
+     * @brief Wait for the current run to finish and join the thread
+     * @note Must not be called from DllMain: joining threads under the loader lock deadlocks.
+     */
+    void Stop();
+
+    /**
+     * @brief Start one run of the job
+     * @return false if the thread is not running or the previous run has not finished
+     */
+    bool TryKick();
+
+    /**
+     * @brief Block until the current run (if any) has finished
+     */
+    void WaitIdle() const;
+
+    [[nodiscard]] bool IsRunning() const { return m_running.load(std::memory_order_acquire); }
+    [[nodiscard]] bool IsBusy() const { return m_state.load(std::memory_order_acquire) == State::Busy; }
+
+private:
+    enum class State : uint32_t { Idle, Busy, Stopping };
+
+    void ThreadLoop();
+
+    std::mutex m_mutex; // Serializes Start(), Stop() and TryKick()
+    std::thread m_thread;
+    std::function<void()> m_job;
+    std::atomic<State> m_state{ State::Idle };
+    std::atomic<bool> m_running{ false };
+};
+
+} // namespace kx
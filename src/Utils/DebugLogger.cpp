@@ -1,4 +1,5 @@
 #include "DebugLogger.h"
+#include "../Core/AppState.h"
 #include "../Core/Settings.h"
 #include "Config.h"
 #include <iostream>
@@ -17,32 +18,6 @@ std::shared_ptr<spdlog::logger> Logger::s_logger = nullptr;
 std::atomic<Logger::Level> Logger::s_minLogLevel{static_cast<Level>(AppConfig::DEFAULT_LOG_LEVEL)};
 std::shared_ptr<spdlog::sinks::ringbuffer_sink_mt> Logger::s_ringbuffer_sink = nullptr;
 
-/**
- * @brief Get the path for the log file
- * @return Path to the log file in the executable directory
- */
-std::string Logger::GetLogFilePath() noexcept {
-    try {
-        char exePath[MAX_PATH];
-        DWORD pathLen = GetModuleFileNameA(NULL, exePath, MAX_PATH);
-        if (pathLen == 0 || pathLen >= MAX_PATH) {
-            return "kx-vision_debug.log"; // Fallback to current directory
-        }
-        
-        // Find the last backslash to get directory
-        std::string executablePath(exePath);
-        size_t lastSlash = executablePath.find_last_of("\\/");
-        if (lastSlash != std::string::npos) {
-            return executablePath.substr(0, lastSlash + 1) + "kx-vision_debug.log";
-        }
-        
-        return "kx-vision_debug.log"; // Fallback
-    }
-    catch (...) {
-        return "kx-vision_debug.log"; // Fallback
-    }
-}
-
 /**
  * @brief Convert our log level to spdlog level
  * @param level Our internal log level
@@ -82,8 +57,7 @@ void Logger::Initialize() noexcept {
         // Console sink with colors (Debug builds only)
         // Check if console is available before creating console sink
 #ifdef _DEBUG
-        HWND consoleWindow = GetConsoleWindow();
-        if (consoleWindow != NULL) {
+        if (HasConsole()) {
             try {
                 auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
                 console_sink->set_level(spdlog::level::debug);
@@ -184,8 +158,7 @@ void Logger::Reinitialize() noexcept {
         
         // Check if console is now available and rebuild logger if needed
 #ifdef _DEBUG
-        HWND consoleWindow = GetConsoleWindow();
-        if (consoleWindow != NULL) {
+        if (HasConsole()) {
             // Check if we already have a console sink
             bool hasConsoleSink = false;
             for (auto& sink : s_logger->sinks()) {
@@ -1,15 +1,15 @@
 #pragma once
 
 #include <string>
-#include <format>
 #include <memory>
 #include <atomic>
-#include <Windows.h>
+#include <cstdio>
+#include <sstream>
+#include <vector>
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/ringbuffer_sink.h>
-#include "../Core/AppState.h"
 #include "../Memory/Safety.h"
 
 namespace kx {
@@ -43,7 +43,9 @@ private:
     static std::shared_ptr<spdlog::sinks::ringbuffer_sink_mt> s_ringbuffer_sink;
     
     // Helper methods
+    // Platform parts: DebugLoggerWin32.cpp / DebugLoggerPosix.cpp
     static std::string GetLogFilePath() noexcept;
+    static bool HasConsole() noexcept;
     static spdlog::level::level_enum ConvertLevel(Level level) noexcept;
 
 public:
@@ -92,7 +94,6 @@ public:
     static void Log(Level level, const std::string& message) noexcept;
     
     // Helper function to format printf-style strings (legacy compatibility)
-    // NOTE: For new code in C++23, prefer using std::format directly instead of printf-style formatting
     template<typename... Args>
     static std::string FormatPrintf(const char* format, Args&&... args) noexcept {
         try {
@@ -111,17 +112,6 @@ public:
         }
     }
     
-    // Modern C++23 formatting (preferred for new code)
-    template<typename... Args>
-    static std::string Format(std::format_string<Args...> fmt, Args&&... args) noexcept {
-        try {
-            return std::format(fmt, std::forward<Args>(args)...);
-        }
-        catch (...) {
-            return std::string("LOG FORMAT ERROR");
-        }
-    }
-    
     // Formatted logging functions (printf-style) - accepts const char*
     template<typename... Args>
     static void LogFormatted(Level level, const char* format, Args&&... args) noexcept {
@@ -274,7 +264,7 @@ public:
 #define LOG_PRINT_LEVEL() kx::Debug::Logger::PrintCurrentLogLevel()
 
 /**
- * @brief Safe memory read implementation without C++ objects for exception safety
+ * @brief Safe memory read implementation (fault-guarded copy, see SafeAccess::RawSafeCopy)
  * @tparam T Type to read from memory
  * @param address Memory address to read from
  * @param result Reference to store the result
@@ -282,13 +272,10 @@ public:
  */
 template<typename T>
 inline bool SafeReadImpl(uintptr_t address, T& result) noexcept {
-    __try {
-        result = *reinterpret_cast<const T*>(address);
-        return true;
-    }
-    __except (EXCEPTION_EXECUTE_HANDLER) {
-        return false;
+    if (!MemorySource::IsLive()) {
+        return MemorySource::ReadBytes(address, &result, sizeof(T));
     }
+    return SafeAccess::RawSafeCopy(address, &result, sizeof(T));
 }
 
 /**
@@ -0,0 +1,27 @@
+#ifndef _WIN32
+
+#include <unistd.h> // For isatty
+#include "DebugLogger.h"
+
+namespace kx {
+namespace Debug {
+
+/**
+ * @brief Get the path for the log file
+ * @return Log file in the current directory (headless runs: replay, tests)
+ */
+std::string Logger::GetLogFilePath() noexcept {
+    return "kx-vision_debug.log";
+}
+
+/**
+ * @brief Check if stdout is a terminal (console sink is only added then)
+ */
+bool Logger::HasConsole() noexcept {
+    return isatty(STDOUT_FILENO) != 0;
+}
+
+} // namespace Debug
+} // namespace kx
+
+#endif // !_WIN32
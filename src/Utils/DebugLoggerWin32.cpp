@@ -0,0 +1,45 @@
+#ifdef _WIN32
+
+#include <windows.h>
+#include "DebugLogger.h"
+
+namespace kx {
+namespace Debug {
+
+/**
+ * @brief Get the path for the log file
+ * @return Path to the log file in the executable directory
+ */
+std::string Logger::GetLogFilePath() noexcept {
+    try {
+        char exePath[MAX_PATH];
+        DWORD pathLen = GetModuleFileNameA(NULL, exePath, MAX_PATH);
+        if (pathLen == 0 || pathLen >= MAX_PATH) {
+            return "kx-vision_debug.log"; // Fallback to current directory
+        }
+        
+        // Find the last backslash to get directory
+        std::string executablePath(exePath);
+        size_t lastSlash = executablePath.find_last_of("\\/");
+        if (lastSlash != std::string::npos) {
+            return executablePath.substr(0, lastSlash + 1) + "kx-vision_debug.log";
+        }
+        
+        return "kx-vision_debug.log"; // Fallback
+    }
+    catch (...) {
+        return "kx-vision_debug.log"; // Fallback
+    }
+}
+
+/**
+ * @brief Check if a console window is attached (console sink is only added then)
+ */
+bool Logger::HasConsole() noexcept {
+    return GetConsoleWindow() != NULL;
+}
+
+} // namespace Debug
+} // namespace kx
+
+#endif // _WIN32
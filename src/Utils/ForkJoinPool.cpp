@@ -0,0 +1,102 @@
+#include "ForkJoinPool.h"
+#include "DebugLogger.h"
+
+namespace kx {
+
+ForkJoinPool::~ForkJoinPool() {
+    JoinAll();
+}
+
+void ForkJoinPool::Resize(size_t workerCount) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (workerCount == m_threads.size()) return;
+
+    JoinAll();
+
+    m_stop.store(false, std::memory_order_relaxed);
+    m_threads.reserve(workerCount);
+    // Workers start from the current epoch, so a Run() issued before they are scheduled is not missed
+    const uint32_t startEpoch = m_epoch.load(std::memory_order_relaxed);
+    try {
+        for (size_t i = 0; i < workerCount; ++i) {
+            m_threads.emplace_back(&ForkJoinPool::WorkerLoop, this, i + 1, startEpoch);
+        }
+    }
+    catch (const std::exception& e) {
+        LOG_ERROR("[ForkJoinPool] Failed to spawn worker %zu of %zu: %s", m_threads.size() + 1, workerCount, e.what());
+    }
+    m_workerCount.store(m_threads.size(), std::memory_order_relaxed);
+}
+
+void ForkJoinPool::JoinAll() {
+    if (m_threads.empty()) return;
+
+    m_stop.store(true, std::memory_order_relaxed);
+    m_epoch.fetch_add(1, std::memory_order_release);
+    m_epoch.notify_all();
+    for (auto& thread : m_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    m_threads.clear();
+    m_workerCount.store(0, std::memory_order_relaxed);
+}
+
+size_t ForkJoinPool::RunLocked(Trampoline trampoline, void* context) {
+    const size_t workers = m_threads.size();
+    if (workers == 0) {
+        trampoline(context, 0);
+        return 1;
+    }
+
+    m_trampoline = trampoline;
+    m_context = context;
+    m_remaining.store(static_cast<uint32_t>(workers), std::memory_order_relaxed);
+    m_epoch.fetch_add(1, std::memory_order_release);
+    m_epoch.notify_all();
+
+    auto waitForWorkers = [this]() {
+        for (uint32_t remaining = m_remaining.load(std::memory_order_acquire); remaining != 0;
+             remaining = m_remaining.load(std::memory_order_acquire)) {
+            m_remaining.wait(remaining, std::memory_order_acquire);
+        }
+    };
+
+    try {
+        trampoline(context, 0);
+    }
+    catch (...) {
+        // Workers still reference the caller's stack: let them finish before unwinding
+        waitForWorkers();
+        throw;
+    }
+    waitForWorkers();
+    return workers + 1;
+}
+
+void ForkJoinPool::WorkerLoop(size_t participant, uint32_t seenEpoch) {
+    for (;;) {
+        m_epoch.wait(seenEpoch, std::memory_order_acquire);
+        seenEpoch = m_epoch.load(std::memory_order_acquire);
+        if (m_stop.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        try {
+            m_trampoline(m_context, participant);
+        }
+        catch (const std::exception& e) {
+            LOG_ERROR("[ForkJoinPool] Worker %zu job failed: %s", participant, e.what());
+        }
+        catch (...) {
+            LOG_ERROR("[ForkJoinPool] Worker %zu job failed with an unknown exception", participant);
+        }
+
+        if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            m_remaining.notify_one();
+        }
+    }
+}
+
+} // namespace kx
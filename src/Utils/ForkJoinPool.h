@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace kx {
+
+/**
+ * @brief Small pool of pre-spawned threads that run one fork-join job at a time
+ *
+ * Run() wakes every worker, runs the job on the calling thread as participant 0,
+ * then blocks until all workers have finished. Workers sleep on an atomic wait
+ * between jobs, so an idle pool costs nothing.
+ *
+ * Built for the Game Thread detour: the game is already parked while extraction
+ * runs, so splitting the work shortens the stall without adding any latency.
+ */
+class ForkJoinPool {
+public:
+    ForkJoinPool() = default;
+    ~ForkJoinPool();
+
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+
+    /**
+     * @brief Join all current workers and spawn a new set
+     * @param workerCount Number of extra threads (0 = run everything on the caller)
+     * @note Must not be called from DllMain: joining threads under the loader lock deadlocks.
+     */
+    void Resize(size_t workerCount);
+
+    [[nodiscard]] size_t GetWorkerCount() const { return m_workerCount.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Run a job on the caller and every worker, and wait for all of them
+     * @param job Callable as job(size_t participantIndex); index 0 is the caller,
+     *            1..GetWorkerCount() are the workers.
+     * @return Number of participants that ran the job
+     */
+    template <typename Job>
+    size_t Run(Job&& job) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto invoke = [](void* context, size_t participant) {
+            (*static_cast<std::remove_reference_t<Job>*>(context))(participant);
+        };
+        return RunLocked(invoke, &job);
+    }
+
+private:
+    using Trampoline = void (*)(void* context, size_t participant);
+
+    size_t RunLocked(Trampoline trampoline, void* context);
+    void WorkerLoop(size_t participant, uint32_t seenEpoch);
+    void JoinAll();
+
+    std::mutex m_mutex; // Serializes Run() and Resize()
+    std::vector<std::thread> m_threads;
+    std::atomic<size_t> m_workerCount{ 0 };
+
+    // Current job, published to workers by bumping m_epoch
+    Trampoline m_trampoline = nullptr;
+    void* m_context = nullptr;
+    std::atomic<uint32_t> m_epoch{ 0 };
+    std::atomic<uint32_t> m_remaining{ 0 };
+    std::atomic<bool> m_stop{ false };
+};
+
+} // namespace kx
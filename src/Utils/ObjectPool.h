@@ -1,9 +1,52 @@
 #pragma once
 #include <vector>
+#include <algorithm>
 #include "DebugLogger.h"
 
 namespace kx {
 
+/**
+ * @brief Disjoint sub-range of an ObjectPool with its own cursor
+ *
+ * Lets several threads check objects out of one pool without synchronization:
+ * each thread gets a slice covering different objects. Get() has the same
+ * reconstruction semantics as ObjectPool::Get().
+ */
+template<typename T>
+class ObjectPoolSlice {
+private:
+    T* m_begin = nullptr;
+    T* m_end = nullptr;
+    T* m_next = nullptr;
+
+public:
+    ObjectPoolSlice() = default;
+    ObjectPoolSlice(T* begin, T* end) : m_begin(begin), m_end(end), m_next(begin) {}
+
+    /**
+     * @brief Get a freshly-constructed object from the slice, or nullptr if the slice is exhausted
+     */
+    T* Get() {
+        if (m_next >= m_end) {
+            LOG_WARN("ObjectPoolSlice<%s> exhausted: slice size: %zu",
+                    typeid(T).name(), Size());
+            return nullptr;
+        }
+        T* obj = m_next++;
+        obj->~T();
+        new (obj) T();
+        return obj;
+    }
+
+    size_t Size() const {
+        return static_cast<size_t>(m_end - m_begin);
+    }
+
+    size_t Used() const {
+        return static_cast<size_t>(m_next - m_begin);
+    }
+};
+
 /**
  * @brief Simple object pool to eliminate heap allocations in main loops
  * 
@@ -65,6 +108,18 @@ public:
         m_nextAvailable = 0;
     }
 
+    /**
+     * @brief Carve out the objects [begin, end) as an independently consumed slice
+     *
+     * Both bounds are clamped to the pool size. Slices of one pool must not overlap,
+     * and must not be mixed with Get() between two Reset() calls.
+     */
+    ObjectPoolSlice<T> Slice(size_t begin, size_t end) {
+        end = (std::min)(end, m_pool.size());
+        begin = (std::min)(begin, end);
+        return ObjectPoolSlice<T>(m_pool.data() + begin, m_pool.data() + end);
+    }
+
     /**
      * @brief Get the total size of the pool
      */
@@ -0,0 +1,276 @@
+#include "Utf8Transcoder.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define KX_UTF8_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define KX_UTF8_TARGET_AVX2
+#else
+#define KX_UTF8_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define KX_UTF8_X86 0
+#endif
+
+namespace kx::Utf8 {
+
+namespace {
+
+    constexpr uintptr_t PAGE_SIZE = 0x1000;
+    constexpr char32_t REPLACEMENT = 0xFFFD;
+
+    bool IsAsciiUnit(uint32_t unit) {
+        return unit - 1 < 0x7F; // [1, 0x7F]: the terminator is not part of a run
+    }
+
+    // A vector load of `bytes` at `source` must not touch the next page, which may be unmapped
+    bool BlockStaysInPage(const void* source, uintptr_t bytes) {
+        return (reinterpret_cast<uintptr_t>(source) & (PAGE_SIZE - 1)) <= PAGE_SIZE - bytes;
+    }
+
+    // Writes one code point if it fits in `room` bytes; returns the bytes written, 0 if it does not fit
+    size_t EncodeCodePoint(char32_t cp, char* out, size_t room) {
+        if (cp < 0x80) {
+            if (room < 1) return 0;
+            out[0] = static_cast<char>(cp);
+            return 1;
+        }
+        if (cp < 0x800) {
+            if (room < 2) return 0;
+            out[0] = static_cast<char>(0xC0 | (cp >> 6));
+            out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 2;
+        }
+        if (cp < 0x10000) {
+            if (room < 3) return 0;
+            out[0] = static_cast<char>(0xE0 | (cp >> 12));
+            out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 3;
+        }
+        if (room < 4) return 0;
+        out[0] = static_cast<char>(0xF0 | (cp >> 18));
+        out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 4;
+    }
+
+    // Units of an ASCII run copied one at a time before the vector loop takes over. Runs between
+    // accents are a few units long: a vector block costs more than it saves on those.
+    constexpr size_t SCALAR_LEAD = 8;
+
+    // ASCII run, one unit at a time; stops at anything else or when the buffer is full
+    void ScalarAscii(const char16_t*& source, char*& out, const char* end) {
+        while (out < end && IsAsciiUnit(*source)) {
+            *out++ = static_cast<char>(*source++);
+        }
+    }
+
+    // Like ScalarAscii(), but stops after `limit` units; returns true if the run may go on
+    bool ScalarAsciiLead(const char16_t*& source, char*& out, const char* end, size_t limit) {
+        for (size_t copied = 0; copied < limit; ++copied) {
+            if (out >= end || !IsAsciiUnit(*source)) {
+                return false;
+            }
+            *out++ = static_cast<char>(*source++);
+        }
+        return true;
+    }
+
+    // Non-ASCII run up to the next ASCII unit; false at the terminator or when the next code point does not fit
+    bool ScalarRun(const char16_t*& source, char*& out, const char* end) {
+        do {
+            const char16_t unit = *source;
+            if (unit == 0) {
+                return false;
+            }
+
+            char32_t cp = unit;
+            size_t units = 1;
+            if (unit >= 0xD800 && unit <= 0xDFFF) {
+                const char16_t next = source[1]; // Terminator at worst
+                if (unit <= 0xDBFF && next >= 0xDC00 && next <= 0xDFFF) {
+                    cp = 0x10000 + ((static_cast<char32_t>(unit) - 0xD800) << 10) + (next - 0xDC00);
+                    units = 2;
+                } else {
+                    cp = REPLACEMENT;
+                }
+            }
+
+            const size_t written = EncodeCodePoint(cp, out, static_cast<size_t>(end - out));
+            if (written == 0) {
+                return false;
+            }
+            source += units;
+            out += written;
+        } while (!IsAsciiUnit(*source));
+        return true;
+    }
+
+#if KX_UTF8_X86
+    // 8 units per block. Stores the whole narrowed block even when only a prefix is ASCII:
+    // the extra bytes stay inside the buffer and are overwritten or follow the terminator.
+    void Sse2Ascii(const char16_t*& source, char*& out, const char* end) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i limit = _mm_set1_epi16(0x80);
+        while (end - out >= 8) {
+            if (!BlockStaysInPage(source, 16)) {
+                if (!IsAsciiUnit(*source)) return;
+                *out++ = static_cast<char>(*source++);
+                continue;
+            }
+
+            const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+            // Signed compares: units >= 0x8000 are negative and fail the first test
+            const __m128i ascii = _mm_and_si128(_mm_cmpgt_epi16(units, zero), _mm_cmplt_epi16(units, limit));
+            const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(ascii));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(units, units));
+            if (mask != 0xFFFF) {
+                const size_t prefix = static_cast<size_t>(std::countr_one(mask)) / 2;
+                source += prefix;
+                out += prefix;
+                return;
+            }
+            source += 8;
+            out += 8;
+        }
+    }
+
+    // 16 units per block; hands the tail to the SSE2 loop once fewer than 16 bytes are left
+    KX_UTF8_TARGET_AVX2 void Avx2Ascii(const char16_t*& source, char*& out, const char* end) {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i limit = _mm256_set1_epi16(0x80);
+        while (end - out >= 16) {
+            if (!BlockStaysInPage(source, 32)) {
+                if (!IsAsciiUnit(*source)) return;
+                *out++ = static_cast<char>(*source++);
+                continue;
+            }
+
+            const __m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+            const __m256i ascii = _mm256_and_si256(_mm256_cmpgt_epi16(units, zero), _mm256_cmpgt_epi16(limit, units));
+            const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(ascii));
+            // packus works per 128-bit lane: the narrowed halves are qwords 0 and 2
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(units, units), 0x08);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+            if (mask != 0xFFFFFFFF) {
+                const size_t prefix = static_cast<size_t>(std::countr_one(mask)) / 2;
+                source += prefix;
+                out += prefix;
+                return;
+            }
+            source += 16;
+            out += 16;
+        }
+        Sse2Ascii(source, out, end);
+    }
+
+    bool CpuHasAvx2() {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) return false;
+
+        // AVX needs OS support for the YMM state (OSXSAVE + XCR0 bits 1 and 2)
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) return false;
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+
+    template <typename AsciiFn>
+    size_t Transcode(const char16_t* source, std::span<char> buffer, AsciiFn ascii) {
+        char* out = buffer.data();
+        const char* end = out + buffer.size() - 1; // Last byte is reserved for the terminator
+        do {
+            if (ScalarAsciiLead(source, out, end, SCALAR_LEAD)) {
+                ascii(source, out, end);
+                ScalarAscii(source, out, end);
+            }
+        } while (ScalarRun(source, out, end));
+
+        *out = '\0';
+        return static_cast<size_t>(out - buffer.data());
+    }
+
+    SimdLevel DetectSimdLevel() {
+#if KX_UTF8_X86
+        return CpuHasAvx2() ? SimdLevel::Avx2 : SimdLevel::Sse2;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+} // namespace
+
+SimdLevel GetSimdLevel() {
+    static const SimdLevel level = DetectSimdLevel();
+    return level;
+}
+
+size_t WriteUTF16ToUTF8(const char16_t* source, std::span<char> buffer) {
+    return WriteUTF16ToUTF8(source, buffer, GetSimdLevel());
+}
+
+size_t WriteUTF16ToUTF8(const char16_t* source, std::span<char> buffer, SimdLevel level) {
+    if (buffer.empty()) {
+        return 0;
+    }
+    if (!source) {
+        buffer[0] = '\0';
+        return 0;
+    }
+
+    switch ((std::min)(level, GetSimdLevel())) {
+#if KX_UTF8_X86
+    // Lambdas rather than function pointers: each level gets its own inlined copy of the loop
+    case SimdLevel::Avx2:
+        return Transcode(source, buffer, [](const char16_t*& s, char*& o, const char* e) { Avx2Ascii(s, o, e); });
+    case SimdLevel::Sse2:
+        return Transcode(source, buffer, [](const char16_t*& s, char*& o, const char* e) { Sse2Ascii(s, o, e); });
+#endif
+    default:
+        return Transcode(source, buffer, [](const char16_t*&, char*&, const char*) {});
+    }
+}
+
+size_t WriteUTF32ToUTF8(const char32_t* source, std::span<char> buffer) {
+    if (buffer.empty()) {
+        return 0;
+    }
+    if (!source) {
+        buffer[0] = '\0';
+        return 0;
+    }
+
+    char* out = buffer.data();
+    const char* end = out + buffer.size() - 1;
+    for (; *source != 0; ++source) {
+        char32_t cp = *source;
+        if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+            cp = REPLACEMENT;
+        }
+        const size_t written = EncodeCodePoint(cp, out, static_cast<size_t>(end - out));
+        if (written == 0) {
+            break;
+        }
+        out += written;
+    }
+
+    *out = '\0';
+    return static_cast<size_t>(out - buffer.data());
+}
+
+} // namespace kx::Utf8
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace kx::Utf8 {
+
+/**
+ * @brief Instruction set used for the ASCII fast path
+ */
+enum class SimdLevel {
+    Scalar,
+    Sse2,
+    Avx2
+};
+
+/**
+ * @brief Best level supported by this CPU and build (detected once)
+ */
+[[nodiscard]] SimdLevel GetSimdLevel();
+
+/**
+ * @brief Converts a null-terminated UTF-16 string to UTF-8 directly into a pre-allocated buffer.
+ *
+ * Zero allocations. Runs of ASCII are narrowed 8 (SSE2) or 16 (AVX2) code units at a time;
+ * everything else goes through a scalar path that joins surrogate pairs and replaces unpaired
+ * surrogates with U+FFFD, like WideCharToMultiByte. Vector loads never cross a page boundary,
+ * so the source may end right before unmapped memory.
+ *
+ * Truncation: the output is always null-terminated and never ends in a partial code point.
+ * @param source Source string; nullptr writes an empty string.
+ * @param buffer Destination buffer.
+ * @return Number of bytes written (excluding null terminator); 0 for an empty buffer.
+ */
+size_t WriteUTF16ToUTF8(const char16_t* source, std::span<char> buffer);
+
+/**
+ * @brief Same as WriteUTF16ToUTF8(), capped at a given level (for tests and benchmarks)
+ * @note A level above GetSimdLevel() falls back to the best supported one.
+ */
+size_t WriteUTF16ToUTF8(const char16_t* source, std::span<char> buffer, SimdLevel level);
+
+/**
+ * @brief Converts a null-terminated UTF-32 string (wchar_t outside Windows), same semantics
+ */
+size_t WriteUTF32ToUTF8(const char32_t* source, std::span<char> buffer);
+
+} // namespace kx::Utf8